@@ -114,16 +114,27 @@ struct ReorderParam {
 
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief The state of a reorder instance
+ */
+template<typename param_>
+struct ReorderState : hvx::util::LayerArena<ReorderState<param_>> {
+    hvx::util::array1d<typename param_::src_type, param_::buf_elms> buffer;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+};
+
 /*!
  * @brief Top function of the Reordering function, if (input vector size > output vector size)
  */
 // template<typename param_, std::enable_if_t<(param_::src_dim::vec_size > param_::dst_dim::vec_size), bool> = true>
 template<typename param_, hvx::util::reorder_e reorder_type_>
 HVX_FORCE_INLINE auto
-HwReorderTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+HwReorderTop(hvx::convert::ReorderState<param_>& state, typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
     HVX_INLINE_TOP();
 
-    static hvx::util::array1d<typename param_::src_type, param_::buf_elms> buffer;
+    auto& buffer = state.buffer;
     typename param_::src_vec src_data{};
     typename param_::dst_vec dst_data{};
     // buffer to overcome the vector size missmatch
@@ -222,7 +233,16 @@ HwReorderTop(typename param_::src_port* src, typename param_::dst_port* dst) noe
     }
 }
 
-
+/*!
+ * @brief Top function of the Reordering function (uses a single state for each parameter set)
+ */
+template<typename param_, hvx::util::reorder_e reorder_type_>
+HVX_FORCE_INLINE auto
+HwReorderTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::convert::ReorderState<param_> state;
+    hvx::convert::HwReorderTop<param_, reorder_type_>(state, src, dst);
+}
 
 /******************************************************************************************************************************************/
 } // namespace convert
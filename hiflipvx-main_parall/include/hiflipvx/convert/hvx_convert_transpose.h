@@ -91,15 +91,27 @@ struct TransposeParam {
 /******************************************************************************************************************************************/
 
 /*!
- * @brief Top HW transpose function
+ * @brief The state of a transpose instance
+ */
+template<typename param_>
+struct TransposeState : hvx::util::LayerArena<TransposeState<param_>> {
+    hvx::util::array1d<typename param_::type, param_::buf_elms> buffer;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+};
+
+/*!
+ * @brief Top HW transpose function (the state of the instance is passed by the caller)
  */
 template<typename param_>
 HVX_FORCE_INLINE auto
-HwTransposeTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+HwTransposeTop(hvx::convert::TransposeState<param_>& state, typename param_::src_port* src, typename param_::dst_port* dst) noexcept
+    -> void {
     HVX_INLINE_TOP();
 
     // buffers
-    static hvx::util::array1d<typename param_::type, param_::buf_elms> buffer;
+    auto& buffer = state.buffer;
     typename param_::src_vec src_data{};
     typename param_::dst_vec dst_data{};
 
@@ -158,6 +170,17 @@ HwTransposeTop(typename param_::src_port* src, typename param_::dst_port* dst) n
     }
 }
 
+/*!
+ * @brief Top HW transpose function (uses a single state for each parameter set)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwTransposeTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::convert::TransposeState<param_> state;
+    hvx::convert::HwTransposeTop<param_>(state, src, dst);
+}
+
 /******************************************************************************************************************************************/
 } // namespace convert
 } // namespace hvx
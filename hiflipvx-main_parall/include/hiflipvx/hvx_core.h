@@ -37,6 +37,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwAbs(typename param_::src1_port* src1, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src1, dst, arg, arg);
 }
@@ -50,6 +52,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwAdd(typename param_::src1_port* src1, typename param_::src2_port* src2, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, src2, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, src2, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src2, dst, arg, arg);
 }
@@ -61,6 +65,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwAddConst(typename param_::src1_port* src1, const float arg1, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
     const auto arg_fixed = static_cast<typename param_::arg_type>(arg1);
     hvx::ew::ElementwiseTop<param_>(src1, src1, dst, arg_fixed, arg_fixed);
 }
@@ -74,6 +80,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwClip(typename param_::src1_port* src1, const float low, const float high, typename param_::dst_port* dst) {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
     const auto arg1_fixed = static_cast<typename param_::arg_type>(low);
     const auto arg2_fixed = static_cast<typename param_::arg_type>(high);
     hvx::ew::ElementwiseTop<param_>(src1, src1, dst, arg1_fixed, arg2_fixed);
@@ -88,6 +96,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwMax(typename param_::src1_port* src1, typename param_::src2_port* src2, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, src2, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, src2, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src2, dst, arg, arg);
 }
@@ -99,6 +109,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwMaxConst(typename param_::src1_port* src1, const float arg1, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
     const auto arg_fixed = static_cast<typename param_::arg_type>(arg1);
     hvx::ew::ElementwiseTop<param_>(src1, src1, dst, arg_fixed, arg_fixed);
 }
@@ -112,6 +124,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwMin(typename param_::src1_port* src1, typename param_::src2_port* src2, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, src2, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, src2, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src2, dst, arg, arg);
 }
@@ -123,6 +137,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwMinConst(typename param_::src1_port* src1, const float arg1, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
     const auto arg_fixed = static_cast<typename param_::arg_type>(arg1);
     hvx::ew::ElementwiseTop<param_>(src1, src1, dst, arg_fixed, arg_fixed);
 }
@@ -136,6 +152,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwMul(typename param_::src1_port* src1, typename param_::src2_port* src2, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, src2, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, src2, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src2, dst, arg, arg);
 }
@@ -147,6 +165,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwMulConst(typename param_::src1_port* src1, const float arg1, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
 
     // const typename param_::arg_type arg_fixed{};
     // arg_fixed = static_cast<typename param_::arg_type>(arg1);
@@ -163,6 +183,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwSigmoid(typename param_::src1_port* src1, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src1, dst, arg, arg);
 }
@@ -176,6 +198,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwSub(typename param_::src1_port* src1, typename param_::src2_port* src2, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, src2, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, src2, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src2, dst, arg, arg);
 }
@@ -189,6 +213,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwTanh(typename param_::src1_port* src1, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src1, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, dst);
     const typename param_::arg_type arg{};
     hvx::ew::ElementwiseTop<param_>(src1, src1, dst, arg, arg);
 }
@@ -202,6 +228,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwReduceMax(typename param_::src_port* src, typename param_::dst_port* dst) {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::red::ReduceTop<param_>(src, dst);
 }
 
@@ -214,6 +242,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwReduceMean(typename param_::src_port* src, typename param_::dst_port* dst) {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::red::ReduceTop<param_>(src, dst);
 }
 
@@ -226,6 +256,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwReduceMin(typename param_::src_port* src, typename param_::dst_port* dst) {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::red::ReduceTop<param_>(src, dst);
 }
 
@@ -238,6 +270,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwReduceSum(typename param_::src_port* src, typename param_::dst_port* dst) {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::red::ReduceTop<param_>(src, dst);
 }
 
@@ -253,9 +287,27 @@ HwLayernorm(typename param_::src_port* src,
             typename param_::bias_vec* bias,
             typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
     hvx::nn::LayernormTop<param_>(src, wgts, bias, dst);
 }
 
+/*!
+ * @brief Layer Normalization layer (with an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwLayernorm(hvx::nn::LayernormState<param_>& state,
+            typename param_::src_port* src,
+            typename param_::wgts_vec* wgts,
+            typename param_::bias_vec* bias,
+            typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    hvx::nn::LayernormTop<param_>(state, src, wgts, bias, dst);
+}
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -265,9 +317,23 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwSoftmax(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::nn::SoftmaxTop<param_>(src, dst);
 }
 
+/*!
+ * @brief Softmax layer (with an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwSoftmax(hvx::nn::SoftmaxState<param_>& state, typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
+    hvx::nn::SoftmaxTop<param_>(state, src, dst);
+}
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -277,6 +343,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwPoolAvg(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::nn::PoolTop<param_, hvx::util::pooling_e::kAvg>(src, dst);
 }
 
@@ -289,11 +357,55 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwPoolMax(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::nn::PoolTop<param_, hvx::util::pooling_e::kMax>(src, dst);
 }
 
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief Global average pooling layer
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwGlobalPoolAvg(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
+    hvx::nn::GlobalPoolTop<param_, hvx::util::pooling_e::kAvg>(src, dst);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Global max pooling layer
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwGlobalPoolMax(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
+    hvx::nn::GlobalPoolTop<param_, hvx::util::pooling_e::kMax>(src, dst);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Global sum pooling layer
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwGlobalPoolSum(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
+    hvx::nn::GlobalPoolTop<param_, hvx::util::pooling_e::kSum>(src, dst);
+}
+
+/******************************************************************************************************************************************/
+
 /*!
  * @brief Dense layer (with Bias)
  */
@@ -304,6 +416,8 @@ HwDense(typename param_::src_port* src,
         typename param_::bias_vec* bias,
         typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
     hvx::nn::DenseTop<param_>(src, wgts, bias, dst);
 }
 
@@ -314,9 +428,172 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwDense(typename param_::src_port* src, typename param_::wgts_vec* wgts, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, wgts, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, dst);
     hvx::nn::DenseTop<param_>(src, wgts, dst);
 }
 
+/*!
+ * @brief Dense layer (with Bias and an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwDense(hvx::nn::DenseState<param_>& state,
+        typename param_::src_port* src,
+        typename param_::wgts_vec* wgts,
+        typename param_::bias_vec* bias,
+        typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    hvx::nn::DenseTop<param_>(state, src, wgts, bias, dst);
+}
+
+/*!
+ * @brief Dense layer (without Bias, with an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwDense(hvx::nn::DenseState<param_>& state,
+        typename param_::src_port* src,
+        typename param_::wgts_vec* wgts,
+        typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, wgts, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, dst);
+    hvx::nn::DenseTop<param_>(state, src, wgts, dst);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Matrix multiplication of two activations (batched GEMM)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwMatMul(typename param_::src1_port* src1, typename param_::src2_port* src2, typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src1, src2, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, src2, dst);
+    hvx::nn::MatMulTop<param_>(src1, src2, dst);
+}
+
+/*!
+ * @brief Matrix multiplication of two activations (batched GEMM, with an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwMatMul(hvx::nn::MatMulState<param_>& state,
+         typename param_::src1_port* src1,
+         typename param_::src2_port* src2,
+         typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src1, src2, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src1, src2, dst);
+    hvx::nn::MatMulTop<param_>(state, src1, src2, dst);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Multi-head attention with a KV-cache (single sequence)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwAttention(typename param_::src_port* q,
+            typename param_::src_port* k,
+            typename param_::src_port* v,
+            typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(q, k, v, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(q, k, v, dst);
+    hvx::nn::AttentionTop<param_>(q, k, v, dst);
+}
+
+/*!
+ * @brief Multi-head attention with a KV-cache (the state holds the cache of a sequence)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwAttention(hvx::nn::AttentionState<param_>& state,
+            typename param_::src_port* q,
+            typename param_::src_port* k,
+            typename param_::src_port* v,
+            typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(q, k, v, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(q, k, v, dst);
+    hvx::nn::AttentionTop<param_>(state, q, k, v, dst);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief LSTM layer (the hidden and cell state continue the sequence of the previous call)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwLstm(typename param_::src_port* src,
+       typename param_::wgts_port* wgts,
+       typename param_::bias_port* bias,
+       typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    static_assert(param_::cell_type == hvx::util::rnn_e::kLstm, "Wrong cell type!");
+    hvx::nn::RnnTop<param_>(src, wgts, bias, dst);
+}
+
+/*!
+ * @brief LSTM layer (the state holds the hidden and cell state of a sequence)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwLstm(hvx::nn::RnnState<param_>& state,
+       typename param_::src_port* src,
+       typename param_::wgts_port* wgts,
+       typename param_::bias_port* bias,
+       typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    static_assert(param_::cell_type == hvx::util::rnn_e::kLstm, "Wrong cell type!");
+    hvx::nn::RnnTop<param_>(state, src, wgts, bias, dst);
+}
+
+/*!
+ * @brief GRU layer (the hidden and cell state continue the sequence of the previous call)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwGru(typename param_::src_port* src,
+      typename param_::wgts_port* wgts,
+      typename param_::bias_port* bias,
+      typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    static_assert(param_::cell_type == hvx::util::rnn_e::kGru, "Wrong cell type!");
+    hvx::nn::RnnTop<param_>(src, wgts, bias, dst);
+}
+
+/*!
+ * @brief GRU layer (the state holds the hidden and cell state of a sequence)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwGru(hvx::nn::RnnState<param_>& state,
+      typename param_::src_port* src,
+      typename param_::wgts_port* wgts,
+      typename param_::bias_port* bias,
+      typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    static_assert(param_::cell_type == hvx::util::rnn_e::kGru, "Wrong cell type!");
+    hvx::nn::RnnTop<param_>(state, src, wgts, bias, dst);
+}
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -329,6 +606,8 @@ HwDepthwise(typename param_::src_port* src,
             typename param_::bias_vec* bias,
             typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, wgts, bias, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
     hvx::nn::DepthwiseTop<param_, true>(src, wgts, bias, dst);
 }
 
@@ -339,6 +618,8 @@ template<typename param_>
 HVX_FORCE_INLINE auto
 HwDepthwise(typename param_::src_port* src, typename param_::wgts_vec* wgts, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, wgts, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, dst);
     hvx::nn::DepthwiseTop<param_, false>(src, wgts, nullptr, dst);
 }
 
@@ -354,6 +635,8 @@ HwConv(typename param_::src_port* src,
        typename param_::bias_vec* bias,
        typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, bias, dst); // wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
     hvx::nn::ConvTop<param_, true>(src, wgts, bias, dst);
 }
 
@@ -364,9 +647,139 @@ template<typename param_>
 HVX_FORCE_INLINE auto
 HwConv(typename param_::src_port* src, typename param_::wgts_vec* wgts, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst); // wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, dst);
     hvx::nn::ConvTop<param_, false>(src, wgts, nullptr, dst);
 }
 
+/*!
+ * @brief Convolution layer (with Bias and an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwConv(hvx::nn::ConvState<param_>& state,
+       typename param_::src_port* src,
+       typename param_::wgts_vec* wgts,
+       typename param_::bias_vec* bias,
+       typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, bias, dst); // wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    hvx::nn::ConvTop<param_, true>(state, src, wgts, bias, dst);
+}
+
+/*!
+ * @brief Convolution layer (without Bias, with an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwConv(hvx::nn::ConvState<param_>& state,
+       typename param_::src_port* src,
+       typename param_::wgts_vec* wgts,
+       typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dst); // wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, dst);
+    hvx::nn::ConvTop<param_, false>(state, src, wgts, nullptr, dst);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Fused depthwise-separable layer (with Bias)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwSeparable(typename param_::src_port* src,
+            typename param_::dw_wgts_vec* dw_wgts,
+            typename param_::dw_bias_vec* dw_bias,
+            typename param_::pw_wgts_vec* pw_wgts,
+            typename param_::pw_bias_vec* pw_bias,
+            typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dw_wgts, dw_bias, pw_bias, dst); // pw_wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dw_wgts, dw_bias, pw_wgts, pw_bias, dst);
+    hvx::nn::SeparableTop<param_, true>(src, dw_wgts, dw_bias, pw_wgts, pw_bias, dst);
+}
+
+/*!
+ * @brief Fused depthwise-separable layer (without Bias)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwSeparable(typename param_::src_port* src,
+            typename param_::dw_wgts_vec* dw_wgts,
+            typename param_::pw_wgts_vec* pw_wgts,
+            typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dw_wgts, dst); // pw_wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dw_wgts, pw_wgts, dst);
+    hvx::nn::SeparableTop<param_, false>(src, dw_wgts, nullptr, pw_wgts, nullptr, dst);
+}
+
+/*!
+ * @brief Fused depthwise-separable layer (with Bias and an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwSeparable(hvx::nn::SeparableState<param_>& state,
+            typename param_::src_port* src,
+            typename param_::dw_wgts_vec* dw_wgts,
+            typename param_::dw_bias_vec* dw_bias,
+            typename param_::pw_wgts_vec* pw_wgts,
+            typename param_::pw_bias_vec* pw_bias,
+            typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dw_wgts, dw_bias, pw_bias, dst); // pw_wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dw_wgts, dw_bias, pw_wgts, pw_bias, dst);
+    hvx::nn::SeparableTop<param_, true>(state, src, dw_wgts, dw_bias, pw_wgts, pw_bias, dst);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Transposed convolution layer (with Bias)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwTransposedConv(typename param_::src_port* src,
+                 typename param_::wgts_vec* wgts,
+                 typename param_::bias_vec* bias,
+                 typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, bias, dst); // wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    hvx::nn::TransposedConvTop<param_, true>(src, wgts, bias, dst);
+}
+
+/*!
+ * @brief Transposed convolution layer (without Bias)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwTransposedConv(typename param_::src_port* src, typename param_::wgts_vec* wgts, typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dst); // wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, dst);
+    hvx::nn::TransposedConvTop<param_, false>(src, wgts, nullptr, dst);
+}
+
+/*!
+ * @brief Transposed convolution layer (with Bias and an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+HwTransposedConv(hvx::nn::TransposedConvState<param_>& state,
+                 typename param_::src_port* src,
+                 typename param_::wgts_vec* wgts,
+                 typename param_::bias_vec* bias,
+                 typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, bias, dst); // wgts,
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, wgts, bias, dst);
+    hvx::nn::TransposedConvTop<param_, true>(state, src, wgts, bias, dst);
+}
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -376,9 +789,23 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwTranspose(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::convert::HwTransposeTop<param_>(src, dst);
 }
 
+/*!
+ * @brief Transpose layer (with an explicit layer state)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+HwTranspose(hvx::convert::TransposeState<param_>& state, typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
+    hvx::convert::HwTransposeTop<param_>(state, src, dst);
+}
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -388,6 +815,8 @@ template<typename param_>
 HVX_FORCE_INLINE auto
 HwReshape(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst);
     hvx::convert::HwReshapeTop<param_>(src, dst);
 }
 
@@ -399,6 +828,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwMulticast(typename param_::vec* src, typename param_::vec* dst0, typename param_::vec* dst1) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst0, dst1);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst0, dst1);
     hvx::convert::HwMulticastTop<param_, typename param_::dim, typename param_::dim>(src, dst0, dst1);
 }
 
@@ -410,6 +841,8 @@ HVX_FORCE_INLINE constexpr auto
 HwMulticast(typename param_::vec* src, typename param_::vec* dst0, typename param_::vec* dst1, typename param_::vec* dst2) noexcept
     -> void {
     HVX_DATAPACK_TOP(src, dst0, dst1, dst2);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst0, dst1, dst2);
     hvx::convert::HwMulticastTop<param_, typename param_::dim, typename param_::dim, typename param_::dim>(src, dst0, dst1, dst2);
 }
 
@@ -424,6 +857,8 @@ HwMulticast(typename param_::vec* src,
             typename param_::vec* dst2,
             typename param_::vec* dst3) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst0, dst1, dst2, dst3);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst0, dst1, dst2, dst3);
     hvx::convert::HwMulticastTop<param_, typename param_::dim, typename param_::dim, typename param_::dim, typename param_::dim>(
         src, dst0, dst1, dst2, dst3);
 }
@@ -437,6 +872,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwConcat(typename param_::split0_vec* src0, typename param_::split1_vec* src1, typename param_::vec* dst) noexcept -> void {
     HVX_DATAPACK_TOP(dst, src0, src1);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src0, src1, dst);
     hvx::convert::HwConcatTop<param_, typename param_::split0::dim, typename param_::split1::dim>(dst, src0, src1);
 }
 
@@ -450,6 +887,8 @@ HwConcat(typename param_::split0_vec* src0,
          typename param_::split2_vec* src2,
          typename param_::vec* dst) noexcept -> void {
     HVX_DATAPACK_TOP(dst, src0, src1, src2);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src0, src1, src2, dst);
     hvx::convert::HwConcatTop<param_, typename param_::split0::dim, typename param_::split1::dim, typename param_::split2::dim>(dst, src0,
                                                                                                                                 src1, src2);
 }
@@ -465,6 +904,8 @@ HwConcat(typename param_::split0_vec* src0,
          typename param_::split3_vec* src3,
          typename param_::vec* dst) noexcept -> void {
     HVX_DATAPACK_TOP(dst, src0, src1, src2, src3);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src0, src1, src2, src3, dst);
     hvx::convert::HwConcatTop<param_, typename param_::split0::dim, typename param_::split1::dim, typename param_::split2::dim,
                               typename param_::split3::dim>(dst, src0, src1, src2, src3);
 }
@@ -478,6 +919,8 @@ template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 HwSplit(typename param_::vec* src, typename param_::split0_vec* dst0, typename param_::split1_vec* dst1) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst0, dst1);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst0, dst1);
     hvx::convert::HwSplitTop<param_, typename param_::split0::dim, typename param_::split1::dim>(src, dst0, dst1);
 }
 
@@ -491,6 +934,8 @@ HwSplit(typename param_::vec* src,
         typename param_::split1_vec* dst1,
         typename param_::split2_vec* dst2) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst0, dst1, dst2);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst0, dst1, dst2);
     hvx::convert::HwSplitTop<param_, typename param_::split0::dim, typename param_::split1::dim, typename param_::split2::dim>(src, dst0,
                                                                                                                                dst1, dst2);
 }
@@ -506,6 +951,8 @@ HwSplit(typename param_::vec* src,
         typename param_::split2_vec* dst2,
         typename param_::split3_vec* dst3) noexcept -> void {
     HVX_DATAPACK_TOP(src, dst0, dst1, dst2, dst3);
+    HVX_SIM_PROFILE_TOP();
+    HVX_SIM_STREAM_TOP(src, dst0, dst1, dst2, dst3);
     hvx::convert::HwSplitTop<param_, typename param_::split0::dim, typename param_::split1::dim, typename param_::split2::dim,
                              typename param_::split3::dim>(src, dst0, dst1, dst2, dst3);
 }
@@ -31,14 +31,25 @@
 #include "convert/hvx_convert_split.h"
 // #include "convert/hvx_convert_stream.h"
 #include "convert/hvx_convert_transpose.h"
+#include "nn/hvx_nn_attention.h"
 #include "nn/hvx_nn_conv.h"
 #include "nn/hvx_nn_dense.h"
 #include "nn/hvx_nn_depthwise.h"
+#include "nn/hvx_nn_global_pool.h"
 #include "nn/hvx_nn_layernorm.h"
+#include "nn/hvx_nn_matmul.h"
 #include "nn/hvx_nn_pool.h"
+#include "nn/hvx_nn_rnn.h"
+#include "nn/hvx_nn_separable.h"
 #include "nn/hvx_nn_softmax.h"
+#include "nn/hvx_nn_transposed_conv.h"
 #include "op/hvx_ew_core.h"
 #include "op/hvx_reduce_core.h"
+#include "sim/hvx_sim_dataflow.h"
+#include "sim/hvx_sim_fifo.h"
+#include "sim/hvx_sim_parallel.h"
+#include "util/hvx_util_perf.h"
+#include "util/hvx_util_weights_prep.h"
 
 namespace hvx {
 /******************************************************************************************************************************************/
@@ -47,7 +58,13 @@ namespace hvx {
 using overflow_e  = hvx::util::overflow_e;
 using underflow_e = hvx::util::underflow_e;
 using execution_e = hvx::util::execution_e;
+using conv_e      = hvx::util::conv_e;
+using sim_e       = hvx::util::sim_e;
+using norm_e      = hvx::util::norm_e;
+using norm_axes_e = hvx::util::norm_axes_e;
+using softmax_e   = hvx::util::softmax_e;
 using axis_e      = hvx::util::axis_e;
+using elmwise_e   = hvx::util::elmwise_e;
 
 /*!
  * @brief Definition of a fixed-point data type
@@ -61,6 +78,12 @@ using dfloat = dynfloat::dfloat<exp_bits_, man_bits_>;
 template<typename type_, int64_t frac_bits_ = 0>
 using dfixed = hvx::util::dfixed<type_, frac_bits_>;
 
+/*!
+ * @brief Definition of the bias of a per-channel quantized layer (bias, multiplier and shift of the requantization, src zero point)
+ */
+template<typename type_ = int32_t, int64_t src_zero_ = 0>
+using dqbias = hvx::util::dqbias<type_, src_zero_>;
+
 /*!
  * @brief A simple array data type
  */
@@ -79,6 +102,22 @@ using array2d_param = hvx::util::Array2dParam<rows_, cols_>;
 template<int64_t max_, int64_t min_>
 using clip_param = hvx::util::ClipParam<max_, min_>;
 
+/*!
+ * @brief A rational compile time constant (num_ / den_)
+ */
+template<int64_t num_, int64_t den_>
+using ratio_param = hvx::util::RatioParam<num_, den_>;
+
+/*!
+ * @brief Epilogue of a conv/dense layer: act(result * scale + shift)
+ */
+template<hvx::elmwise_e act_ = hvx::elmwise_e::None,
+         typename scale_     = hvx::ratio_param<1, 1>,
+         typename shift_     = hvx::ratio_param<0, 1>,
+         typename arg1_      = hvx::ratio_param<0, 1>,
+         typename arg2_      = hvx::ratio_param<0, 1>>
+using epilogue_param = hvx::util::EpilogueParam<act_, scale_, shift_, arg1_, arg2_>;
+
 /*!
  * @brief Compile time parameters and checks of a vector
  */
@@ -378,7 +417,10 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
          hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
          hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
-         typename clip_                         = hvx::util::ClipParam<1, 0>>
+         typename clip_                         = hvx::util::ClipParam<1, 0>,
+         hvx::util::norm_e norm_type_           = hvx::util::norm_e::kAffine,
+         hvx::util::norm_axes_e norm_axes_      = hvx::util::norm_axes_e::kChnls,
+         typename eps_                          = hvx::util::RatioParam<1, 100000>>
 using layernorm_param = hvx::nn::LayernormParam<src_type_,
                                                 dst_type_,
                                                 wgts_type_,
@@ -392,7 +434,10 @@ using layernorm_param = hvx::nn::LayernormParam<src_type_,
                                                 overflow_type_,
                                                 underflow_type_,
                                                 exec_type_,
-                                                clip_>;
+                                                clip_,
+                                                norm_type_,
+                                                norm_axes_,
+                                                eps_>;
 
 /*!
  * @brief Compile time parameters and checks for softmax function
@@ -405,9 +450,18 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          typename chnls_v                       = hvx::util::VectorParam<1, 1>,
          hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
          hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
-         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
-using softmax_param =
-    hvx::nn::SoftmaxParam<src_type_, dst_type_, batch_v, src_rows_v, src_cols_v, chnls_v, overflow_type_, underflow_type_, exec_type_>;
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         hvx::util::softmax_e softmax_type_     = hvx::util::softmax_e::kTwoPass>
+using softmax_param = hvx::nn::SoftmaxParam<src_type_,
+                                            dst_type_,
+                                            batch_v,
+                                            src_rows_v,
+                                            src_cols_v,
+                                            chnls_v,
+                                            overflow_type_,
+                                            underflow_type_,
+                                            exec_type_,
+                                            softmax_type_>;
 
 /*!
  * @brief Compile time parameters and checks for dense (fully connected) function
@@ -423,7 +477,9 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          int64_t buf_bias_                      = false,
          hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
          hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
-         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         typename epilogue_                     = hvx::util::EpilogueParam<>,
+         hvx::sim_e sim_type_                   = hvx::sim_e::kHw>
 using dense_param = hvx::nn::DenseParam<src_type_,
                                         dst_type_,
                                         wgts_type_,
@@ -435,7 +491,121 @@ using dense_param = hvx::nn::DenseParam<src_type_,
                                         buf_bias_,
                                         overflow_type_,
                                         underflow_type_,
-                                        exec_type_>;
+                                        exec_type_,
+                                        epilogue_,
+                                        sim_type_>;
+
+/*!
+ * @brief Compile time parameters and checks for the multi-head attention with a KV-cache
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename heads_v                       = hvx::util::VectorParam<1, 1>,
+         typename dims_v                        = hvx::util::VectorParam<1, 1>,
+         typename tokens_v                      = hvx::util::VectorParam<1, 1>,
+         int64_t cache_len_                     = 1,
+         bool scaled_                           = true,
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+using attention_param = hvx::nn::AttentionParam<src_type_,
+                                                dst_type_,
+                                                heads_v,
+                                                dims_v,
+                                                tokens_v,
+                                                cache_len_,
+                                                scaled_,
+                                                overflow_type_,
+                                                underflow_type_,
+                                                exec_type_>;
+
+/*!
+ * @brief Compile time parameters and checks for the matrix multiplication of two activations (batched GEMM)
+ */
+template<typename src1_type_                    = hvx::util::dfixed<int16_t, 15>,
+         typename src2_type_                    = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,
+         typename heads_v                       = hvx::util::VectorParam<1, 1>,
+         typename rows_v                        = hvx::util::VectorParam<1, 1>,
+         typename inner_v                       = hvx::util::VectorParam<1, 1>,
+         typename cols_v                        = hvx::util::VectorParam<1, 1>,
+         int64_t src2_trans_                    = false,
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         typename epilogue_                     = hvx::util::EpilogueParam<>>
+using matmul_param = hvx::nn::MatMulParam<src1_type_,
+                                          src2_type_,
+                                          dst_type_,
+                                          batch_v,
+                                          heads_v,
+                                          rows_v,
+                                          inner_v,
+                                          cols_v,
+                                          src2_trans_,
+                                          overflow_type_,
+                                          underflow_type_,
+                                          exec_type_,
+                                          epilogue_>;
+
+/*!
+ * @brief Compile time parameters and checks for the LSTM layer
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename wgts_type_                    = hvx::util::dfixed<int16_t, 15>,
+         typename bias_type_                    = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,
+         typename seq_v                         = hvx::util::VectorParam<1, 1>,
+         typename src_v                         = hvx::util::VectorParam<1, 1>,
+         typename hidden_v                      = hvx::util::VectorParam<1, 1>,
+         int64_t buf_wgts_                      = false,
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+using lstm_param = hvx::nn::RnnParam<src_type_,
+                                     wgts_type_,
+                                     bias_type_,
+                                     dst_type_,
+                                     batch_v,
+                                     seq_v,
+                                     src_v,
+                                     hidden_v,
+                                     hvx::util::rnn_e::kLstm,
+                                     buf_wgts_,
+                                     overflow_type_,
+                                     underflow_type_,
+                                     exec_type_>;
+
+/*!
+ * @brief Compile time parameters and checks for the GRU layer
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename wgts_type_                    = hvx::util::dfixed<int16_t, 15>,
+         typename bias_type_                    = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,
+         typename seq_v                         = hvx::util::VectorParam<1, 1>,
+         typename src_v                         = hvx::util::VectorParam<1, 1>,
+         typename hidden_v                      = hvx::util::VectorParam<1, 1>,
+         int64_t buf_wgts_                      = false,
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+using gru_param = hvx::nn::RnnParam<src_type_,
+                                    wgts_type_,
+                                    bias_type_,
+                                    dst_type_,
+                                    batch_v,
+                                    seq_v,
+                                    src_v,
+                                    hidden_v,
+                                    hvx::util::rnn_e::kGru,
+                                    buf_wgts_,
+                                    overflow_type_,
+                                    underflow_type_,
+                                    exec_type_>;
 
 /*!
  * @brief Compile time parameters and checks for average pooling function
@@ -503,6 +673,75 @@ using pool_max_param = hvx::nn::PoolParam<src_type_,
                                           exec_type_,
                                           hvx::util::pooling_e::kMax>;
 
+/*!
+ * @brief Compile time parameters and checks for global average pooling function
+ */
+template<typename src_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename batch_size_             = hvx::vector_param<1, 1>,
+         typename src_rows_               = hvx::vector_param<1, 1>,
+         typename src_cols_               = hvx::vector_param<1, 1>,
+         typename chnls_                  = hvx::vector_param<1, 1>,
+         hvx::overflow_e overflow_type_   = hvx::overflow_e::kSaturate,
+         hvx::underflow_e underflow_type_ = hvx::underflow_e::kTrunc,
+         hvx::execution_e exec_type_      = hvx::execution_e::kExact>
+using global_pool_avg_param = hvx::nn::GlobalPoolParam<src_type_,
+                                                       dst_type_,
+                                                       batch_size_,
+                                                       src_rows_,
+                                                       src_cols_,
+                                                       chnls_,
+                                                       overflow_type_,
+                                                       underflow_type_,
+                                                       exec_type_,
+                                                       hvx::util::pooling_e::kAvg>;
+
+/*!
+ * @brief Compile time parameters and checks for global max pooling function
+ */
+template<typename src_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename batch_size_             = hvx::vector_param<1, 1>,
+         typename src_rows_               = hvx::vector_param<1, 1>,
+         typename src_cols_               = hvx::vector_param<1, 1>,
+         typename chnls_                  = hvx::vector_param<1, 1>,
+         hvx::overflow_e overflow_type_   = hvx::overflow_e::kSaturate,
+         hvx::underflow_e underflow_type_ = hvx::underflow_e::kTrunc,
+         hvx::execution_e exec_type_      = hvx::execution_e::kExact>
+using global_pool_max_param = hvx::nn::GlobalPoolParam<src_type_,
+                                                       dst_type_,
+                                                       batch_size_,
+                                                       src_rows_,
+                                                       src_cols_,
+                                                       chnls_,
+                                                       overflow_type_,
+                                                       underflow_type_,
+                                                       exec_type_,
+                                                       hvx::util::pooling_e::kMax>;
+
+/*!
+ * @brief Compile time parameters and checks for global sum pooling function
+ */
+template<typename src_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename batch_size_             = hvx::vector_param<1, 1>,
+         typename src_rows_               = hvx::vector_param<1, 1>,
+         typename src_cols_               = hvx::vector_param<1, 1>,
+         typename chnls_                  = hvx::vector_param<1, 1>,
+         hvx::overflow_e overflow_type_   = hvx::overflow_e::kSaturate,
+         hvx::underflow_e underflow_type_ = hvx::underflow_e::kTrunc,
+         hvx::execution_e exec_type_      = hvx::execution_e::kExact>
+using global_pool_sum_param = hvx::nn::GlobalPoolParam<src_type_,
+                                                       dst_type_,
+                                                       batch_size_,
+                                                       src_rows_,
+                                                       src_cols_,
+                                                       chnls_,
+                                                       overflow_type_,
+                                                       underflow_type_,
+                                                       exec_type_,
+                                                       hvx::util::pooling_e::kSum>;
+
 /*!
  * @brief Compile time parameters and checks for depthwise convolution function
  */
@@ -523,7 +762,8 @@ template<typename src_type_               = hvx::util::dfixed<int16_t, 15>,
          int64_t buf_bias_                = false,
          hvx::overflow_e overflow_type_   = hvx::overflow_e::kSaturate,
          hvx::underflow_e underflow_type_ = hvx::underflow_e::kTrunc,
-         hvx::execution_e exec_type_      = hvx::execution_e::kExact>
+         hvx::execution_e exec_type_      = hvx::execution_e::kExact,
+         typename epilogue_               = hvx::epilogue_param<>>
 using depthwise_param = hvx::nn::DepthwiseParam<src_type_,
                                                 dst_type_,
                                                 wgts_type_,
@@ -541,7 +781,8 @@ using depthwise_param = hvx::nn::DepthwiseParam<src_type_,
                                                 buf_bias_,
                                                 overflow_type_,
                                                 underflow_type_,
-                                                exec_type_>;
+                                                exec_type_,
+                                                epilogue_>;
 
 /*!
  * @brief Compile time parameters and checks for convolution function
@@ -564,7 +805,10 @@ template<typename src_type_               = hvx::util::dfixed<int16_t, 15>,
          int64_t buf_bias_                = false,
          hvx::overflow_e overflow_type_   = hvx::overflow_e::kSaturate,
          hvx::underflow_e underflow_type_ = hvx::underflow_e::kTrunc,
-         hvx::execution_e exec_type_      = hvx::execution_e::kExact>
+         hvx::execution_e exec_type_      = hvx::execution_e::kExact,
+         hvx::conv_e conv_type_           = hvx::conv_e::kDirect,
+         typename epilogue_               = hvx::epilogue_param<>,
+         hvx::sim_e sim_type_             = hvx::sim_e::kHw>
 using conv_param = hvx::nn::ConvParam<src_type_,
                                       dst_type_,
                                       wgts_type_,
@@ -583,9 +827,114 @@ using conv_param = hvx::nn::ConvParam<src_type_,
                                       buf_bias_,
                                       overflow_type_,
                                       underflow_type_,
-                                      exec_type_>;
+                                      exec_type_,
+                                      conv_type_,
+                                      epilogue_,
+                                      sim_type_>;
 
+/*!
+ * @brief Compile time parameters and checks for the fused depthwise-separable function (depthwise conv followed by a 1x1 conv)
+ */
+template<typename src_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename wgts_type_              = hvx::util::dfixed<int16_t, 15>,
+         typename bias_type_              = hvx::util::dfixed<int16_t, 15>,
+         typename mid_type_               = dst_type_,
+         typename batch_size_             = hvx::vector_param<1, 1>,
+         typename src_rows_               = hvx::vector_param<1, 1>,
+         typename src_cols_               = hvx::vector_param<1, 1>,
+         typename chnls_                  = hvx::vector_param<1, 1>,
+         typename fms_                    = hvx::vector_param<1, 1>,
+         typename knl_rows_               = hvx::vector_param<1, 1>,
+         typename knl_cols_               = hvx::vector_param<1, 1>,
+         typename pad_                    = hvx::array2d_param<0, 0>,
+         typename dil_                    = hvx::array2d_param<0, 0>,
+         typename str_                    = hvx::array2d_param<1, 1>,
+         int64_t buf_wgts_                = false,
+         int64_t buf_bias_                = false,
+         hvx::overflow_e overflow_type_   = hvx::overflow_e::kSaturate,
+         hvx::underflow_e underflow_type_ = hvx::underflow_e::kTrunc,
+         hvx::execution_e exec_type_      = hvx::execution_e::kExact,
+         typename epilogue_               = hvx::epilogue_param<>>
+using separable_param = hvx::nn::SeparableParam<src_type_,
+                                                dst_type_,
+                                                wgts_type_,
+                                                bias_type_,
+                                                mid_type_,
+                                                batch_size_,
+                                                src_rows_,
+                                                src_cols_,
+                                                chnls_,
+                                                fms_,
+                                                knl_rows_,
+                                                knl_cols_,
+                                                pad_,
+                                                dil_,
+                                                str_,
+                                                buf_wgts_,
+                                                buf_bias_,
+                                                overflow_type_,
+                                                underflow_type_,
+                                                exec_type_,
+                                                epilogue_>;
+
+/*!
+ * @brief Compile time parameters and checks for the transposed convolution function (learned upsampling, dst rows/cols vectorized by str)
+ */
+template<typename src_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_               = hvx::util::dfixed<int16_t, 15>,
+         typename wgts_type_              = hvx::util::dfixed<int16_t, 15>,
+         typename bias_type_              = hvx::util::dfixed<int16_t, 15>,
+         typename batch_size_             = hvx::vector_param<1, 1>,
+         typename src_rows_               = hvx::vector_param<1, 1>,
+         typename src_cols_               = hvx::vector_param<1, 1>,
+         typename chnls_                  = hvx::vector_param<1, 1>,
+         typename fms_                    = hvx::vector_param<1, 1>,
+         typename knl_rows_               = hvx::vector_param<1, 1>,
+         typename knl_cols_               = hvx::vector_param<1, 1>,
+         typename pad_                    = hvx::array2d_param<0, 0>,
+         typename str_                    = hvx::array2d_param<1, 1>,
+         typename out_pad_                = hvx::array2d_param<0, 0>,
+         int64_t buf_wgts_                = false,
+         int64_t buf_bias_                = false,
+         hvx::overflow_e overflow_type_   = hvx::overflow_e::kSaturate,
+         hvx::underflow_e underflow_type_ = hvx::underflow_e::kTrunc,
+         hvx::execution_e exec_type_      = hvx::execution_e::kExact,
+         typename epilogue_               = hvx::epilogue_param<>>
+using transposed_conv_param = hvx::nn::TransposedConvParam<src_type_,
+                                                           dst_type_,
+                                                           wgts_type_,
+                                                           bias_type_,
+                                                           batch_size_,
+                                                           src_rows_,
+                                                           src_cols_,
+                                                           chnls_,
+                                                           fms_,
+                                                           knl_rows_,
+                                                           knl_cols_,
+                                                           pad_,
+                                                           str_,
+                                                           out_pad_,
+                                                           buf_wgts_,
+                                                           buf_bias_,
+                                                           overflow_type_,
+                                                           underflow_type_,
+                                                           exec_type_,
+                                                           epilogue_>;
+
+/******************************************************************************************************************************************/
 
+/*!
+ * @brief Analytic performance model of a layer (cycles, interval, pipeline fill/drain, frames/s)
+ */
+template<typename param_>
+using perf_model = hvx::util::PerfModel<param_>;
+
+/*!
+ * @brief Analytic performance model of a dataflow chain of layers (bottleneck, interval, latency, frames/s)
+ */
+template<typename... params_>
+using perf_chain = hvx::util::PerfChain<params_...>;
 
 /******************************************************************************************************************************************/
 } // namespace hvx
@@ -0,0 +1,282 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_attention.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Multi-head scaled dot-product attention with a KV-cache for autoregressive decoding. The keys and values of every call are appended
+ *  to a bounded cache (ring buffer) that persists across calls, so a new token only attends to the cached tokens (O(seq) per token
+ *  instead of recomputing the whole prefix). The causal mask is given by the schedule: a token only iterates over the keys up to its own
+ *  position (and at most over the last "cache_len" tokens).
+ */
+
+#ifndef HVX_NN_ATTENTION_H_
+#define HVX_NN_ATTENTION_H_
+
+#include "impl/hvx_nn_attention_dfixed.h"
+
+namespace hvx {
+namespace nn {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief All compile time parameters and checks for the attention function. The query, key, value and dst tensors contain the new
+ * tokens of a call ([tokens][heads][dims]).
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the query, key and value inputs
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the outputs
+         typename heads_v                       = hvx::util::VectorParam<1, 1>,   // number of heads
+         typename dims_v                        = hvx::util::VectorParam<1, 1>,   // number of dimensions of a head
+         typename tokens_v                      = hvx::util::VectorParam<1, 1>,   // number of new tokens per call (1 for decoding)
+         int64_t cache_len_                     = 1,                              // maximum number of tokens in the KV-cache
+         bool scaled_                           = true,                           // if the scores are scaled by 1 / sqrt(dims)
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+struct AttentionParam {
+    // tensor parameters
+    using src_dim = hvx::util::TensorParam<3, dims_v, heads_v, tokens_v>;
+    using dst_dim = src_dim;
+
+    // dimensions
+    static constexpr auto heads        = heads_v::elms;
+    static constexpr auto dims         = dims_v::elms;
+    static constexpr auto dim_vec_size = dims_v::vec_size;
+    static constexpr auto dim_vec_elms = dims_v::vec_elms;
+    static constexpr auto tokens       = tokens_v::elms;
+    static constexpr auto cache_len    = cache_len_;
+    static constexpr auto cache_elms   = heads * cache_len * dim_vec_elms;
+    static constexpr auto scaled       = scaled_;
+
+    // data types (the softmax and the weighted sum of the values are computed in floating-point)
+    using src_type  = src_type_;
+    using dst_type  = dst_type_;
+    using comp_type = hvx::util::def_int_type_t<src_type_, src_type_>;
+    using buf_type  = hvx::util::def_flt_type_t<src_type_>;
+    using dot_type  = std::conditional_t<src_type_::is_int, comp_type, buf_type>;
+    using src_vec   = hvx::util::vector<src_type, src_dim::vec_size>;
+    using dst_vec   = hvx::util::vector<dst_type, dst_dim::vec_size>;
+    using buf_vec   = hvx::util::vector<buf_type, dim_vec_size>;
+    using src_port  = src_vec;
+    using dst_port  = dst_vec;
+
+    // numerical stability (applied when the result is converted to a fixed-point dst type)
+    static constexpr auto overflow_type  = overflow_type_;
+    static constexpr auto underflow_type = underflow_type_;
+    static constexpr auto exec_type      = exec_type_;
+
+    /*!
+     * @brief scale of the scores
+     */
+    static HVX_FORCE_INLINE auto Scale() noexcept -> float {
+        return (scaled != false) ? (1.0f / std::sqrt(static_cast<float>(dims))) : (1.0f);
+    }
+
+    /*!
+     * @brief iterations of a call if "pos" tokens are in the sequence: per token and head, the q/k/v vectors are read, the scores and the
+     * weighted sum of the values are computed over all keys of the token, and the dst vectors are written
+     */
+    static constexpr auto Lat(int64_t pos) noexcept -> int64_t {
+        int64_t lat = 0;
+        for (int64_t token = 0; token < tokens; ++token)
+            lat += heads * dim_vec_elms * (2 + 2 * hvx::util::Min(pos + token + 1, cache_len));
+        return lat;
+    }
+
+    // latency (the number of iterations grows with the sequence until the cache is full)
+    static constexpr auto lat_min = Lat(0);
+    static constexpr auto lat     = Lat(cache_len);
+
+    // constructor (verifies the dimensions and types)
+    constexpr AttentionParam() {
+        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, true, true, true, true, true>();
+        hvx::nn::impl::AttentionVerifyType<src_type, dst_type>();
+        static_assert(cache_len >= 1, "The KV-cache needs at least one token!");
+        static_assert(overflow_type != hvx::util::overflow_e::kClip, "The attention layer has no clip range, use kWrap or kSaturate!");
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief the state of an attention layer instance (the KV-cache of a sequence)
+ */
+template<typename param_>
+struct AttentionState : hvx::util::LayerArena<AttentionState<param_>> {
+    // keys and values of the last "cache_len" tokens of every head (ring buffer) [dont initialize]
+    hvx::util::array1d<typename param_::src_vec, param_::cache_elms> k_cache;
+    hvx::util::array1d<typename param_::src_vec, param_::cache_elms> v_cache;
+
+    // buffers the query, the scores and the weighted sum of the values of one token and head [dont initialize]
+    hvx::util::array1d<typename param_::src_vec, param_::dim_vec_elms> q_buf;
+    hvx::util::array1d<typename param_::buf_type, param_::cache_len> score_buf;
+    hvx::util::array1d<typename param_::buf_vec, param_::dim_vec_elms> acc_buf;
+
+    // number of tokens in the sequence
+    int64_t pos = 0;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+
+    /*!
+     * @brief starts a new sequence (the cached keys and values are not used anymore)
+     */
+    HVX_FORCE_INLINE auto Reset() noexcept -> void {
+        pos = 0;
+    }
+};
+
+/*!
+ * @brief next iteration of the attention layer: read (0), scores (1) and values (2) over all keys, write (3), then next head and token
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+AttentionScheduleNext(int64_t keys, int64_t& token, int64_t& head, int64_t& phase, int64_t& key, int64_t& dim_v) noexcept -> void {
+    HVX_INLINE_TOP();
+    const bool key_phase = (phase == 1) || (phase == 2);
+    if (dim_v < (param_::dim_vec_elms - 1)) {
+        ++dim_v;
+    } else if (key_phase && (key < (keys - 1))) {
+        dim_v = 0;
+        ++key;
+    } else if (phase < 3) {
+        dim_v = 0;
+        key   = 0;
+        ++phase;
+    } else if (head < (param_::heads - 1)) {
+        dim_v = 0;
+        key   = 0;
+        phase = 0;
+        ++head;
+    } else {
+        dim_v = 0;
+        key   = 0;
+        phase = 0;
+        head  = 0;
+        ++token;
+    }
+}
+
+/*!
+ * @brief top function of the attention layer (the state of the layer instance is passed by the caller)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+AttentionTop(hvx::nn::AttentionState<param_>& state,
+             typename param_::src_port* q,
+             typename param_::src_port* k,
+             typename param_::src_port* v,
+             typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // directives for buffers
+    HVX_DATAPACK(state.k_cache.data, state.v_cache.data, state.q_buf.data, state.acc_buf.data);
+
+    // the number of iterations depends on the tokens in the cache
+    const int64_t lat = param_::Lat(state.pos);
+
+    // iterates through the tokens and heads vector by vector (flattened loop)
+    int64_t ptr_q = 0, ptr_k = 0, ptr_v = 0, ptr_dst = 0;
+    int64_t token = 0, head = 0, phase = 0, key = 0, dim_v = 0;
+    typename param_::dot_type dot{};
+    typename param_::buf_type score{}, score_max{}, weight{}, weight_sum{};
+    for (int64_t i = 0; i < lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+        HVX_LOOP_TRIPCOUNT(param_::lat_min, param_::lat);
+
+        // buffer the src and dst vectors
+        typename param_::src_vec q_data{}, k_data{}, v_data{};
+        typename param_::dst_vec dst_data{};
+
+        // position of the token and its number of keys (causal mask, bounded by the cache)
+        const int64_t pos  = state.pos + token;
+        const int64_t keys = hvx::util::Min(pos + 1, param_::cache_len);
+
+        // conditions
+        const bool cond_read  = (phase == 0);
+        const bool cond_score = (phase == 1);
+        const bool cond_value = (phase == 2);
+        const bool cond_dst   = (phase == 3);
+        const bool first      = (key == 0);
+        const bool last       = (dim_v == (param_::dim_vec_elms - 1));
+
+        // key "key" of the token is at cache slot "pos - key" (the new key and value are written to slot "pos")
+        const int64_t slot      = (pos - key) % param_::cache_len;
+        const int64_t ptr_cache = ((head * param_::cache_len) + slot) * param_::dim_vec_elms + dim_v;
+
+        // read the next query, key and value vectors and append the key and value to the cache
+        hvx::util::StreamReadData<>(q, q_data, ptr_q, cond_read);
+        hvx::util::StreamReadData<>(k, k_data, ptr_k, cond_read);
+        hvx::util::StreamReadData<>(v, v_data, ptr_v, cond_read);
+        if (cond_read == true) {
+            state.q_buf.Set(q_data, dim_v);
+            state.k_cache.Set(k_data, ptr_cache);
+            state.v_cache.Set(v_data, ptr_cache);
+        }
+
+        // scores of all keys and their maximum
+        if (cond_score == true) {
+            hvx::nn::impl::AttentionScore<param_>((dim_v == 0), last, state.q_buf.Get(dim_v), state.k_cache.Get(ptr_cache), dot, score);
+            if (last == true) {
+                state.score_buf.Set(score, key);
+                score_max.data = (first == true) ? (score.data) : (hvx::util::Max(score_max.data, score.data));
+            }
+        }
+
+        // weighted sum of all values
+        if (cond_value == true) {
+            if (dim_v == 0)
+                hvx::nn::impl::AttentionWeight<param_>(first, state.score_buf.Get(key), score_max, weight, weight_sum);
+            hvx::nn::impl::AttentionValue<param_>(first, weight, state.v_cache.Get(ptr_cache), state.acc_buf.Get(dim_v));
+        }
+
+        // normalized result
+        if (cond_dst == true)
+            hvx::nn::impl::AttentionResult<param_>(state.acc_buf.Get(dim_v), weight_sum, dst_data);
+
+        // write next dst vector
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, cond_dst);
+
+        // next dim vector, key, phase, head and token
+        hvx::nn::AttentionScheduleNext<param_>(keys, token, head, phase, key, dim_v);
+    }
+    state.pos += param_::tokens;
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_q, ptr_dst);
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_k, ptr_dst);
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_v, ptr_dst);
+}
+
+/*!
+ * @brief top function of the attention layer (uses a single state for each parameter set, i.e. a single sequence)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+AttentionTop(typename param_::src_port* q,
+             typename param_::src_port* k,
+             typename param_::src_port* v,
+             typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::AttentionState<param_> state;
+    hvx::nn::AttentionTop<param_>(state, q, k, v, dst);
+}
+
+/******************************************************************************************************************************************/
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_ATTENTION_H_
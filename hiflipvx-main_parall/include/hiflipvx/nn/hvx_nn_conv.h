@@ -27,6 +27,8 @@
 
 #include "impl/hvx_nn_conv_dfixed.h"
 #include "impl/hvx_nn_conv_dfloat.h"
+#include "impl/hvx_nn_conv_gemm.h"
+#include "impl/hvx_nn_conv_winograd.h"
 
 namespace hvx {
 namespace nn {
@@ -53,8 +55,18 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          int64_t buf_bias_                      = false,                          // if bias should be buffered internally on first read
          hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
          hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
-         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         hvx::util::conv_e conv_type_           = hvx::util::conv_e::kDirect, // direct or Winograd (3x3, stride 1, pre-transformed wgts)
+         typename epilogue_                     = hvx::util::EpilogueParam<>, // applied on the result after the bias was added
+         hvx::util::sim_e sim_type_             = hvx::util::sim_e::kHw>      // implementation used during C-simulation
 struct ConvParam {
+    // convolution algorithm (Winograd computes "tile x tile" dst elements from a "tile_knl x tile_knl" window, see hvx_nn_conv_winograd.h)
+    static constexpr auto conv_type = conv_type_;
+    static constexpr auto tile      = static_cast<int64_t>(conv_type_);
+    static constexpr auto tile_knl  = (tile > 1) ? (knl_rows_v::elms + tile - 1) : knl_rows_v::elms;
+    using wgts_rows_v = std::conditional_t<(tile > 1), hvx::util::VectorParam<tile_knl, tile_knl>, knl_rows_v>;
+    using wgts_cols_v = std::conditional_t<(tile > 1), hvx::util::VectorParam<tile_knl, tile_knl>, knl_cols_v>;
+
     // destination rows/cols
     using dst_rows_v = decltype(hvx::util::WinDstVecParams<src_rows_v, knl_rows_v, pad_::rows, pad_::rows, dil_::rows, str_::rows>());
     using dst_cols_v = decltype(hvx::util::WinDstVecParams<src_cols_v, knl_cols_v, pad_::cols, pad_::cols, dil_::cols, str_::cols>());
@@ -62,7 +74,8 @@ struct ConvParam {
     // tensor parameters
     using src_dim  = hvx::util::TensorParam<4, chnls_v, src_cols_v, src_rows_v, batch_v>;
     using dst_dim  = hvx::util::TensorParam<4, fms_v, dst_cols_v, dst_rows_v, batch_v>;
-    using wgts_dim = hvx::util::TensorParam<4, knl_cols_v, knl_rows_v, chnls_v, fms_v>;
+    using wgts_dim = hvx::util::TensorParam<4, wgts_cols_v, wgts_rows_v, chnls_v, fms_v>; // transformed kernel for Winograd
+    using knl_dim  = hvx::util::TensorParam<4, knl_cols_v, knl_rows_v, chnls_v, fms_v>;   // kernel of the direct conv (see knl_vec)
     using bias_dim = hvx::util::TensorParam<1, fms_v>; // <3, fms_v, dst_cols_v, dst_rows_v>
 
     // dimensions
@@ -95,16 +108,23 @@ struct ConvParam {
     using dst_type  = dst_type_;
     using wgts_type = wgts_type_;
     using bias_type = bias_type_;
-    using comp_type = hvx::util::def_int_type_t<src_type, wgts_type_>;
+    using comp_type = std::conditional_t<hvx::util::is_dqbias_v<bias_type_>, hvx::util::dfixed<int32_t, 0>, // int32 if quantized per chnl
+                                         hvx::util::def_int_type_t<src_type, wgts_type_>>;
     using src_vec   = hvx::util::vector<src_type, src_dim::vec_size>;
     using dst_vec   = hvx::util::vector<dst_type, dst_dim::vec_size>;
     using wgts_vec  = hvx::util::vector<wgts_type, wgts_dim::vec_size>;
     using bias_vec  = hvx::util::vector<bias_type, bias_dim::vec_size>;
     using comp_vec  = hvx::util::vector<comp_type, fm_vec_size>;
+    using chnl_vec  = hvx::util::vector<src_type, chnl_vec_size>;
+    using wino_type = hvx::nn::impl::conv_winograd_type_t<src_type_>;
     using src_port  = src_vec;
     using dst_port  = dst_vec;
     using wgts_port = wgts_vec;
     using bias_port = bias_vec;
+    using knl_vec   = hvx::util::vector<wgts_type, knl_rows_v::elms * knl_cols_v::elms * chnls_v::vec_size * fms_v::vec_size>;
+
+    // the src is padded with its zero point (a real 0, it is only not 0 for a per-channel quantized layer)
+    static constexpr int64_t src_zero = hvx::util::DqbiasSrcZero<bias_type_>();
 
     // window (kernel) parameters
     static constexpr auto knl_rows          = knl_rows_v::elms;
@@ -112,8 +132,16 @@ struct ConvParam {
     static constexpr auto knl_cols          = knl_cols_v::elms;
     static constexpr auto knl_cols_vec_size = knl_cols_v::vec_size;
     static constexpr auto knl_elms          = knl_rows * knl_cols;
+    static constexpr auto knl_row_parts     = knl_rows / knl_rows_vec_size;
+    static constexpr auto knl_col_parts     = knl_cols / knl_cols_vec_size;
+    static constexpr auto knl_parts         = knl_row_parts * knl_col_parts;
+    static constexpr auto knl_part_elms     = knl_rows_vec_size * knl_cols_vec_size;
     static constexpr auto pad_rows          = pad_::rows;
     static constexpr auto pad_cols          = pad_::cols;
+    static constexpr auto pad_rows_up       = pad_::rows;
+    static constexpr auto pad_rows_down     = pad_::rows;
+    static constexpr auto pad_cols_left     = pad_::cols;
+    static constexpr auto pad_cols_right    = pad_::cols;
     static constexpr auto dil_rows          = dil_::rows;
     static constexpr auto dil_cols          = dil_::cols;
     static constexpr auto knl_dil_rows      = hvx::util::WinKnlDilLen<knl_rows_v::elms, dil_::rows>();
@@ -121,132 +149,509 @@ struct ConvParam {
     static constexpr auto knl_dil_elms      = knl_dil_rows * knl_dil_cols;
     static constexpr auto str_rows          = str_::rows;
     static constexpr auto str_cols          = str_::cols;
-
-    // buffer parameters
-    static constexpr auto row_buf_elms = src_cols * chnl_vec_elms;
-    static constexpr auto row_buf_num  = hvx::util::Max(knl_dil_rows - 1, static_cast<int64_t>(1));
+    static constexpr auto knl_vec_rows      = knl_rows + (dst_row_vec_size - 1) * str_rows;
+    static constexpr auto knl_vec_cols      = knl_cols + (dst_col_vec_size - 1) * str_cols;
+    static constexpr auto knl_win_rows = hvx::util::Win_knl_size<knl_dil_rows, src_row_vec_size, dst_row_vec_size, str_rows, pad_rows_up>();
+    static constexpr auto knl_win_cols =
+        hvx::util::Win_knl_size<knl_dil_cols, src_col_vec_size, dst_col_vec_size, str_cols, pad_cols_left>();
+    static constexpr auto knl_sel_rows = knl_dil_rows + (dst_row_vec_size - 1) * str_rows;
+    static constexpr auto knl_sel_cols = knl_dil_cols + (dst_col_vec_size - 1) * str_cols;
+    static constexpr auto knl_ovr_rows =
+        hvx::util::WinSelOffset<knl_dil_rows, knl_win_rows, src_row_vec_size, dst_row_vec_size, str_rows, pad_rows_up>();
+    static constexpr auto knl_ovr_cols =
+        hvx::util::WinSelOffset<knl_dil_cols, knl_win_cols, src_col_vec_size, dst_col_vec_size, str_cols, pad_cols_left>();
+
+    // iterations after the last src vector of a row/col until its last dst vector is computed
+    static constexpr auto win_ohd_rows =
+        hvx::util::WinOhdLen<knl_win_rows, src_row_vec_size, src_row_vec_elms, dst_row_vec_size, dst_row_vec_elms, str_rows, pad_rows>();
+    static constexpr auto win_ohd_cols =
+        hvx::util::WinOhdLen<knl_win_cols, src_col_vec_size, src_col_vec_elms, dst_col_vec_size, dst_col_vec_elms, str_cols, pad_cols>();
+
+    // buffer parameters (a row/col vectorized src also buffers the vectors of the overhead cols)
+    static constexpr auto row_buf_elms = hvx::util::Min(src_cols, src_col_vec_elms + win_ohd_cols) * chnl_vec_elms;
+    static constexpr auto row_buf_num  = hvx::util::Max((knl_win_rows / src_row_vec_size) - 1, static_cast<int64_t>(1));
     static constexpr auto win_buf_elms = chnl_vec_elms;
-    static constexpr auto win_buf_num  = hvx::util::Max(knl_dil_cols - 1, static_cast<int64_t>(1)) * knl_dil_rows;
+    static constexpr auto win_buf_num =
+        hvx::util::Max((knl_win_cols / src_col_vec_size) - 1, static_cast<int64_t>(1)) * (knl_win_rows / src_row_vec_size);
     static constexpr auto src_buf_elms = chnl_vec_elms;
     static constexpr auto src_buf_num  = 1;
-    static constexpr auto win_elms     = knl_elms;
-    static constexpr auto win_dil_elms = knl_dil_elms;
+    static constexpr auto win_elms     = knl_sel_rows * knl_sel_cols;
+    static constexpr auto win_dil_elms = knl_win_rows * knl_win_cols;
     static constexpr auto buffer_wgts  = buf_wgts_;
     static constexpr auto buffer_bias  = buf_bias_;
 
-    // summation parameters
-    static constexpr auto sum_global_elms = 1;
-    static constexpr auto sum_elms        = knl_elms * chnl_vec_size;
+    // summation parameters (one global sum per dst row/col of a dst vector, a partially vectorized kernel sums up one part per cycle)
+    static constexpr auto sum_global_elms = dst_row_vec_size * dst_col_vec_size;
+    static constexpr auto sum_elms        = knl_part_elms * chnl_vec_size;
+
+    // multipliers of the datapath (resource side of the trade-off against "lat", which grows with the number of kernel parts)
+    static constexpr auto mults = sum_elms * fm_vec_size * sum_global_elms;
+
+    // Winograd parameters (transform domain sums of one tile and dst rows of the tiles that are not written yet)
+    static constexpr auto wino_elms    = (tile > 1) ? (tile_knl * tile_knl) : 1;
+    static constexpr auto wino_buf_num = (tile > 1) ? (tile * dst_cols) : 1;
 
     // numerical stability
     static constexpr auto overflow_type  = overflow_type_;
     static constexpr auto underflow_type = underflow_type_;
     static constexpr auto exec_type      = exec_type_;
 
-    // latency
-    static constexpr auto ohd_rows  = pad_rows;
-    static constexpr auto ohd_cols  = pad_cols;
+    // implementation used during C-simulation (the GEMM fast path is bit exact with the hardware, ignored during synthesis)
+    static constexpr auto sim_type = sim_type_;
+
+    // fused epilogue (requantization and activation, no extra pass over the dst tensor is needed)
+    using epilogue = epilogue_;
+
+    // latency (the dst of Winograd is delayed by "tile - 1" rows/cols)
+    static constexpr auto ohd_rows  = (tile > 1) ? (pad_rows + tile - 1) : win_ohd_rows;
+    static constexpr auto ohd_cols  = (tile > 1) ? (pad_cols + tile - 1) : win_ohd_cols;
     static constexpr auto lat_rows  = src_row_vec_elms + ohd_rows;
     static constexpr auto lat_cols  = src_col_vec_elms + ohd_cols;
     static constexpr auto lat_chnls = chnl_vec_elms;
     static constexpr auto lat_fms   = fm_vec_elms;
-    static constexpr auto lat       = batch * lat_rows * lat_cols * lat_chnls * lat_fms;
+    static constexpr auto lat_knls  = knl_parts;
+    static constexpr auto lat_full  = batch * lat_rows * lat_cols * lat_chnls * lat_fms * lat_knls;
+
+    // iteration-skipping schedule of the direct conv (src positions without a dst only read their src vectors into the window, the
+    // kernel parts are only iterated at src positions that produce a dst)
+    static constexpr auto lat_wait_fms = (tile > 1) ? lat_fms : 1;
+    static constexpr auto lat_dst_pix  = batch * dst_row_vec_elms * dst_col_vec_elms;
+    static constexpr auto lat_src_pix  = batch * lat_rows * lat_cols;
+    static constexpr auto lat =
+        (tile > 1) ? lat_full : ((lat_dst_pix * lat_fms * lat_knls + (lat_src_pix - lat_dst_pix) * lat_wait_fms) * lat_chnls);
+
+    // parameters for a single sample of the batch
+    using sample_param =
+        ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, hvx::util::VectorParam<1, 1>, src_rows_v, src_cols_v, chnls_v, fms_v,
+                  knl_rows_v, knl_cols_v, pad_, dil_, str_, buf_wgts_, buf_bias_, overflow_type_, underflow_type_, exec_type_, conv_type_,
+                  epilogue_, sim_type_>;
+
+    // parameters for a band of "band_rows_" dst rows of a single sample (the src band already contains its halo and padding rows)
+    template<int64_t band_rows_>
+    using band_param =
+        ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, hvx::util::VectorParam<1, 1>,
+                  hvx::util::VectorParam<(band_rows_ - 1) * str_::rows + knl_dil_rows, 1>, src_cols_v, chnls_v, fms_v, knl_rows_v,
+                  knl_cols_v, hvx::util::Array2dParam<0, pad_::cols>, dil_, str_, buf_wgts_, buf_bias_, overflow_type_, underflow_type_,
+                  exec_type_, conv_type_, epilogue_, sim_type_>;
+
+    // parameters of the window buffers (Winograd uses the window of a direct conv with a "tile_knl x tile_knl" kernel)
+    using win_param = std::conditional_t<
+        (tile > 1),
+        ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, src_rows_v, src_cols_v, chnls_v, fms_v,
+                  hvx::util::VectorParam<tile_knl, tile_knl>, hvx::util::VectorParam<tile_knl, tile_knl>, pad_,
+                  hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buf_wgts_, buf_bias_, overflow_type_, underflow_type_,
+                  exec_type_>,
+        ConvParam>;
 
     // constructor (verifies the dimensions and types)
     constexpr ConvParam() {
-        // TODO: implement the possibility that the kernel does not have to be vectorized
-        static_assert(knl_rows == knl_rows_vec_size, "Knl rows are not fully vectorized!");
-        static_assert(knl_cols == knl_cols_vec_size, "Knl cols are not fully vectorized!");
-        // TODO: also implement a vectorization for the row and col dimension
-        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, true, true, true, true, true>();
-        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, true, true, true, true, true>();
+        // the kernel can be partially vectorized, its parts are then computed one after another
+        static_assert((knl_rows % knl_rows_vec_size) == 0, "Knl rows are no multiple of the knl row vector size!");
+        static_assert((knl_cols % knl_cols_vec_size) == 0, "Knl cols are no multiple of the knl col vector size!");
+        // the rows/cols can be vectorized, a src vector then has to contain a whole number of strides
+        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, false, false, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, false, false, true, true, true>();
+        static_assert((src_row_vec_size == 1) || ((src_row_vec_size % str_rows) == 0), "Src row vector size is no multiple of stride!");
+        static_assert((src_col_vec_size == 1) || ((src_col_vec_size % str_cols) == 0), "Src col vector size is no multiple of stride!");
+        static_assert((knl_ovr_rows >= 0) && ((knl_ovr_rows + knl_sel_rows) <= knl_win_rows), "Window rows invalid!");
+        static_assert((knl_ovr_cols >= 0) && ((knl_ovr_cols + knl_sel_cols) <= knl_win_cols), "Window cols invalid!");
         //
         hvx::util::TensorVerifySameDims<src_dim, dst_dim, 4, false, false, false, true, true, true>();
         hvx::util::BiasVerifyDim<bias_dim, dst_rows, dst_cols, fms, fm_vec_size>();
         hvx::util::WinVerifyDim<src_rows, src_cols, knl_rows, knl_cols, pad_rows, pad_cols, dil_rows, dil_cols>();
         hvx::nn::impl::ConvVerifyType<src_type, wgts_type, bias_type, dst_type>();
+        hvx::nn::impl::ConvWinogradVerify<ConvParam>();
+        static_assert((sim_type_ == hvx::util::sim_e::kHw) || (tile == 1), "The GEMM fast path only supports the direct conv!");
     }
 };
 
 /******************************************************************************************************************************************/
 
 /*!
- * @brief applies conv function on an src vector
+ * @brief applies conv function on an src vector (the window stores the newest element first, so the first dst row/col of a row/col
+ * vectorized dst vector uses the window elements that are the farthest away). A partially vectorized kernel only uses the window
+ * elements of the kernel part "knl_v", the partial sums of all parts and src chnls are accumulated in the global sum.
  */
 template<typename param_>
 HVX_FORCE_INLINE constexpr auto
 ConvComp(int64_t chnl_v,
+         int64_t knl_v,
          hvx::util::array1d<typename param_::comp_vec, param_::sum_global_elms>& sum_global_vec,
-         hvx::util::array1d<typename param_::src_vec, param_::knl_elms>& win,
+         hvx::util::array1d<typename param_::chnl_vec, param_::win_elms>& win,
          typename param_::wgts_vec& wgts_data,
          typename param_::bias_vec& bias_data,
          typename param_::dst_vec& dst_data) noexcept -> void {
     HVX_INLINE_TOP();
-    for (int64_t fm_p = 0; fm_p < param_::fm_vec_size; ++fm_p) {
+
+    // first window row/col of the kernel part (the parts are stored in the weights in kernel order, the window in reversed order)
+    const int64_t knl_row_beg = param_::knl_rows - (knl_v / param_::knl_col_parts + 1) * param_::knl_rows_vec_size;
+    const int64_t knl_col_beg = param_::knl_cols - (knl_v % param_::knl_col_parts + 1) * param_::knl_cols_vec_size;
+    const int64_t sum_v       = knl_v * param_::chnl_vec_elms + chnl_v;
+
+    for (int64_t row_p = 0; row_p < param_::dst_row_vec_size; ++row_p) {
         HVX_UNROLL();
+        for (int64_t col_p = 0; col_p < param_::dst_col_vec_size; ++col_p) {
+            HVX_UNROLL();
+            const int64_t pix_p   = row_p * param_::dst_col_vec_size + col_p;
+            const int64_t win_ofs = (param_::dst_row_vec_size - 1 - row_p) * param_::str_rows * param_::knl_sel_cols +
+                                    (param_::dst_col_vec_size - 1 - col_p) * param_::str_cols;
+            for (int64_t fm_p = 0; fm_p < param_::fm_vec_size; ++fm_p) {
+                HVX_UNROLL();
+
+                // buffers needed win and wgts to comp one dst element
+                hvx::util::vector<typename param_::wgts_type, param_::sum_elms> wgts_tmp{};
+                hvx::util::vector<typename param_::src_type, param_::sum_elms> win_tmp{};
+
+                // get needed win (skips the dilated elements) and wgts
+                for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+                    for (int64_t part_row = 0; part_row < param_::knl_rows_vec_size; ++part_row) {
+                        for (int64_t part_col = 0; part_col < param_::knl_cols_vec_size; ++part_col) {
+                            const int64_t knl_pix    = part_row * param_::knl_cols_vec_size + part_col;
+                            const int64_t knl_row    = knl_row_beg + part_row;
+                            const int64_t knl_col    = knl_col_beg + part_col;
+                            const int64_t win_pix    =
+                                win_ofs + knl_row * (param_::dil_rows + 1) * param_::knl_sel_cols + knl_col * (param_::dil_cols + 1);
+                            const int64_t ptr_fm_p   = fm_p * param_::sum_elms;
+                            const int64_t ptr_chnl_p = chnl_p * param_::knl_part_elms;
+                            wgts_tmp.Set(wgts_data.Get(ptr_fm_p + ptr_chnl_p + knl_pix), ptr_chnl_p + knl_pix);
+                            win_tmp.Set(win.Get(win_pix).Get(chnl_p), ptr_chnl_p + knl_pix);
+                        }
+                    }
+                }
+
+                // applies conv function on a single element
+                hvx::nn::impl::ConvComp<param_>(sum_v, sum_global_vec.Get(pix_p).Get(fm_p), win_tmp, wgts_tmp, bias_data.Get(fm_p),
+                                                dst_data.Get(pix_p * param_::fm_vec_size + fm_p));
+            }
+        }
+    }
+}
+
+/*!
+ * @brief the state of a conv layer instance (buffered weights/bias, line buffers and window)
+ */
+template<typename param_>
+struct ConvState : hvx::util::LayerArena<ConvState<param_>> {
+    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
+    hvx::util::array1d<typename param_::wgts_vec, param_::wgts_vec_elms> wgts_buf;
+    hvx::util::array1d<typename param_::bias_vec, param_::bias_vec_elms> bias_buf;
+    bool wgts_buffered = false, bias_buffered = false;
+
+    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
+    hvx::util::array2d<typename param_::src_vec, param_::win_param::row_buf_elms, param_::win_param::row_buf_num> row_buf;
+    hvx::util::array2d<typename param_::src_vec, param_::win_param::win_buf_elms, param_::win_param::win_buf_num> win_buf;
+    hvx::util::array2d<typename param_::src_vec, param_::win_param::src_buf_elms, param_::win_param::src_buf_num> src_buf;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_param::win_elms> win;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_param::win_dil_elms> win_dil;
+
+    // buffers the global sum for one dst vector [dont initialize]
+    hvx::util::array1d<typename param_::comp_vec, param_::sum_global_elms> sum_global;
+
+    // Winograd: transform domain sums of one tile and the computed dst tiles until they are written [dont initialize]
+    hvx::util::array2d<typename param_::wino_type, param_::wino_elms, param_::fm_vec_size> wino_sum;
+    hvx::util::array2d<typename param_::dst_vec, param_::fm_vec_elms, param_::wino_buf_num> wino_buf;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+
+    /*!
+     * @brief weights and bias are read again on the next execution
+     */
+    HVX_FORCE_INLINE auto Reset() noexcept -> void {
+        wgts_buffered = false;
+        bias_buffered = false;
+    }
+};
+
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+/*!
+ * @brief C-simulation fast path of the conv layer (im2col + GEMM), bit exact with ConvTop. Returns false if it is not available for the data
+ * types, for row/col vectorized tensors, for partially vectorized kernels or if src/dst is a channel, then nothing is read or written.
+ */
+template<typename param_, bool with_bias_ = false>
+auto
+ConvGemmTop(hvx::nn::ConvState<param_>& state,
+            typename param_::src_port* src,
+            typename param_::wgts_vec* wgts,
+            typename param_::bias_vec* bias,
+            typename param_::dst_port* dst) -> bool {
+    if ((hvx::sim::ChannelFromPort(src) != nullptr) || (hvx::sim::ChannelFromPort(dst) != nullptr))
+        return false;
+    if ((param_::src_row_vec_size > 1) || (param_::src_col_vec_size > 1) || (param_::knl_parts > 1))
+        return false;
+
+    // weights and bias are buffered like in ConvTop (the buffer is used from the second dst pixel on)
+    constexpr bool buffered = (param_::dst_rows * param_::dst_cols * param_::batch) > 1;
+    const auto* wgts_ptr    = (param_::buffer_wgts && state.wgts_buffered) ? state.wgts_buf.data : wgts;
+    const auto* bias_ptr    = (param_::buffer_bias && state.bias_buffered) ? state.bias_buf.data : bias;
+    if (!hvx::nn::impl::ConvGemm<param_, with_bias_>(src, wgts_ptr, bias_ptr, dst))
+        return false;
+    if (param_::buffer_wgts && !state.wgts_buffered && buffered) {
+        std::copy(wgts, wgts + param_::wgts_vec_elms, state.wgts_buf.data); // NOLINT
+        state.wgts_buffered = true;
+    }
+    if (param_::buffer_bias && with_bias_ && !state.bias_buffered && buffered) {
+        std::copy(bias, bias + param_::bias_vec_elms, state.bias_buf.data); // NOLINT
+        state.bias_buffered = true;
+    }
+    return true;
+}
 
-        // buffers needed win and wgts to comp one dst element
-        hvx::util::vector<typename param_::wgts_type, param_::sum_elms> wgts_tmp{};
-        hvx::util::vector<typename param_::src_type, param_::sum_elms> win_tmp{};
-
-        // get needed win and wgts
-        for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
-            for (int64_t knl_pix = 0; knl_pix < param_::knl_elms; ++knl_pix) {
-                const int64_t ptr_fm_p   = fm_p * param_::sum_elms;
-                const int64_t ptr_chnl_p = chnl_p * param_::knl_elms;
-                wgts_tmp.Set(wgts_data.Get(ptr_fm_p + ptr_chnl_p + knl_pix), ptr_chnl_p + knl_pix);
-                win_tmp.Set(win.Get(knl_pix).Get(chnl_p), ptr_chnl_p + knl_pix);
+/*!
+ * @brief C-simulation implementation selected by "sim_type" of the layer. Returns false if the hardware implementation has to be used.
+ */
+template<typename param_, bool with_bias_, std::enable_if_t<(param_::sim_type == hvx::util::sim_e::kGemm), bool> = true>
+auto
+ConvSimTop(hvx::nn::ConvState<param_>& state,
+           typename param_::src_port* src,
+           typename param_::wgts_vec* wgts,
+           typename param_::bias_vec* bias,
+           typename param_::dst_port* dst) -> bool {
+    return hvx::nn::ConvGemmTop<param_, with_bias_>(state, src, wgts, bias, dst);
+}
+template<typename param_, bool with_bias_, std::enable_if_t<(param_::sim_type == hvx::util::sim_e::kHw), bool> = true>
+HVX_FORCE_INLINE constexpr auto
+ConvSimTop(hvx::nn::ConvState<param_>& /*state*/,
+           typename param_::src_port* /*src*/,
+           typename param_::wgts_vec* /*wgts*/,
+           typename param_::bias_vec* /*bias*/,
+           typename param_::dst_port* /*dst*/) noexcept -> bool {
+    return false;
+}
+#endif
+
+/*!
+ * @brief transforms the weights of a direct conv ("knl_vec" in the layout of "wgts_vec" of the direct mode) for the Winograd mode at load
+ * time (U = G g G^T, computed in double and rounded to the wgts type). The kernel can have a different (narrower) type than the
+ * transformed weights.
+ */
+template<typename param_, typename knl_vec_ = typename param_::knl_vec>
+auto
+ConvWinogradWeights(const knl_vec_* src, typename param_::wgts_vec* dst) noexcept -> void {
+    static_assert(param_::tile > 1, "The weights only need to be transformed for the Winograd mode!");
+    static_assert(std::extent<decltype(knl_vec_::data)>::value == std::extent<decltype(param_::knl_vec::data)>::value,
+                  "The kernel vector does not match the layout of the direct conv!");
+    constexpr int64_t knl   = param_::knl_rows;
+    constexpr int64_t wino  = param_::tile_knl;
+    constexpr int64_t chnls = param_::chnl_vec_size;
+    for (int64_t i = 0; i < param_::wgts_vec_elms; ++i) {
+        for (int64_t fm_p = 0; fm_p < param_::fm_vec_size; ++fm_p) {
+            for (int64_t chnl_p = 0; chnl_p < chnls; ++chnl_p) {
+                const int64_t src_ptr = (fm_p * chnls + chnl_p) * param_::knl_elms;
+                const int64_t dst_ptr = (fm_p * chnls + chnl_p) * param_::wino_elms;
+
+                // G g G^T
+                double tmp[wino][knl] = {}; // NOLINT
+                for (int64_t row = 0; row < wino; ++row) {
+                    for (int64_t col = 0; col < knl; ++col) {
+                        for (int64_t k = 0; k < knl; ++k) {
+                            auto wgt = src[i].data[src_ptr + k * knl + col]; // NOLINT
+                            tmp[row][col] += hvx::nn::impl::WinogradG<param_::tile>(row, k) * static_cast<double>(static_cast<float>(wgt));
+                        }
+                    }
+                }
+                for (int64_t row = 0; row < wino; ++row) {
+                    for (int64_t col = 0; col < wino; ++col) {
+                        double sum = 0.0;
+                        for (int64_t k = 0; k < knl; ++k)
+                            sum += tmp[row][k] * hvx::nn::impl::WinogradG<param_::tile>(col, k); // NOLINT
+                        const auto wgt                          = hvx::nn::impl::ConvWinogradRound<typename param_::wgts_type>(sum);
+                        dst[i].data[dst_ptr + row * wino + col] = wgt; // NOLINT
+                    }
+                }
             }
         }
+    }
+}
 
-        // applies conv function on a single element
-        hvx::nn::impl::ConvComp<param_>(chnl_v, sum_global_vec.Get(0).Get(fm_p), win_tmp, wgts_tmp, bias_data.Get(fm_p),
-                                        dst_data.Get(fm_p));
+/*!
+ * @brief upper bound of the difference between the Winograd mode and the direct conv with the untransformed weights for one dst element
+ * ("src_max" and "wgts_max" are the largest absolute src and kernel values, see hvx_nn_conv_winograd.h)
+ */
+template<typename param_>
+constexpr auto
+ConvWinogradErrorBound(double src_max, double wgts_max) noexcept -> double {
+    static_assert(param_::tile > 1, "The error bound only exists for the Winograd mode!");
+    using gain             = hvx::nn::impl::WinogradGain<param_::tile>;
+    constexpr auto one     = static_cast<int64_t>(1);
+    constexpr double chnls = static_cast<double>(param_::chnls);
+
+    // fixed-point: rounding of U, right shift of the products and rounding of both results to the dst type
+    if (std::is_integral<typename param_::wino_type>::value) {
+        constexpr int64_t shift     = hvx::nn::impl::WinogradShiftBits<param_>();
+        constexpr int64_t prod_frac = param_::src_type::frac_bits + param_::wgts_type::frac_bits - shift;
+        constexpr double wgts_err   = 1.0 / static_cast<double>(one << (param_::wgts_type::frac_bits + 1));
+        constexpr double prod_err   = 1.0 / static_cast<double>(one << prod_frac);
+        constexpr double dst_lsb    = 1.0 / static_cast<double>(one << param_::dst_type::frac_bits);
+        return chnls * gain::gain_a * (gain::gain_v * src_max * wgts_err + prod_err) + dst_lsb;
     }
+
+    // floating-point: every operation adds a relative error of 2^-24 (Winograd: transforms, products and sum over the src chnls, direct
+    // conv: sum over the kernel and the src chnls) and both results are converted to int48 with 32 fraction bits (see ConvAddBias)
+    constexpr double eps     = 1.0 / static_cast<double>(one << 24);
+    constexpr double knl     = static_cast<double>(param_::tile_knl);
+    constexpr double int_lsb = static_cast<double>(param_::chnl_vec_elms + 1) / static_cast<double>(one << 32);
+    const double wino_sum    = chnls * gain::gain_a * gain::gain_v * gain::gain_u * src_max * wgts_max;
+    const double direct_sum  = chnls * 9.0 * src_max * wgts_max;
+    return eps * ((4.0 * knl + chnls + 2.0) * wino_sum + (9.0 * chnls + 1.0) * direct_sum) + 2.0 * int_lsb;
 }
 
 /*!
- * @brief top function of the conv layer
+ * @brief advances the loop counters of the iteration-skipping schedule (src positions without a dst only iterate over the src chnls,
+ * src positions with a dst iterate over the src chnls of every kernel part for every dst fm)
  */
-template<typename param_, bool with_bias_ = false>
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+ConvScheduleNext(bool cond_dst, int64_t& src_row, int64_t& src_col, int64_t& fm_v, int64_t& knl_v, int64_t& chnl_v) noexcept -> void {
+    HVX_INLINE_TOP();
+    const int64_t fm_elms  = (cond_dst == true) ? (param_::lat_fms) : (param_::lat_wait_fms);
+    const int64_t knl_elms = (cond_dst == true) ? (param_::lat_knls) : (1);
+    const bool last_chnl   = (chnl_v == (param_::lat_chnls - 1));
+    const bool last_knl    = last_chnl && (knl_v == (knl_elms - 1));
+    const bool last_fm     = last_knl && (fm_v == (fm_elms - 1));
+    const bool last_col    = last_fm && (src_col == (param_::lat_cols - 1));
+    const bool last_row    = last_col && (src_row == (param_::lat_rows - 1));
+    chnl_v                 = (last_chnl == true) ? (0) : (chnl_v + 1);
+    knl_v                  = (last_knl == true) ? (0) : ((last_chnl == true) ? (knl_v + 1) : (knl_v));
+    fm_v                   = (last_fm == true) ? (0) : ((last_knl == true) ? (fm_v + 1) : (fm_v));
+    src_col                = (last_col == true) ? (0) : ((last_fm == true) ? (src_col + 1) : (src_col));
+    src_row                = (last_row == true) ? (0) : ((last_col == true) ? (src_row + 1) : (src_row));
+}
+
+/*!
+ * @brief top function of the conv layer (the state of the layer instance is passed by the caller)
+ */
+template<typename param_, bool with_bias_ = false, std::enable_if_t<(param_::tile == 1), bool> = true>
 HVX_FORCE_INLINE auto
-ConvTop(typename param_::src_port* src,
+ConvTop(hvx::nn::ConvState<param_>& state,
+        typename param_::src_port* src,
         typename param_::wgts_vec* wgts,
         typename param_::bias_vec* bias,
         typename param_::dst_port* dst) noexcept -> void {
     HVX_INLINE_TOP();
+    static_assert(with_bias_ || !hvx::util::is_dqbias_v<typename param_::bias_type>,
+                  "A per-channel quantized layer reads its requantization from the bias port!");
 
-    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
-    static hvx::util::array1d<typename param_::wgts_vec, param_::wgts_vec_elms> wgts_buf;
-    static hvx::util::array1d<typename param_::bias_vec, param_::bias_vec_elms> bias_buf;
-    static bool wgts_buffered_ = false, bias_buffered_ = false;
+    // directives for buffers and windows
+    HVX_DATAPACK(state.bias_buf.data, state.row_buf.data, state.win_buf.data, state.src_buf.data, state.win.data,
+                 state.win_dil.data); // wgts_buf.data,
+    HVX_ARRAY_PARTITION_COMPLETE(state.row_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.src_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_dil.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.sum_global.data, 0);
+
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+    // C-simulation fast path for tensors in memory (if selected for the layer)
+    if (hvx::nn::ConvSimTop<param_, with_bias_>(state, src, wgts, bias, dst))
+        return;
+#endif
+
+    // the value of a padded src element
+    typename param_::src_type src_pad{};
+    src_pad.data = static_cast<typename param_::src_type::data_type>(param_::src_zero);
+
+    // iterates through the tensor vector by vector (flattened loop, the dst fms and kernel parts are only iterated at src positions that
+    // produce a dst)
+    int64_t ptr_src = 0, ptr_dst = 0;
+    int64_t src_row = 0, src_col = 0, fm_v = 0, knl_v = 0, chnl_v = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+        // HVX_PRAGMA(HLS dependence variable = sum_global type = inter distance = param_::sum_global_elms true)
 
-    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
-    static hvx::util::array2d<typename param_::src_vec, param_::row_buf_elms, param_::row_buf_num> row_buf;
-    static hvx::util::array2d<typename param_::src_vec, param_::win_buf_elms, param_::win_buf_num> win_buf;
-    static hvx::util::array2d<typename param_::src_vec, param_::src_buf_elms, param_::src_buf_num> src_buf;
-    static hvx::util::array1d<typename param_::src_vec, param_::win_elms> win;
-    static hvx::util::array1d<typename param_::src_vec, param_::win_dil_elms> win_dil;
+        // HVX_PRAGMA(HLS dependence variable = sum_global type = inter direction = WAW|WAR distance = 3 true);
 
-    // buffers the global sum for one dst vector [dont initialize]
-    static hvx::util::array1d<typename param_::comp_vec, param_::sum_global_elms> sum_global;
+        // buffer the src, dst, wgts and bias vectors
+        typename param_::src_vec src_data{};
+        typename param_::dst_vec dst_data{};
+        typename param_::wgts_vec wgts_data{};
+        typename param_::bias_vec bias_data{};
+
+        // comp conditions for src and dst (TODO: delete template parameters except param_)
+        const auto cond =
+            hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::src_row_vec_size,
+                                   param_::src_col_vec_size, param_::dst_row_vec_size, param_::dst_col_vec_size, param_::knl_win_rows,
+                                   param_::knl_win_cols, param_::knl_rows, param_::knl_cols, param_::pad_rows_up, param_::pad_rows_down,
+                                   param_::pad_cols_left, param_::pad_cols_right, param_::str_cols, param_::str_rows, param_::dil_rows,
+                                   param_::dil_cols>(src_col, src_row);
+        const bool cond_dst  = (cond.dst_row && cond.dst_col);
+        const bool cond_chnl = (fm_v == 0) && (knl_v == 0);
+        const bool cond_fm   = (chnl_v == (param_::chnl_vec_elms - 1)) && (knl_v == (param_::knl_parts - 1));
+        const bool cond_wgts = cond_dst;
+        const bool cond_bias = (with_bias_ && cond_dst && cond_fm);
+
+        // the kernel parts are handled like additional dst fms by the window and like additional src chnls by the weights
+        const int64_t win_fm_v    = fm_v * param_::knl_parts + knl_v;
+        const int64_t wgts_chnl_v = chnl_v * param_::knl_parts + knl_v;
+
+        // read next src vector
+        hvx::util::StreamReadData<>(src, src_data, ptr_src, (cond.src_row && cond.src_col && cond_chnl));
+
+        // updates the window and its buffers (TODO: delete template parameters except param_)
+        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::ohd_cols, param_::knl_rows, param_::knl_cols,
+                             param_::dil_rows, param_::dil_cols, param_::str_rows, param_::str_cols, param_::knl_sel_rows,
+                             param_::knl_sel_cols, param_::knl_win_rows, param_::knl_win_cols, param_::knl_vec_rows, param_::knl_vec_cols,
+                             param_::knl_ovr_rows, param_::knl_ovr_cols, param_::dst_row_vec_size, param_::dst_col_vec_size,
+                             param_::fm_vec_elms * param_::knl_parts>(src_row, src_col, chnl_v, win_fm_v, src_data, state.row_buf,
+                                                                      state.src_buf, state.win_buf, state.win_dil, state.win, !cond_dst,
+                                                                      src_pad);
+
+        // read weights src vector (TODO: delete template parameters except param_)
+        hvx::util::WeightsUpdate<typename param_::wgts_type, param_::wgts_vec_size, param_::chnl_vec_elms * param_::knl_parts,
+                                 param_::fm_vec_elms, param_::buffer_wgts>(wgts_chnl_v, fm_v, ptr_dst, state.wgts_buffered, cond_wgts, wgts,
+                                                                           state.wgts_buf, wgts_data);
+
+        // read bias src vector (TODO: delete template parameters except param_)
+        hvx::util::BiasUpdate<typename param_::bias_type, param_::fm_vec_size, param_::bias_vec_elms, param_::buffer_bias>(
+            ptr_dst, state.bias_buffered, cond_bias, bias, state.bias_buf, bias_data);
+
+        // applies conv function on an src vector (only at src positions that produce a dst)
+        if (cond_dst == true)
+            hvx::nn::ConvComp<param_>(chnl_v, knl_v, state.sum_global, state.win, wgts_data, bias_data, dst_data);
+
+        // write next dst vector
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, (cond_dst && cond_fm));
+
+        // next src chnl, kernel part, dst fm and src position
+        hvx::nn::ConvScheduleNext<param_>(cond_dst, src_row, src_col, fm_v, knl_v, chnl_v);
+    }
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
+}
+
+/*!
+ * @brief top function of the conv layer in Winograd mode (the state of the layer instance is passed by the caller). The window of a
+ * "tile_knl x tile_knl" kernel is used to compute a "tile x tile" dst tile at once, the tiles are buffered until their dst vectors are
+ * written in the same order as by the direct conv. The weights need to be transformed by ConvWinogradWeights.
+ */
+template<typename param_, bool with_bias_ = false, std::enable_if_t<(param_::tile > 1), bool> = true>
+HVX_FORCE_INLINE auto
+ConvTop(hvx::nn::ConvState<param_>& state,
+        typename param_::src_port* src,
+        typename param_::wgts_vec* wgts,
+        typename param_::bias_vec* bias,
+        typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    using win_param = typename param_::win_param;
 
     // directives for buffers and windows
-    HVX_DATAPACK(bias_buf.data, row_buf.data, win_buf.data, src_buf.data, win.data, win_dil.data); // wgts_buf.data,
-    HVX_ARRAY_PARTITION_COMPLETE(row_buf.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_buf.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(src_buf.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_dil.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(sum_global.data, 0);
+    HVX_DATAPACK(state.bias_buf.data, state.row_buf.data, state.win_buf.data, state.src_buf.data, state.win.data, state.win_dil.data,
+                 state.wino_buf.data);
+    HVX_ARRAY_PARTITION_COMPLETE(state.row_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.src_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_dil.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.wino_sum.data, 0);
+    HVX_ARRAY_PARTITION_COMPLETE(state.wino_buf.data, 1);
+
+    // first dst row/col of the window (the same as for the direct conv)
+    constexpr int64_t tile_beg = param_::tile_knl - 1 - param_::pad_rows;
 
     // iterates through the tensor vector by vector
     int64_t ptr_src = 0, ptr_dst = 0;
     for (int64_t i = 0; i < param_::lat; ++i) {
         HVX_PIPELINE_ON(1, frp);
-        // HVX_PRAGMA(HLS dependence variable = sum_global type = inter distance = param_::sum_global_elms true)
-
-        // HVX_PRAGMA(HLS dependence variable = sum_global type = inter direction = WAW|WAR distance = 3 true);
 
         // buffer the src, dst, wgts and bias vectors
         typename param_::src_vec src_data{};
@@ -254,46 +659,81 @@ ConvTop(typename param_::src_port* src,
         typename param_::wgts_vec wgts_data{};
         typename param_::bias_vec bias_data{};
 
-        // flattening loop to improve latency (TODO: loop inefficient for stride >= 2)
+        // flattening loop to improve latency
         const int64_t src_row = (i / (param_::lat_chnls * param_::lat_fms * param_::lat_cols)) % (param_::lat_rows);
         const int64_t src_col = (i / (param_::lat_chnls * param_::lat_fms)) % (param_::lat_cols);
         const int64_t fm_v    = (i / (param_::lat_chnls)) % (param_::lat_fms);
         const int64_t chnl_v  = (i % (param_::lat_chnls));
 
-        // comp conditions for src and dst (TODO: delete template parameters except param_)
-        const auto cond = hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::knl_rows,
-                                                 param_::knl_cols, param_::pad_rows, param_::pad_rows, param_::pad_cols, param_::pad_cols,
-                                                 param_::str_cols, param_::str_rows, param_::dil_rows, param_::dil_cols>(src_col, src_row);
+        // comp conditions for src and dst (the dst is written "tile - 1" rows/cols later than by the direct conv)
+        const auto cond_src =
+            hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::src_row_vec_size,
+                                   param_::src_col_vec_size, param_::dst_row_vec_size, param_::dst_col_vec_size, param_::knl_win_rows,
+                                   param_::knl_win_cols, param_::knl_rows, param_::knl_cols, param_::pad_rows_up, param_::pad_rows_down,
+                                   param_::pad_cols_left, param_::pad_cols_right, param_::str_cols, param_::str_rows, param_::dil_rows,
+                                   param_::dil_cols>(src_col, src_row);
+        const auto cond_dst =
+            hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::src_row_vec_size,
+                                   param_::src_col_vec_size, param_::dst_row_vec_size, param_::dst_col_vec_size, param_::knl_win_rows,
+                                   param_::knl_win_cols, param_::knl_rows, param_::knl_cols, param_::pad_rows_up, param_::pad_rows_down,
+                                   param_::pad_cols_left, param_::pad_cols_right, param_::str_cols, param_::str_rows, param_::dil_rows,
+                                   param_::dil_cols>(src_col - (param_::tile - 1), src_row - (param_::tile - 1));
+
+        // a tile is computed if the window of the "tile_knl x tile_knl" kernel starts at a multiple of the tile size
+        const int64_t tile_row = src_row - tile_beg;
+        const int64_t tile_col = src_col - tile_beg;
+        const bool cond_tile   = (tile_row >= 0) && (tile_row < param_::dst_rows) && ((tile_row % param_::tile) == 0) && (tile_col >= 0) &&
+                               (tile_col < param_::dst_cols) && ((tile_col % param_::tile) == 0);
         const bool cond_chnl = (fm_v == 0);
         const bool cond_fm   = (chnl_v == (param_::chnl_vec_elms - 1));
-        const bool cond_wgts = (cond.dst_row && cond.dst_col);
-        const bool cond_bias = (with_bias_ && cond.dst_row && cond.dst_col && cond_fm);
+        const bool cond_bias = (with_bias_ && cond_tile && cond_fm);
+        const bool cond_dst_write = (cond_dst.dst_row && cond_dst.dst_col && cond_fm);
 
         // read next src vector
-        hvx::util::StreamReadData<>(src, src_data, ptr_src, (cond.src_row && cond.src_col && cond_chnl));
+        hvx::util::StreamReadData<>(src, src_data, ptr_src, (cond_src.src_row && cond_src.src_col && cond_chnl));
 
-        // updates the window and its buffers (TODO: delete template parameters except param_)
-        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::knl_rows, param_::knl_cols, param_::dil_rows,
-                             param_::dil_cols, param_::fm_vec_elms>(src_row, src_col, chnl_v, fm_v, src_data, row_buf, src_buf, win_buf,
-                                                                    win_dil, win);
+        // updates the window and its buffers
+        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, win_param::ohd_cols, win_param::knl_rows,
+                             win_param::knl_cols, win_param::dil_rows, win_param::dil_cols, win_param::str_rows, win_param::str_cols,
+                             win_param::knl_sel_rows, win_param::knl_sel_cols, win_param::knl_win_rows, win_param::knl_win_cols,
+                             win_param::knl_vec_rows, win_param::knl_vec_cols, win_param::knl_ovr_rows, win_param::knl_ovr_cols,
+                             win_param::dst_row_vec_size, win_param::dst_col_vec_size, param_::fm_vec_elms>(
+            src_row, src_col, chnl_v, fm_v, src_data, state.row_buf, state.src_buf, state.win_buf, state.win_dil, state.win);
 
-        // read weights src vector (TODO: delete template parameters except param_)
+        // read transformed weights and bias src vector once per tile
         hvx::util::WeightsUpdate<typename param_::wgts_type, param_::wgts_vec_size, param_::chnl_vec_elms, param_::fm_vec_elms,
-                                 param_::buffer_wgts>(chnl_v, fm_v, ptr_dst, wgts_buffered_, cond_wgts, wgts, wgts_buf, wgts_data);
-
-        // read bias src vector (TODO: delete template parameters except param_)
+                                 param_::buffer_wgts>(chnl_v, fm_v, ptr_dst, state.wgts_buffered, cond_tile, wgts, state.wgts_buf,
+                                                      wgts_data);
         hvx::util::BiasUpdate<typename param_::bias_type, param_::fm_vec_size, param_::bias_vec_elms, param_::buffer_bias>(
-            ptr_dst, bias_buffered_, cond_bias, bias, bias_buf, bias_data);
+            ptr_dst, state.bias_buffered, cond_bias, bias, state.bias_buf, bias_data);
 
-        // applies conv function on an src vector
-        hvx::nn::ConvComp<param_>(chnl_v, sum_global, win, wgts_data, bias_data, dst_data);
+        // computes the dst tile
+        if (cond_tile)
+            hvx::nn::impl::ConvWinogradComp<param_>(chnl_v, fm_v, tile_col, state.win, wgts_data, bias_data, state.wino_sum,
+                                                     state.wino_buf);
 
-        // write next dst vector
-        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, (cond.dst_row && cond.dst_col && cond_fm));
+        // write next dst vector from the tile buffer (the dst row/col is the row/col of the window)
+        if (cond_dst_write)
+            dst_data = state.wino_buf.Get(fm_v, (tile_row % param_::tile) * param_::dst_cols + tile_col);
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, cond_dst_write);
     }
     hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
 }
 
+/*!
+ * @brief top function of the conv layer (uses a single state for each parameter set)
+ */
+template<typename param_, bool with_bias_ = false>
+HVX_FORCE_INLINE auto
+ConvTop(typename param_::src_port* src,
+        typename param_::wgts_vec* wgts,
+        typename param_::bias_vec* bias,
+        typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::ConvState<param_> state;
+    hvx::nn::ConvTop<param_, with_bias_>(state, src, wgts, bias, dst);
+}
+
 /******************************************************************************************************************************************/
 } // namespace nn
 } // namespace hvx
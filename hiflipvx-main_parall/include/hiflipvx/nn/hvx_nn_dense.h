@@ -45,7 +45,9 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          int64_t buf_bias_                      = false,                          // if bias should be buffered internally on first read
          hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
          hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
-         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         typename epilogue_                     = hvx::util::EpilogueParam<>, // applied on the result after the bias was added
+         hvx::util::sim_e sim_type_             = hvx::util::sim_e::kHw>      // implementation used during C-simulation
 struct DenseParam {
     // tensor parameters
     using src_dim  = hvx::util::TensorParam<2, chnls_v, batch_v>;
@@ -84,17 +86,82 @@ struct DenseParam {
     static constexpr auto overflow_type  = overflow_type_;
     static constexpr auto underflow_type = underflow_type_;
     static constexpr auto exec_type      = exec_type_;
+    static constexpr auto sim_type       = sim_type_;
+    using epilogue                       = epilogue_;
+
+    // dense parameters converted to convolution parameters (1x1 kernel applied on a batch of vectors, a vectorized batch is mapped to
+    // the row vectorization of the convolution, which has the same memory layout)
+    static constexpr auto batch_vec = (batch_v::vec_size > 1);
+    using conv_batch_v              = std::conditional_t<batch_vec, hvx::util::VectorParam<1, 1>, batch_v>;
+    using conv_rows_v               = std::conditional_t<batch_vec, batch_v, hvx::util::VectorParam<1, 1>>;
+    using conv_param = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, conv_batch_v, conv_rows_v,
+                                          hvx::util::VectorParam<1, 1>, chnls_v, fms_v, hvx::util::VectorParam<1, 1>,
+                                          hvx::util::VectorParam<1, 1>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<0, 0>,
+                                          hvx::util::Array2dParam<1, 1>, buf_wgts_, buf_bias_, overflow_type_, underflow_type_, exec_type_,
+                                          hvx::util::conv_e::kDirect, epilogue_, sim_type_>;
 
     // constructor (verifies the dimensions and types)
     constexpr DenseParam() {
-        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, true, true, true, true, true>();
-        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, true, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, false, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, false, true, true, true, true>();
         hvx::nn::impl::ConvVerifyType<src_type, wgts_type, bias_type, dst_type>();
     }
 };
 
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief the state of a dense layer instance (the state of the underlying convolution)
+ */
+template<typename param_>
+using DenseState = hvx::nn::ConvState<typename param_::conv_param>;
+
+/*!
+ * @brief top function of the dense layer (with bias, the state of the layer instance is passed by the caller)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+DenseTop(hvx::nn::DenseState<param_>& state,
+         typename param_::src_vec* src,
+         typename param_::wgts_vec* wgts,
+         typename param_::bias_vec* bias,
+         typename param_::dst_vec* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // calls the convolution function
+    hvx::nn::ConvTop<typename param_::conv_param, true>(state, src, wgts, bias, dst);
+}
+
+/*!
+ * @brief top function of the dense layer (without bias, the state of the layer instance is passed by the caller)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+DenseTop(hvx::nn::DenseState<param_>& state,
+         typename param_::src_vec* src,
+         typename param_::wgts_vec* wgts,
+         typename param_::dst_vec* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // calls the convolution function
+    hvx::nn::ConvTop<typename param_::conv_param, false>(state, src, wgts, nullptr, dst);
+}
+
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+/*!
+ * @brief C-simulation fast path of the dense layer (GEMM), bit exact with DenseTop. Returns false if it is not available.
+ */
+template<typename param_, bool with_bias_ = true>
+auto
+DenseGemmTop(hvx::nn::DenseState<param_>& state,
+             typename param_::src_vec* src,
+             typename param_::wgts_vec* wgts,
+             typename param_::bias_vec* bias,
+             typename param_::dst_vec* dst) -> bool {
+    return hvx::nn::ConvGemmTop<typename param_::conv_param, with_bias_>(state, src, wgts, bias, dst);
+}
+#endif
+
 /*!
  * @brief top function of the dense layer (with bias)
  */
@@ -106,16 +173,8 @@ DenseTop(typename param_::src_vec* src,
          typename param_::dst_vec* dst) noexcept -> void {
     HVX_INLINE_TOP();
 
-    // converts dense parameters to convoltuion parameters
-    using dense = hvx::nn::ConvParam<typename param_::src_type, typename param_::dst_type, typename param_::wgts_type,
-                                     typename param_::bias_type, typename param_::src_dim::dim1, hvx::util::VectorParam<1, 1>,
-                                     hvx::util::VectorParam<1, 1>, typename param_::wgts_dim::dim0, typename param_::wgts_dim::dim1,
-                                     hvx::util::VectorParam<1, 1>, hvx::util::VectorParam<1, 1>, hvx::util::Array2dParam<0, 0>,
-                                     hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, param_::buffer_wgts, param_::buffer_bias,
-                                     param_::overflow_type, param_::underflow_type, param_::exec_type>;
-
     // calls the convolution function
-    hvx::nn::ConvTop<dense, true>(src, wgts, bias, dst);
+    hvx::nn::ConvTop<typename param_::conv_param, true>(src, wgts, bias, dst);
 }
 
 /*!
@@ -126,16 +185,8 @@ HVX_FORCE_INLINE constexpr auto
 DenseTop(typename param_::src_vec* src, typename param_::wgts_vec* wgts, typename param_::dst_vec* dst) noexcept -> void {
     HVX_INLINE_TOP();
 
-    // converts dense parameters to convoltuion parameters
-    using dense = hvx::nn::ConvParam<typename param_::src_type, typename param_::dst_type, typename param_::wgts_type,
-                                     typename param_::bias_type, typename param_::src_dim::dim1, hvx::util::VectorParam<1, 1>,
-                                     hvx::util::VectorParam<1, 1>, typename param_::wgts_dim::dim0, typename param_::wgts_dim::dim1,
-                                     hvx::util::VectorParam<1, 1>, hvx::util::VectorParam<1, 1>, hvx::util::Array2dParam<0, 0>,
-                                     hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, param_::buffer_wgts, param_::buffer_bias,
-                                     param_::overflow_type, param_::underflow_type, param_::exec_type>;
-
     // calls the convolution function
-    hvx::nn::ConvTop<dense, false>(src, wgts, nullptr, dst);
+    hvx::nn::ConvTop<typename param_::conv_param, false>(src, wgts, nullptr, dst);
 }
 
 /******************************************************************************************************************************************/
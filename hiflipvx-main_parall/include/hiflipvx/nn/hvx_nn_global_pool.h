@@ -0,0 +1,172 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_global_pool.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Global pooling (average, max or sum over all pixels of a sample). The src is streamed without a window, only one accumulator per chnl
+ *  is buffered. One dst vector per src chnl vector is written after the last pixel of a sample.
+ */
+
+#ifndef HVX_NN_GLOBAL_POOL_H_
+#define HVX_NN_GLOBAL_POOL_H_
+
+#include "impl/hvx_nn_pool_dfixed.h"
+#include "impl/hvx_nn_pool_dfloat.h"
+
+namespace hvx {
+namespace nn {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief All compile time parameters and checks for the global pooling functions
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>,
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,
+         typename src_rows_v                    = hvx::util::VectorParam<1, 1>,
+         typename src_cols_v                    = hvx::util::VectorParam<1, 1>,
+         typename chnls_v                       = hvx::util::VectorParam<1, 1>,
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         hvx::util::pooling_e pool_type_        = hvx::util::pooling_e::kAvg>
+struct GlobalPoolParam {
+    // tensor parameters (the dst has the layout of the src of a dense layer)
+    using src_dim = hvx::util::TensorParam<4, chnls_v, src_cols_v, src_rows_v, batch_v>;
+    using dst_dim = hvx::util::TensorParam<2, chnls_v, batch_v>;
+
+    // dimensions
+    static constexpr auto batch            = batch_v::elms;
+    static constexpr auto src_rows         = src_rows_v::elms;
+    static constexpr auto src_row_vec_size = src_rows_v::vec_size;
+    static constexpr auto src_cols         = src_cols_v::elms;
+    static constexpr auto chnls            = chnls_v::elms;
+    static constexpr auto chnl_vec_size    = chnls_v::vec_size;
+    static constexpr auto chnl_vec_elms    = chnls_v::vec_elms;
+    static constexpr auto pixels           = src_rows * src_cols;
+
+    // data types
+    using src_type = src_type_;
+    using dst_type = dst_type_;
+    using acc_type = hvx::nn::impl::pool_acc_type_t<src_type_>;
+    using src_vec  = hvx::util::vector<src_type, src_dim::vec_size>;
+    using dst_vec  = hvx::util::vector<dst_type, dst_dim::vec_size>;
+    using acc_vec  = hvx::util::vector<acc_type, chnl_vec_size>;
+    using src_port = src_vec;
+    using dst_port = dst_vec;
+
+    // the whole sample is the kernel (for the performance model)
+    static constexpr auto knl_dil_rows = src_rows;
+    static constexpr auto pad_rows_up  = 0;
+
+    // numerical stability
+    static constexpr auto overflow_type  = overflow_type_;
+    static constexpr auto underflow_type = underflow_type_;
+    static constexpr auto exec_type      = exec_type_;
+    static constexpr auto pool_type      = pool_type_;
+
+    // latency
+    static constexpr auto lat_pixels = pixels;
+    static constexpr auto lat_cols   = src_cols;
+    static constexpr auto lat_chnls  = chnl_vec_elms;
+    static constexpr auto lat        = batch * lat_pixels * lat_chnls;
+
+    // constructor (verifies the dimension)
+    constexpr GlobalPoolParam() {
+        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, true, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, true, true, true, true, true>();
+        hvx::nn::impl::PoolVerifyType<src_type, dst_type>();
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief the state of a global pool layer instance (one accumulator per chnl)
+ */
+template<typename param_>
+struct GlobalPoolState : hvx::util::LayerArena<GlobalPoolState<param_>> {
+    // accumulates the src pixels of a sample [dont initialize]
+    hvx::util::array1d<typename param_::acc_vec, param_::chnl_vec_elms> acc_buf;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+};
+
+/*!
+ * @brief top function of the global pool layer (the state of the layer instance is passed by the caller)
+ */
+template<typename param_, hvx::util::pooling_e pool_type_>
+HVX_FORCE_INLINE auto
+GlobalPoolTop(hvx::nn::GlobalPoolState<param_>& state, typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // directives for the accumulators
+    HVX_DATAPACK(state.acc_buf.data);
+
+    // iterates through the tensor vector by vector
+    int64_t ptr_src = 0, ptr_dst = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+
+        // buffer the src and dst vectors
+        typename param_::src_vec src_data{};
+        typename param_::dst_vec dst_data{};
+
+        // flattening loop to improve lat
+        const int64_t pixel  = (i / param_::lat_chnls) % param_::lat_pixels;
+        const int64_t chnl_v = (i % param_::lat_chnls);
+        const bool first     = (pixel == 0);
+        const bool last      = (pixel == (param_::lat_pixels - 1));
+
+        // read next src vector
+        hvx::util::StreamReadData<>(src, src_data, ptr_src, true);
+
+        // accumulates the src vector (restarts with the first pixel of a sample)
+        auto acc_data = state.acc_buf.Get(chnl_v);
+        for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+            HVX_UNROLL();
+            hvx::nn::impl::GlobalPoolUpdate<param_, pool_type_>(first, src_data.Get(chnl_p), acc_data.Get(chnl_p));
+            if (last == true)
+                hvx::nn::impl::GlobalPoolResult<param_, pool_type_>(acc_data.Get(chnl_p), dst_data.Get(chnl_p));
+        }
+        state.acc_buf.Set(acc_data, chnl_v);
+
+        // write next dst vector (after the last pixel of a sample)
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, last);
+    }
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
+}
+
+/*!
+ * @brief top function of the global pool layer (uses a single state for each parameter set)
+ */
+template<typename param_, hvx::util::pooling_e pool_type_>
+HVX_FORCE_INLINE auto
+GlobalPoolTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::GlobalPoolState<param_> state;
+    hvx::nn::GlobalPoolTop<param_, pool_type_>(state, src, dst);
+}
+
+/******************************************************************************************************************************************/
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_GLOBAL_POOL_H_
@@ -48,7 +48,10 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
          hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
          hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
-         typename clip_                         = hvx::util::ClipParam<1, 0>>
+         typename clip_                         = hvx::util::ClipParam<1, 0>,
+         hvx::util::norm_e norm_type_           = hvx::util::norm_e::kAffine,
+         hvx::util::norm_axes_e norm_axes_      = hvx::util::norm_axes_e::kChnls,
+         typename eps_                          = hvx::util::RatioParam<1, 100000>>
 struct LayernormParam {
     // tensor parameters
     using src_dim  = hvx::util::TensorParam<4, chnls_v, src_cols_v, src_rows_v, batch_v>;
@@ -89,8 +92,21 @@ struct LayernormParam {
     static constexpr auto underflow_type = underflow_type_;
     static constexpr auto exec_type      = exec_type_;
 
-    // latency
-    static constexpr auto lat = batch * src_rows * src_cols * chnl_vec_elms;
+    // normalization parameters (kAffine only applies wgts and bias, kLayer and kRms normalize over the norm_axes group first)
+    static constexpr auto norm_type     = norm_type_;
+    static constexpr auto norm_axes     = norm_axes_;
+    static constexpr auto eps           = static_cast<float>(eps_::num) / static_cast<float>(eps_::den);
+    static constexpr auto norm_elms     = chnls * ((norm_axes >= hvx::util::norm_axes_e::kColsChnls) ? src_cols : 1) *
+                                      ((norm_axes >= hvx::util::norm_axes_e::kRowsColsChnls) ? src_rows : 1);
+    static constexpr auto norm_vec_elms = norm_elms / chnl_vec_size;
+    static constexpr auto norm_buf_elms = (norm_type == hvx::util::norm_e::kAffine) ? 1 : norm_vec_elms;
+    using stat_type                     = std::conditional_t<hvx::util::is_dfixed_v<src_type>,
+                                                             hvx::nn::impl::LayernormStatDfixed<src_type>,
+                                                             hvx::nn::impl::LayernormStatDfloat<src_type>>;
+
+    // latency (a normalization group is read into a buffer to compute its statistics and then normalized, like in the softmax)
+    static constexpr auto lat_phases = (norm_type == hvx::util::norm_e::kAffine) ? 1 : 2;
+    static constexpr auto lat        = lat_phases * batch * src_rows * src_cols * chnl_vec_elms;
 
     // constructor (verifies the dimensions and data types)
     constexpr LayernormParam() {
@@ -98,6 +114,7 @@ struct LayernormParam {
         hvx::util::TensorVerifyIfVecSizeIs1<wgts_dim, false, false, true, true, true, true>();
         hvx::util::TensorVerifyIfVecSizeIs1<bias_dim, false, false, true, true, true, true>();
         hvx::nn::impl::LayernormVerifyType<src_type_, dst_type_, wgts_type_, bias_type_>();
+        hvx::nn::impl::LayernormVerifyStat<LayernormParam>();
     }
 };
 
@@ -160,20 +177,59 @@ LayernormComp(typename param_::src_vec& src_data,
 }
 
 /*!
- * @brief top function of the normalization layer
+ * @brief normalizes an src vector with the statistics of its group and applies wgts and bias
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+LayernormNormComp(typename param_::src_vec& src_data,
+                  typename param_::wgts_vec& wgts_data,
+                  typename param_::bias_vec& bias_data,
+                  typename param_::stat_type& stat,
+                  typename param_::dst_vec& dst_data) noexcept -> void {
+    HVX_INLINE_TOP();
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        hvx::nn::impl::LayernormNormComp<param_>(src_data.Get(chnl_p), wgts_data.Get(chnl_p), bias_data.Get(chnl_p), stat,
+                                                 dst_data.Get(chnl_p));
+    }
+}
+
+/*!
+ * @brief the state of a normalization layer instance
+ */
+template<typename param_>
+struct LayernormState : hvx::util::LayerArena<LayernormState<param_>> {
+    // buffers normalization wgts and bias [dont initialize]
+    hvx::util::array1d<typename param_::wgts_vec, param_::chnl_vec_elms> wgts_buf;
+    hvx::util::array1d<typename param_::bias_vec, param_::chnl_vec_elms> bias_buf;
+
+    // buffers the src vectors and the statistics of the current normalization group [dont initialize]
+    hvx::util::array1d<typename param_::src_vec, param_::norm_buf_elms> src_buf;
+    typename param_::stat_type stat;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+};
+
+/*!
+ * @brief top function of the normalization layer (the state of the layer instance is passed by the caller)
  */
 template<typename param_>
 HVX_FORCE_INLINE auto
-LayernormTop(typename param_::src_port* src,
+LayernormTop(hvx::nn::LayernormState<param_>& state,
+             typename param_::src_port* src,
              typename param_::wgts_vec* wgts,
              typename param_::bias_vec* bias,
              typename param_::dst_port* dst) noexcept -> void {
     HVX_INLINE_TOP();
+    HVX_DATAPACK(state.wgts_buf.data, state.bias_buf.data, state.src_buf.data);
+    auto& wgts_buf = state.wgts_buf;
+    auto& bias_buf = state.bias_buf;
+    auto& src_buf  = state.src_buf;
+    auto& stat     = state.stat;
 
-    // buffers normalization wgts and bias [dont initialize]
-    static hvx::util::array1d<typename param_::wgts_vec, param_::chnl_vec_elms> wgts_buf;
-    static hvx::util::array1d<typename param_::bias_vec, param_::chnl_vec_elms> bias_buf;
-    HVX_DATAPACK(wgts_buf.data, bias_buf.data);
+    // number of iterations per normalization group (statistics phase + normalization phase)
+    constexpr int64_t grp_lat = param_::lat_phases * param_::norm_vec_elms;
 
     // iterates through the tensor vector by vector
     int64_t ptr_src = 0, ptr_dst = 0;
@@ -187,24 +243,56 @@ LayernormTop(typename param_::src_port* src,
         typename param_::dst_vec dst_data{};
 
         // flattening loop for stride optimization
-        const bool cond_wgts = (i < param_::chnl_vec_elms);
-        const int64_t chnl_v = (i % param_::chnl_vec_elms);
+        const int64_t grp_i  = (i % grp_lat);
+        const int64_t elm_v  = (grp_i % param_::norm_vec_elms);
+        const int64_t chnl_v = (elm_v % param_::chnl_vec_elms);
+        const bool is_affine = (param_::norm_type == hvx::util::norm_e::kAffine);
+        const bool cond_stat = !is_affine && (grp_i < param_::norm_vec_elms);
+        const bool cond_norm = !cond_stat;
+        const bool cond_wgts = (i < grp_lat) && cond_norm && (elm_v < param_::chnl_vec_elms);
 
-        // read next src vector
-        hvx::util::StreamReadData<>(src, src_data, ptr_src, true);
+        // read next src vector (kLayer/kRms: buffer it and accumulate the statistics of its group)
+        if (is_affine || cond_stat)
+            hvx::util::StreamReadData<>(src, src_data, ptr_src, true);
+        if (cond_stat) {
+            src_buf.Set(src_data, elm_v);
+            hvx::nn::impl::LayernormStatUpdate<param_>(elm_v, src_data, stat);
+            if (elm_v == (param_::norm_vec_elms - 1))
+                hvx::nn::impl::LayernormStatFinal<param_>(stat);
+        } else if (!is_affine) {
+            src_data = src_buf.Get(elm_v);
+        }
 
         // read wgts and bias
-        hvx::nn::LayernormWeightsBias<param_>(cond_wgts, chnl_v, wgts, bias, wgts_buf, bias_buf, wgts_data, bias_data);
+        if (cond_norm)
+            hvx::nn::LayernormWeightsBias<param_>(cond_wgts, chnl_v, wgts, bias, wgts_buf, bias_buf, wgts_data, bias_data);
 
         // applies normalization on a vector
-        hvx::nn::LayernormComp<param_>(src_data, wgts_data, bias_data, dst_data);
+        if (is_affine)
+            hvx::nn::LayernormComp<param_>(src_data, wgts_data, bias_data, dst_data);
+        else
+            hvx::nn::LayernormNormComp<param_>(src_data, wgts_data, bias_data, stat, dst_data);
 
         // write next dst vector
-        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, true);
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, cond_norm);
     }
     hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
 }
 
+/*!
+ * @brief top function of the normalization layer (uses a single state for each parameter set)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+LayernormTop(typename param_::src_port* src,
+             typename param_::wgts_vec* wgts,
+             typename param_::bias_vec* bias,
+             typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::LayernormState<param_> state;
+    hvx::nn::LayernormTop<param_>(state, src, wgts, bias, dst);
+}
+
 /******************************************************************************************************************************************/
 } // namespace nn
 } // namespace hvx
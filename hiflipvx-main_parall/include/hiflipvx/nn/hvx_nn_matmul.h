@@ -0,0 +1,294 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_matmul.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Matrix multiplication of two activation streams (batched GEMM), e.g. Q * K^T and softmax(Q * K^T) * V of an attention layer. The
+ *  src2 matrix of a batch/head is buffered tile by tile, then the src1 matrix is streamed row vector by row vector against it.
+ */
+
+#ifndef HVX_NN_MATMUL_H_
+#define HVX_NN_MATMUL_H_
+
+#include "hvx_nn_conv.h"
+
+namespace hvx {
+namespace nn {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief All compile time parameters and checks for the matrix multiplication "dst[M][N] = src1[M][K] * src2[K][N]" of every batch and
+ * head. If "src2_trans_" is set, src2 is passed as "src2[N][K]" (e.g. the keys of an attention layer for Q * K^T).
+ */
+template<typename src1_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the first input (left matrix)
+         typename src2_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the second input (right matrix)
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the outputs
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,   // batch size
+         typename heads_v                       = hvx::util::VectorParam<1, 1>,   // number of heads (independent matrices per batch)
+         typename rows_v                        = hvx::util::VectorParam<1, 1>,   // number of rows of src1 and dst (M)
+         typename inner_v                       = hvx::util::VectorParam<1, 1>,   // number of columns of src1 and rows of src2 (K)
+         typename cols_v                        = hvx::util::VectorParam<1, 1>,   // number of columns of src2 and dst (N)
+         int64_t src2_trans_                    = false,                          // if src2 is transposed (N x K instead of K x N)
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         typename epilogue_                     = hvx::util::EpilogueParam<>> // applied on the result (e.g. the scale 1/sqrt(K))
+struct MatMulParam {
+    // tensor parameters (a vector of src2 is a "K x N" tile in both layouts)
+    using src1_dim = hvx::util::TensorParam<4, inner_v, rows_v, heads_v, batch_v>;
+    using src2_dim = std::conditional_t<src2_trans_ != false,
+                                        hvx::util::TensorParam<4, inner_v, cols_v, heads_v, batch_v>,
+                                        hvx::util::TensorParam<4, cols_v, inner_v, heads_v, batch_v>>;
+    using dst_dim  = hvx::util::TensorParam<4, cols_v, rows_v, heads_v, batch_v>;
+
+    // dimensions
+    static constexpr auto batch          = batch_v::elms;
+    static constexpr auto heads          = heads_v::elms;
+    static constexpr auto rows           = rows_v::elms;
+    static constexpr auto row_vec_size   = rows_v::vec_size;
+    static constexpr auto row_vec_elms   = rows_v::vec_elms;
+    static constexpr auto inner          = inner_v::elms;
+    static constexpr auto inner_vec_size = inner_v::vec_size;
+    static constexpr auto inner_vec_elms = inner_v::vec_elms;
+    static constexpr auto cols           = cols_v::elms;
+    static constexpr auto col_vec_size   = cols_v::vec_size;
+    static constexpr auto col_vec_elms   = cols_v::vec_elms;
+    static constexpr auto src2_trans     = src2_trans_;
+
+    // data types
+    using src1_type = src1_type_;
+    using src2_type = src2_type_;
+    using dst_type  = dst_type_;
+    using comp_type = hvx::util::def_int_type_t<src1_type_, src2_type_>;
+    using src1_vec  = hvx::util::vector<src1_type, src1_dim::vec_size>;
+    using src2_vec  = hvx::util::vector<src2_type, src2_dim::vec_size>;
+    using dst_vec   = hvx::util::vector<dst_type, dst_dim::vec_size>;
+    using src1_port = src1_vec;
+    using src2_port = src2_vec;
+    using dst_port  = dst_vec;
+
+    // the dot products are computed like a 1x1 convolution without bias (src2 are the weights, src1 the window)
+    using src_type                          = src1_type_;
+    using wgts_type                         = src2_type_;
+    using bias_type                         = dst_type_;
+    static constexpr auto chnl_vec_size     = inner_vec_size;
+    static constexpr auto fm_vec_elms       = col_vec_elms;
+    static constexpr auto knl_rows_vec_size = 1;
+    static constexpr auto knl_cols_vec_size = 1;
+
+    // summation parameters (one global sum per element of a dst vector, one src1/src2 tile is summed up per cycle)
+    static constexpr auto sum_global_elms = row_vec_size * col_vec_size;
+    static constexpr auto sum_elms        = inner_vec_size;
+    static constexpr auto mults           = sum_elms * sum_global_elms;
+
+    // numerical stability
+    static constexpr auto overflow_type  = overflow_type_;
+    static constexpr auto underflow_type = underflow_type_;
+    static constexpr auto exec_type      = exec_type_;
+    using epilogue                       = epilogue_;
+
+    // latency (src2 of a head is buffered before its first dst vector, then one src1/src2 tile is multiplied per iteration)
+    static constexpr auto lat_src2  = inner_vec_elms * col_vec_elms;
+    static constexpr auto lat_rows  = row_vec_elms;
+    static constexpr auto lat_cols  = col_vec_elms;
+    static constexpr auto lat_inner = inner_vec_elms;
+    static constexpr auto lat_head  = lat_src2 + lat_rows * lat_cols * lat_inner;
+    static constexpr auto lat       = batch * heads * lat_head;
+    static constexpr auto lat_delay = lat_src2 + lat_inner - 1;
+
+    // constructor (verifies the dimensions and types)
+    constexpr MatMulParam() {
+        hvx::util::TensorVerifyIfVecSizeIs1<src1_dim, false, false, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<src2_dim, false, false, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, false, true, true, true, true>();
+        hvx::nn::impl::ConvVerifyType<src1_type, src2_type, dst_type, dst_type>();
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief the state of a matmul layer instance
+ */
+template<typename param_>
+struct MatMulState : hvx::util::LayerArena<MatMulState<param_>> {
+    // buffers src2 of a head as "K x N" tiles in the order [col_v][inner_v] [dont initialize]
+    hvx::util::array1d<typename param_::src2_vec, param_::lat_src2> src2_buf;
+
+    // buffers one row vector of src1, it is reused for all column vectors of the dst [dont initialize]
+    hvx::util::array1d<typename param_::src1_vec, param_::inner_vec_elms> src1_buf;
+
+    // buffers the global sum for one dst vector [dont initialize]
+    hvx::util::array1d<typename param_::comp_type, param_::sum_global_elms> sum_global;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+};
+
+/*!
+ * @brief gets the tile of the src2 buffer that belongs to a src2 vector of a head
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+MatMulSrc2Tile(int64_t src2_v) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    if (param_::src2_trans != false)
+        return src2_v;
+    return (src2_v % param_::col_vec_elms) * param_::inner_vec_elms + (src2_v / param_::col_vec_elms);
+}
+
+/*!
+ * @brief comp the dot products of a src1 tile and a src2 tile for all elements of a dst vector
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+MatMulComp(int64_t inner_v,
+           hvx::util::array1d<typename param_::comp_type, param_::sum_global_elms>& sum_global,
+           typename param_::src1_vec& src1_data,
+           typename param_::src2_vec& src2_data,
+           typename param_::dst_vec& dst_data) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // no bias is added
+    typename param_::bias_type bias{};
+
+    // dst rows and columns of the dst vector
+    for (int64_t row_p = 0; row_p < param_::row_vec_size; ++row_p) {
+        HVX_UNROLL();
+        for (int64_t col_p = 0; col_p < param_::col_vec_size; ++col_p) {
+            HVX_UNROLL();
+
+            // gather the src1 row and the src2 column of the tiles
+            hvx::util::vector<typename param_::src1_type, param_::sum_elms> src1_tmp{};
+            hvx::util::vector<typename param_::src2_type, param_::sum_elms> src2_tmp{};
+            for (int64_t inner_p = 0; inner_p < param_::inner_vec_size; ++inner_p) {
+                HVX_UNROLL();
+                const int64_t src2_p = (param_::src2_trans != false) ? (col_p * param_::inner_vec_size + inner_p)
+                                                                     : (inner_p * param_::col_vec_size + col_p);
+                src1_tmp.Set(src1_data.Get(row_p * param_::inner_vec_size + inner_p), inner_p);
+                src2_tmp.Set(src2_data.Get(src2_p), inner_p);
+            }
+
+            // update the global sum and apply the epilogue
+            const int64_t dst_p = row_p * param_::col_vec_size + col_p;
+            hvx::nn::impl::ConvComp<param_>(inner_v, sum_global.Get(dst_p), src1_tmp, src2_tmp, bias, dst_data.Get(dst_p));
+        }
+    }
+}
+
+/*!
+ * @brief next iteration of the matmul layer (buffers src2 of a head first, then iterates over the dst rows, cols and the inner dim)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+MatMulScheduleNext(int64_t& src2_v, int64_t& row_v, int64_t& col_v, int64_t& inner_v) noexcept -> void {
+    HVX_INLINE_TOP();
+    if (src2_v < param_::lat_src2) {
+        ++src2_v;
+    } else if (inner_v < (param_::lat_inner - 1)) {
+        ++inner_v;
+    } else if (col_v < (param_::lat_cols - 1)) {
+        inner_v = 0;
+        ++col_v;
+    } else if (row_v < (param_::lat_rows - 1)) {
+        inner_v = 0;
+        col_v   = 0;
+        ++row_v;
+    } else {
+        inner_v = 0;
+        col_v   = 0;
+        row_v   = 0;
+        src2_v  = 0;
+    }
+}
+
+/*!
+ * @brief top function of the matmul layer (the state of the layer instance is passed by the caller)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+MatMulTop(hvx::nn::MatMulState<param_>& state,
+          typename param_::src1_port* src1,
+          typename param_::src2_port* src2,
+          typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // directives for buffers
+    HVX_DATAPACK(state.src2_buf.data, state.src1_buf.data);
+    HVX_ARRAY_PARTITION_COMPLETE(state.sum_global.data, 0);
+
+    // iterates through the tensors vector by vector (flattened loop over all batches and heads)
+    int64_t ptr_src1 = 0, ptr_src2 = 0, ptr_dst = 0;
+    int64_t src2_v = 0, row_v = 0, col_v = 0, inner_v = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+
+        // buffer the src and dst vectors
+        typename param_::src1_vec src1_data{};
+        typename param_::src2_vec src2_data{};
+        typename param_::dst_vec dst_data{};
+
+        // conditions (src2 is buffered first, a src1 vector is read with the first dst column vector)
+        const bool cond_src2 = (src2_v < param_::lat_src2);
+        const bool cond_src1 = (!cond_src2 && (col_v == 0));
+        const bool cond_dst  = (!cond_src2 && (inner_v == (param_::lat_inner - 1)));
+
+        // read next src2 vector and buffer it as a tile
+        hvx::util::StreamReadData<>(src2, src2_data, ptr_src2, cond_src2);
+        if (cond_src2 == true)
+            state.src2_buf.Set(src2_data, hvx::nn::MatMulSrc2Tile<param_>(src2_v));
+
+        // read next src1 vector or get it from the buffer
+        hvx::util::StreamReadData<>(src1, src1_data, ptr_src1, cond_src1);
+        if (cond_src1 == true)
+            state.src1_buf.Set(src1_data, inner_v);
+        else
+            src1_data = state.src1_buf.Get(inner_v);
+
+        // multiplies a src1 tile with a src2 tile
+        if (cond_src2 == false)
+            hvx::nn::MatMulComp<param_>(inner_v, state.sum_global, src1_data, state.src2_buf.Get(col_v * param_::lat_inner + inner_v),
+                                        dst_data);
+
+        // write next dst vector
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, cond_dst);
+
+        // next src2 vector, dst row/col vector and inner vector
+        hvx::nn::MatMulScheduleNext<param_>(src2_v, row_v, col_v, inner_v);
+    }
+    hvx::util::StreamSignalVerify<typename param_::src1_dim, typename param_::dst_dim>(ptr_src1, ptr_dst);
+    hvx::util::StreamSignalVerify<typename param_::src2_dim, typename param_::dst_dim>(ptr_src2, ptr_dst);
+}
+
+/*!
+ * @brief top function of the matmul layer (uses a single state for each parameter set)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+MatMulTop(typename param_::src1_port* src1, typename param_::src2_port* src2, typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::MatMulState<param_> state;
+    hvx::nn::MatMulTop<param_>(state, src1, src2, dst);
+}
+
+/******************************************************************************************************************************************/
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_MATMUL_H_
@@ -52,8 +52,8 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          hvx::util::pooling_e pool_type_        = hvx::util::pooling_e::kMax>
 struct PoolParam {
     // destination rows/cols
-    using dst_rows_v = decltype(hvx::util::WinDstVecParams<src_rows_v, knl_rows_v, pad_::rows, dil_::rows, str_::rows>());
-    using dst_cols_v = decltype(hvx::util::WinDstVecParams<src_cols_v, knl_cols_v, pad_::cols, dil_::cols, str_::cols>());
+    using dst_rows_v = decltype(hvx::util::WinDstVecParams<src_rows_v, knl_rows_v, pad_::rows, pad_::rows, dil_::rows, str_::rows>());
+    using dst_cols_v = decltype(hvx::util::WinDstVecParams<src_cols_v, knl_cols_v, pad_::cols, pad_::cols, dil_::cols, str_::cols>());
 
     // tensor parameters
     using src_dim = hvx::util::TensorParam<4, chnls_v, src_cols_v, src_rows_v, batch_v>;
@@ -94,6 +94,10 @@ struct PoolParam {
     static constexpr auto knl_elms          = knl_rows * knl_cols;
     static constexpr auto pad_rows          = pad_::rows;
     static constexpr auto pad_cols          = pad_::cols;
+    static constexpr auto pad_rows_up       = pad_::rows;
+    static constexpr auto pad_rows_down     = pad_::rows;
+    static constexpr auto pad_cols_left     = pad_::cols;
+    static constexpr auto pad_cols_right    = pad_::cols;
     static constexpr auto dil_rows          = dil_::rows;
     static constexpr auto dil_cols          = dil_::cols;
     static constexpr auto knl_dil_rows      = hvx::util::WinKnlDilLen<knl_rows_v::elms, dil_::rows>();
@@ -101,16 +105,28 @@ struct PoolParam {
     static constexpr auto knl_dil_elms      = knl_dil_rows * knl_dil_cols;
     static constexpr auto str_rows          = str_::rows;
     static constexpr auto str_cols          = str_::cols;
+    static constexpr auto knl_vec_rows      = knl_rows + (dst_row_vec_size - 1) * str_rows;
+    static constexpr auto knl_vec_cols      = knl_cols + (dst_col_vec_size - 1) * str_cols;
+    static constexpr auto knl_win_rows = hvx::util::Win_knl_size<knl_dil_rows, src_row_vec_size, dst_row_vec_size, str_rows, pad_rows_up>();
+    static constexpr auto knl_win_cols =
+        hvx::util::Win_knl_size<knl_dil_cols, src_col_vec_size, dst_col_vec_size, str_cols, pad_cols_left>();
+    static constexpr auto knl_sel_rows = knl_dil_rows + (dst_row_vec_size - 1) * str_rows;
+    static constexpr auto knl_sel_cols = knl_dil_cols + (dst_col_vec_size - 1) * str_cols;
+    static constexpr auto knl_ovr_rows =
+        hvx::util::Over_size<knl_win_rows, knl_sel_rows, src_row_vec_size, dst_row_vec_size, str_rows, pad_rows_up>();
+    static constexpr auto knl_ovr_cols =
+        hvx::util::Over_size<knl_win_cols, knl_sel_cols, src_col_vec_size, dst_col_vec_size, str_cols, pad_cols_left>();
 
     // buffer parameters
     static constexpr auto row_buf_elms = src_cols * chnl_vec_elms;
-    static constexpr auto row_buf_num  = hvx::util::Max(knl_dil_rows - 1, static_cast<int64_t>(1));
+    static constexpr auto row_buf_num  = hvx::util::Max((knl_win_rows / src_row_vec_size) - 1, static_cast<int64_t>(1));
     static constexpr auto win_buf_elms = chnl_vec_elms;
-    static constexpr auto win_buf_num  = hvx::util::Max(knl_dil_cols - 1, static_cast<int64_t>(1)) * knl_dil_rows;
+    static constexpr auto win_buf_num =
+        hvx::util::Max((knl_win_cols / src_col_vec_size) - 1, static_cast<int64_t>(1)) * (knl_win_rows / src_row_vec_size);
     static constexpr auto src_buf_elms = chnl_vec_elms;
     static constexpr auto src_buf_num  = 1;
-    static constexpr auto win_elms     = knl_elms;
-    static constexpr auto win_dil_elms = knl_dil_elms;
+    static constexpr auto win_elms     = knl_sel_rows * knl_sel_cols;
+    static constexpr auto win_dil_elms = knl_win_rows * knl_win_cols;
 
     // numerical stability
     static constexpr auto overflow_type  = overflow_type_;
@@ -144,7 +160,7 @@ struct PoolParam {
  */
 template<typename param_, hvx::util::pooling_e pool_type_>
 HVX_FORCE_INLINE constexpr auto
-PoolComp(hvx::util::array1d<typename param_::src_vec, param_::knl_elms>& win, typename param_::dst_vec& dst_data) noexcept -> void {
+PoolComp(hvx::util::array1d<typename param_::src_vec, param_::win_elms>& win, typename param_::dst_vec& dst_data) noexcept -> void {
     HVX_INLINE_TOP();
 
     for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
@@ -153,9 +169,13 @@ PoolComp(hvx::util::array1d<typename param_::src_vec, param_::knl_elms>& win, ty
         // buffers needed win to comp one dst element
         typename param_::knl_vec win_tmp{};
 
-        // get needed win
-        for (int64_t knl_pix = 0; knl_pix < param_::knl_elms; ++knl_pix)
-            win_tmp.Set(win.Get(knl_pix).Get(chnl_p), knl_pix);
+        // get needed win (skips the dilated elements)
+        for (int64_t knl_row = 0; knl_row < param_::knl_rows; ++knl_row) {
+            for (int64_t knl_col = 0; knl_col < param_::knl_cols; ++knl_col) {
+                const int64_t win_pix = knl_row * (param_::dil_rows + 1) * param_::knl_sel_cols + knl_col * (param_::dil_cols + 1);
+                win_tmp.Set(win.Get(win_pix).Get(chnl_p), knl_row * param_::knl_cols + knl_col);
+            }
+        }
 
         // applies selected pool function on a single element
         switch (pool_type_) {
@@ -209,16 +229,22 @@ PoolTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept
         const int64_t chnl_v  = (i % param_::lat_chnls);
 
         // comp conditions for src and dst (TODO: delete template parameters except param_)
-        const auto cond = hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::knl_rows,
-                                                 param_::knl_cols, param_::pad_rows, param_::pad_cols, param_::dil_rows, param_::dil_cols>(
-            src_col, src_row);
+        const auto cond =
+            hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::src_row_vec_size,
+                                   param_::src_col_vec_size, param_::dst_row_vec_size, param_::dst_col_vec_size, param_::knl_win_rows,
+                                   param_::knl_win_cols, param_::knl_rows, param_::knl_cols, param_::pad_rows_up, param_::pad_rows_down,
+                                   param_::pad_cols_left, param_::pad_cols_right, param_::str_cols, param_::str_rows, param_::dil_rows,
+                                   param_::dil_cols>(src_col, src_row);
 
         // read next src vector
         hvx::util::StreamReadData<>(src, src_data, ptr_src, (cond.src_col && cond.src_row));
 
         // updates the win and its buffers (TODO: delete template parameters except param_)
-        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::knl_rows, param_::knl_cols, param_::dil_rows,
-                             param_::dil_cols>(src_row, src_col, chnl_v, 0, src_data, row_buf, src_buf, win_buf, win_dil, win);
+        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::ohd_cols, param_::knl_rows, param_::knl_cols,
+                             param_::dil_rows, param_::dil_cols, param_::str_rows, param_::str_cols, param_::knl_sel_rows,
+                             param_::knl_sel_cols, param_::knl_win_rows, param_::knl_win_cols, param_::knl_vec_rows, param_::knl_vec_cols,
+                             param_::knl_ovr_rows, param_::knl_ovr_cols, param_::dst_row_vec_size, param_::dst_col_vec_size, 1>(
+            src_row, src_col, chnl_v, 0, src_data, row_buf, src_buf, win_buf, win_dil, win);
 
         // applies pool function on an src vector
         hvx::nn::PoolComp<param_, pool_type_>(win, dst_data);
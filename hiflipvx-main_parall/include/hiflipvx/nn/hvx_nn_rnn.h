@@ -0,0 +1,300 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_rnn.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Recurrent layers (LSTM and GRU). The weights of all gates and of the src and the hidden state are fused into a single matrix that is
+ *  buffered on-chip, the hidden (and cell) state is kept on-chip between the time steps and between calls.
+ */
+
+#ifndef HVX_NN_RNN_H_
+#define HVX_NN_RNN_H_
+
+#include "impl/hvx_nn_rnn_dfixed.h"
+
+namespace hvx {
+namespace nn {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief All compile time parameters and checks for the recurrent layer. The weights are the src weights stacked on top of the
+ * recurrent weights ([src + hidden][gates][hidden], like the Keras "kernel" and "recurrent_kernel"). The bias contains the sum of the src
+ * and recurrent biases of each gate ([4][hidden]), the GRU keeps them apart for the new gate (update, reset, new src, new recurrent).
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the inputs
+         typename wgts_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the weights
+         typename bias_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the bias
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the outputs (hidden state)
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,   // batch size
+         typename seq_v                         = hvx::util::VectorParam<1, 1>,   // number of time steps per call
+         typename src_v                         = hvx::util::VectorParam<1, 1>,   // number of input features
+         typename hidden_v                      = hvx::util::VectorParam<1, 1>,   // number of hidden units
+         hvx::util::rnn_e cell_type_            = hvx::util::rnn_e::kLstm,        // LSTM or GRU cell
+         int64_t buf_wgts_                      = false,                          // if weights and bias are only read on the first call
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+struct RnnParam {
+    // gates (the GRU sums up the new gate separately for the src and the hidden state)
+    static constexpr auto cell_type  = cell_type_;
+    static constexpr auto wgts_gates = (cell_type_ == hvx::util::rnn_e::kLstm) ? (4) : (3);
+    static constexpr auto sum_gates  = 4;
+
+    // tensor parameters
+    using src_dim  = hvx::util::TensorParam<3, src_v, batch_v, seq_v>;
+    using dst_dim  = hvx::util::TensorParam<3, hidden_v, batch_v, seq_v>;
+    using wgts_dim = hvx::util::TensorParam<3,
+                                            hidden_v,
+                                            hvx::util::VectorParam<wgts_gates, wgts_gates>,
+                                            hvx::util::VectorParam<src_v::elms + hidden_v::elms, 1>>;
+    using bias_dim = hvx::util::TensorParam<2, hidden_v, hvx::util::VectorParam<sum_gates, sum_gates>>;
+
+    // dimensions
+    static constexpr auto batch           = batch_v::elms;
+    static constexpr auto seq             = seq_v::elms;
+    static constexpr auto src_elms        = src_v::elms;
+    static constexpr auto src_vec_size    = src_v::vec_size;
+    static constexpr auto src_vec_elms    = src_v::vec_elms;
+    static constexpr auto hidden          = hidden_v::elms;
+    static constexpr auto hidden_vec_size = hidden_v::vec_size;
+    static constexpr auto hidden_vec_elms = hidden_v::vec_elms;
+    static constexpr auto inner           = src_elms + hidden;
+    static constexpr auto buffer_wgts     = buf_wgts_;
+
+    // data types (the gates, the hidden and the cell state are computed with 20 fraction bits, or in floating-point)
+    using src_type   = src_type_;
+    using wgts_type  = wgts_type_;
+    using bias_type  = bias_type_;
+    using dst_type   = dst_type_;
+    using state_type = std::conditional_t<src_type_::is_int, hvx::util::dfixed<int32_t, 20>, hvx::util::def_flt_type_t<src_type_>>;
+    using comp_type  = std::conditional_t<src_type_::is_int, hvx::util::def_int_type_t<src_type_, wgts_type_>, state_type>;
+    using src_vec    = hvx::util::vector<src_type, src_dim::vec_size>;
+    using dst_vec    = hvx::util::vector<dst_type, dst_dim::vec_size>;
+    using wgts_vec   = hvx::util::vector<wgts_type, wgts_dim::vec_size>;
+    using bias_vec   = hvx::util::vector<bias_type, bias_dim::vec_size>;
+    using state_vec  = hvx::util::vector<state_type, hidden_vec_size>;
+    using src_port   = src_vec;
+    using dst_port   = dst_vec;
+    using wgts_port  = wgts_vec;
+    using bias_port  = bias_vec;
+
+    // summation parameters (all gates of a hidden vector are updated with one element of the concatenated input per iteration)
+    static constexpr auto sum_elms = sum_gates * hidden_vec_size;
+    static constexpr auto mults    = wgts_gates * hidden_vec_size;
+
+    // numerical stability
+    static constexpr auto overflow_type  = overflow_type_;
+    static constexpr auto underflow_type = underflow_type_;
+    static constexpr auto exec_type      = exec_type_;
+
+    // latency (the concatenated input [src, hidden state] is iterated for every hidden vector, batch and time step)
+    static constexpr auto lat_inner = inner;
+    static constexpr auto lat       = seq * batch * hidden_vec_elms * lat_inner;
+    static constexpr auto lat_delay = lat_inner - 1;
+
+    // constructor (verifies the dimensions and types)
+    constexpr RnnParam() {
+        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, true, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, true, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<wgts_dim, false, false, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<bias_dim, false, false, true, true, true, true>();
+        hvx::nn::impl::RnnVerifyType<src_type, wgts_type, bias_type, dst_type, state_type>();
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief the state of a recurrent layer instance
+ */
+template<typename param_>
+struct RnnState : hvx::util::LayerArena<RnnState<param_>> {
+    // buffers the fused weights ([inner][hidden_v]) and the bias [dont initialize]
+    hvx::util::array1d<typename param_::wgts_vec, param_::lat_inner * param_::hidden_vec_elms> wgts_buf;
+    hvx::util::array1d<typename param_::bias_vec, param_::hidden_vec_elms> bias_buf;
+    bool wgts_buffered = false;
+
+    // buffers the src of a time step, it is reused for all hidden vectors [dont initialize]
+    hvx::util::array1d<typename param_::src_vec, param_::src_vec_elms> src_buf;
+
+    // hidden state of the previous and of the current time step (double buffer), and the cell state of every batch [dont initialize]
+    hvx::util::array1d<typename param_::state_vec, 2 * param_::batch * param_::hidden_vec_elms> hidden_buf;
+    hvx::util::array1d<typename param_::state_vec, param_::batch * param_::hidden_vec_elms> cell_buf;
+
+    // buffers the sums of all gates of a hidden vector [dont initialize]
+    hvx::util::array1d<typename param_::comp_type, param_::sum_elms> sum;
+
+    // number of time steps in the sequence (the hidden and cell state are zero at the start of a sequence)
+    int64_t pos = 0;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+
+    /*!
+     * @brief starts a new sequence (the buffered weights are kept)
+     */
+    HVX_FORCE_INLINE auto Reset() noexcept -> void {
+        pos = 0;
+    }
+};
+
+/*!
+ * @brief next iteration of the recurrent layer (iterates over the concatenated input, then the hidden vectors, batches and time steps)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+RnnScheduleNext(int64_t& seq, int64_t& batch, int64_t& hidden_v, int64_t& inner) noexcept -> void {
+    HVX_INLINE_TOP();
+    if (inner < (param_::lat_inner - 1)) {
+        ++inner;
+    } else if (hidden_v < (param_::hidden_vec_elms - 1)) {
+        inner = 0;
+        ++hidden_v;
+    } else if (batch < (param_::batch - 1)) {
+        inner    = 0;
+        hidden_v = 0;
+        ++batch;
+    } else {
+        inner    = 0;
+        hidden_v = 0;
+        batch    = 0;
+        ++seq;
+    }
+}
+
+/*!
+ * @brief top function of the recurrent layer (the state of the layer instance is passed by the caller)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+RnnTop(hvx::nn::RnnState<param_>& state,
+       typename param_::src_port* src,
+       typename param_::wgts_port* wgts,
+       typename param_::bias_port* bias,
+       typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // directives for buffers
+    HVX_DATAPACK(state.wgts_buf.data, state.bias_buf.data, state.src_buf.data, state.hidden_buf.data, state.cell_buf.data);
+    HVX_ARRAY_PARTITION_COMPLETE(state.sum.data, 0);
+
+    // the weights and the bias are read from the ports in the first time step of the first batch
+    const bool read_wgts = (param_::buffer_wgts == false) || (state.wgts_buffered == false);
+
+    // iterates through the tensors (one element of the concatenated input [src, hidden state] per iteration)
+    int64_t ptr_src = 0, ptr_dst = 0;
+    int64_t seq = 0, batch = 0, hidden_v = 0, inner = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+
+        // buffer the src, weights, bias and dst vectors
+        typename param_::src_vec src_data{};
+        typename param_::wgts_vec wgts_data{};
+        typename param_::bias_vec bias_data{};
+        typename param_::dst_vec dst_data{};
+        typename param_::state_type inner_data{};
+        typename param_::state_vec hidden_prev{}, cell_prev{}, hidden_next{}, cell_next{};
+
+        // pointers to the buffers (the hidden state of the previous time step is in the other half of the double buffer)
+        const int64_t pos         = state.pos + seq;
+        const int64_t ptr_prev    = ((pos % 2) * param_::batch + batch) * param_::hidden_vec_elms;
+        const int64_t ptr_next    = (((pos + 1) % 2) * param_::batch + batch) * param_::hidden_vec_elms;
+        const int64_t ptr_cell    = batch * param_::hidden_vec_elms + hidden_v;
+        const int64_t ptr_wgts    = inner * param_::hidden_vec_elms + hidden_v;
+        const int64_t ptr_hidden  = inner - param_::src_elms;
+        const int64_t ptr_src_buf = inner / param_::src_vec_size;
+
+        // conditions (a src vector is read with the first hidden vector, a dst vector is written after the last input element)
+        const bool is_first  = (pos == 0);
+        const bool is_src    = (inner < param_::src_elms);
+        const bool cond_src  = is_src && (hidden_v == 0) && ((inner % param_::src_vec_size) == 0);
+        const bool cond_wgts = read_wgts && (seq == 0) && (batch == 0);
+        const bool cond_dst  = (inner == (param_::lat_inner - 1));
+
+        // read next src vector or get it from the buffer
+        hvx::util::StreamReadData<>(src, src_data, ptr_src, cond_src);
+        if (cond_src == true)
+            state.src_buf.Set(src_data, ptr_src_buf);
+        else if (is_src == true)
+            src_data = state.src_buf.Get(ptr_src_buf);
+
+        // read the weights or get them from the buffer
+        if (cond_wgts == true) {
+            wgts_data = wgts[ptr_wgts]; // NOLINT
+            state.wgts_buf.Set(wgts_data, ptr_wgts);
+        } else {
+            wgts_data = state.wgts_buf.Get(ptr_wgts);
+        }
+
+        // element of the concatenated input (the hidden state is zero at the start of a sequence)
+        if (is_src == true)
+            hvx::nn::impl::RnnCastSrc<param_>(src_data.Get(inner % param_::src_vec_size), inner_data);
+        else if (is_first == false)
+            inner_data = state.hidden_buf.Get(ptr_prev + ptr_hidden / param_::hidden_vec_size).Get(ptr_hidden % param_::hidden_vec_size);
+
+        // adds the products of all gates of the hidden vector
+        hvx::nn::impl::RnnMac<param_>(inner == 0, is_src, inner_data, wgts_data, state.sum);
+
+        // updates the hidden and cell state of the hidden vector
+        if (cond_dst == true) {
+            if (cond_wgts == true) {
+                bias_data = bias[hidden_v]; // NOLINT
+                state.bias_buf.Set(bias_data, hidden_v);
+            } else {
+                bias_data = state.bias_buf.Get(hidden_v);
+            }
+            if (is_first == false) {
+                hidden_prev = state.hidden_buf.Get(ptr_prev + hidden_v);
+                cell_prev   = state.cell_buf.Get(ptr_cell);
+            }
+            hvx::nn::impl::RnnCell<param_>(state.sum, bias_data, hidden_prev, cell_prev, hidden_next, cell_next, dst_data);
+            state.hidden_buf.Set(hidden_next, ptr_next + hidden_v);
+            state.cell_buf.Set(cell_next, ptr_cell);
+        }
+
+        // write next dst vector
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, cond_dst);
+
+        // next input element, hidden vector, batch and time step
+        hvx::nn::RnnScheduleNext<param_>(seq, batch, hidden_v, inner);
+    }
+    state.pos += param_::seq;
+    state.wgts_buffered = true;
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
+}
+
+/*!
+ * @brief top function of the recurrent layer (uses a single state for each parameter set, the sequence is continued by every call)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+RnnTop(typename param_::src_port* src,
+       typename param_::wgts_port* wgts,
+       typename param_::bias_port* bias,
+       typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::RnnState<param_> state;
+    hvx::nn::RnnTop<param_>(state, src, wgts, bias, dst);
+}
+
+/******************************************************************************************************************************************/
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_RNN_H_
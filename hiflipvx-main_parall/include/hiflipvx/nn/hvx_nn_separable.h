@@ -0,0 +1,335 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_separable.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Fused depthwise-separable block (depthwise conv followed by a 1x1 pointwise conv) as a single streaming layer. The depthwise results of
+ *  a dst pixel are fed directly into the pointwise MAC array, they are only buffered for one pixel (one vector per src chnl vector) to be
+ *  reused for the remaining dst fms. The activation of the epilogue is applied on both results after their bias was added, its scale and
+ *  shift only on the pointwise results: act(dw) for the depthwise stage and act(pw * scale + shift) for the pointwise stage.
+ */
+
+#ifndef HVX_NN_SEPARABLE_H_
+#define HVX_NN_SEPARABLE_H_
+
+#include "hvx_nn_conv.h"
+#include "hvx_nn_depthwise.h"
+
+namespace hvx {
+namespace nn {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief All compile time parameters and checks for the depthwise-separable function
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the inputs
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the outputs
+         typename wgts_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the weights (of both stages)
+         typename bias_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the bias (of both stages)
+         typename mid_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the depthwise results
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,   // batch size
+         typename src_rows_v                    = hvx::util::VectorParam<1, 1>,   // number of rows in the input tensor
+         typename src_cols_v                    = hvx::util::VectorParam<1, 1>,   // number of columns in the input tensor
+         typename chnls_v                       = hvx::util::VectorParam<1, 1>,   // number of channels (equal to input channels)
+         typename fms_v                         = hvx::util::VectorParam<1, 1>,   // number of feature maps (equal to output channels)
+         typename knl_rows_v                    = hvx::util::VectorParam<1, 1>,   // number of rows in the depthwise kernel
+         typename knl_cols_v                    = hvx::util::VectorParam<1, 1>,   // number of columns in the depthwise kernel
+         typename pad_                          = hvx::util::Array2dParam<0, 0>,  // number of zeros added on (Y/X)-axis on both sides
+         typename dil_                          = hvx::util::Array2dParam<0, 0>,  // gap between two kernel elements in (Y/X)-direction
+         typename str_                          = hvx::util::Array2dParam<1, 1>,  // number of elements a window moves in (Y/X)-direction
+         int64_t buf_wgts_                      = false,                          // if weights should be internally buffered on first read
+         int64_t buf_bias_                      = false,                          // if bias should be buffered internally on first read
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         typename epilogue_                     = hvx::util::EpilogueParam<>> // activation of both stages, scale/shift of the pointwise stage
+struct SeparableParam {
+    // the depthwise stage only applies the activation of the epilogue (the scale and shift are applied once, on the pointwise results)
+    using dw_epilogue = hvx::util::EpilogueParam<epilogue_::act, hvx::util::RatioParam<1, 1>, hvx::util::RatioParam<0, 1>,
+                                                 typename epilogue_::arg1, typename epilogue_::arg2>;
+
+    // parameters of the depthwise stage and of the pointwise stage (1x1 conv on the depthwise results)
+    using dw_param = hvx::nn::DepthwiseParam<src_type_, mid_type_, wgts_type_, bias_type_, batch_v, src_rows_v, src_cols_v, chnls_v,
+                                             knl_rows_v, knl_cols_v, pad_, dil_, str_, buf_wgts_, buf_bias_, overflow_type_,
+                                             underflow_type_, exec_type_, dw_epilogue>;
+    using pw_param = hvx::nn::ConvParam<mid_type_, dst_type_, wgts_type_, bias_type_, batch_v, typename dw_param::dst_rows_v,
+                                        typename dw_param::dst_cols_v, chnls_v, fms_v, hvx::util::VectorParam<1, 1>,
+                                        hvx::util::VectorParam<1, 1>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<0, 0>,
+                                        hvx::util::Array2dParam<1, 1>, buf_wgts_, buf_bias_, overflow_type_, underflow_type_, exec_type_,
+                                        hvx::util::conv_e::kDirect, epilogue_>;
+
+    // tensor parameters
+    using src_dim     = typename dw_param::src_dim;
+    using mid_dim     = typename dw_param::dst_dim;
+    using dst_dim     = typename pw_param::dst_dim;
+    using dw_wgts_dim = typename dw_param::wgts_dim;
+    using dw_bias_dim = typename dw_param::bias_dim;
+    using pw_wgts_dim = typename pw_param::wgts_dim;
+    using pw_bias_dim = typename pw_param::bias_dim;
+
+    // dimensions
+    static constexpr auto batch            = batch_v::elms;
+    static constexpr auto src_rows         = dw_param::src_rows;
+    static constexpr auto src_row_vec_size = dw_param::src_row_vec_size;
+    static constexpr auto src_cols         = dw_param::src_cols;
+    static constexpr auto dst_rows         = dw_param::dst_rows;
+    static constexpr auto dst_cols         = dw_param::dst_cols;
+    static constexpr auto chnls            = chnls_v::elms;
+    static constexpr auto chnl_vec_size    = chnls_v::vec_size;
+    static constexpr auto chnl_vec_elms    = chnls_v::elms / chnls_v::vec_size;
+    static constexpr auto fms              = fms_v::elms;
+    static constexpr auto fm_vec_size      = fms_v::vec_size;
+    static constexpr auto fm_vec_elms      = fms_v::elms / fms_v::vec_size;
+
+    // data types
+    using src_type     = src_type_;
+    using dst_type     = dst_type_;
+    using wgts_type    = wgts_type_;
+    using bias_type    = bias_type_;
+    using mid_type     = mid_type_;
+    using src_vec      = typename dw_param::src_vec;
+    using mid_vec      = typename dw_param::dst_vec;
+    using dst_vec      = typename pw_param::dst_vec;
+    using dw_wgts_vec  = typename dw_param::wgts_vec;
+    using dw_bias_vec  = typename dw_param::bias_vec;
+    using pw_wgts_vec  = typename pw_param::wgts_vec;
+    using pw_bias_vec  = typename pw_param::bias_vec;
+    using src_port     = src_vec;
+    using dst_port     = dst_vec;
+    using dw_wgts_port = dw_wgts_vec;
+    using dw_bias_port = dw_bias_vec;
+    using pw_wgts_port = pw_wgts_vec;
+    using pw_bias_port = pw_bias_vec;
+
+    // window (kernel) parameters of the depthwise stage
+    static constexpr auto knl_rows     = dw_param::knl_rows;
+    static constexpr auto knl_cols     = dw_param::knl_cols;
+    static constexpr auto knl_elms     = dw_param::knl_elms;
+    static constexpr auto knl_dil_rows = dw_param::knl_dil_rows;
+    static constexpr auto pad_rows_up  = dw_param::pad_rows_up;
+
+    // buffers the depthwise results of one dst pixel
+    static constexpr auto mid_buf_elms = chnl_vec_elms;
+    static constexpr auto buffer_wgts  = buf_wgts_;
+    static constexpr auto buffer_bias  = buf_bias_;
+
+    // multipliers of the datapath (both stages) and products summed up in one cycle (the adder trees of both stages are in series)
+    static constexpr auto mults    = dw_param::knl_elms * chnl_vec_size + pw_param::mults;
+    static constexpr auto sum_elms = dw_param::knl_elms * pw_param::sum_elms;
+
+    // numerical stability
+    static constexpr auto overflow_type  = overflow_type_;
+    static constexpr auto underflow_type = underflow_type_;
+    static constexpr auto exec_type      = exec_type_;
+
+    // fused epilogue (of the pointwise stage, the depthwise stage uses dw_epilogue)
+    using epilogue = epilogue_;
+
+    // latency (iteration-skipping schedule: src positions without a dst only read their src vectors into the window, the dst fms are
+    // only iterated at src positions that produce a dst)
+    static constexpr auto lat_rows     = dw_param::lat_rows;
+    static constexpr auto lat_cols     = dw_param::lat_cols;
+    static constexpr auto lat_chnls    = chnl_vec_elms;
+    static constexpr auto lat_fms      = fm_vec_elms;
+    static constexpr auto lat_knls     = 1;
+    static constexpr auto lat_wait_fms = 1;
+    static constexpr auto lat_dst_pix  = batch * dst_rows * dst_cols;
+    static constexpr auto lat_src_pix  = batch * lat_rows * lat_cols;
+    static constexpr auto lat          = (lat_dst_pix * lat_fms + (lat_src_pix - lat_dst_pix) * lat_wait_fms) * lat_chnls;
+
+    // constructor (verifies the dimensions and types, the stages verify their own parameters)
+    constexpr SeparableParam() {
+        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, true, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, true, true, true, true, true>();
+        hvx::nn::impl::DepthwiseVerifyTypes<src_type, wgts_type, bias_type, mid_type>();
+        hvx::nn::impl::ConvVerifyType<mid_type, wgts_type, bias_type, dst_type>();
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief the state of a depthwise-separable layer instance (buffered weights/bias of both stages, line buffers, window and the depthwise
+ * results of the current dst pixel)
+ */
+template<typename param_>
+struct SeparableState : hvx::util::LayerArena<SeparableState<param_>> {
+    using dw_param = typename param_::dw_param;
+    using pw_param = typename param_::pw_param;
+
+    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
+    hvx::util::array1d<typename param_::dw_wgts_vec, dw_param::wgts_vec_elms> dw_wgts_buf;
+    hvx::util::array1d<typename param_::dw_bias_vec, dw_param::bias_vec_elms> dw_bias_buf;
+    hvx::util::array1d<typename param_::pw_wgts_vec, pw_param::wgts_vec_elms> pw_wgts_buf;
+    hvx::util::array1d<typename param_::pw_bias_vec, pw_param::bias_vec_elms> pw_bias_buf;
+    bool dw_wgts_buffered = false, dw_bias_buffered = false, pw_wgts_buffered = false, pw_bias_buffered = false;
+
+    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
+    hvx::util::array2d<typename param_::src_vec, dw_param::row_buf_elms, dw_param::row_buf_num> row_buf;
+    hvx::util::array2d<typename param_::src_vec, dw_param::win_buf_elms, dw_param::win_buf_num> win_buf;
+    hvx::util::array2d<typename param_::src_vec, dw_param::src_buf_elms, dw_param::src_buf_num> src_buf;
+    hvx::util::array1d<typename param_::src_vec, dw_param::win_elms> win;
+    hvx::util::array1d<typename param_::src_vec, dw_param::win_dil_elms> win_dil;
+
+    // buffers the depthwise results of one dst pixel, the 1x1 window of the pointwise stage and the global sum for one dst vector
+    // [dont initialize]
+    hvx::util::array1d<typename param_::mid_vec, param_::mid_buf_elms> mid_buf;
+    hvx::util::array1d<typename pw_param::chnl_vec, pw_param::win_elms> pw_win;
+    hvx::util::array1d<typename pw_param::comp_vec, pw_param::sum_global_elms> sum_global;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+
+    /*!
+     * @brief weights and bias are read again on the next execution
+     */
+    HVX_FORCE_INLINE auto Reset() noexcept -> void {
+        dw_wgts_buffered = false;
+        dw_bias_buffered = false;
+        pw_wgts_buffered = false;
+        pw_bias_buffered = false;
+    }
+};
+
+/*!
+ * @brief top function of the depthwise-separable layer (the state of the layer instance is passed by the caller). The depthwise result of
+ * a src chnl vector is computed with the first dst fm of a dst pixel and buffered for the remaining dst fms, the pointwise stage sums it
+ * up like the src chnl vector of a 1x1 conv.
+ */
+template<typename param_, bool with_bias_ = false>
+HVX_FORCE_INLINE auto
+SeparableTop(hvx::nn::SeparableState<param_>& state,
+             typename param_::src_port* src,
+             typename param_::dw_wgts_vec* dw_wgts,
+             typename param_::dw_bias_vec* dw_bias,
+             typename param_::pw_wgts_vec* pw_wgts,
+             typename param_::pw_bias_vec* pw_bias,
+             typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    using dw_param = typename param_::dw_param;
+    using pw_param = typename param_::pw_param;
+
+    // directives for buffers and windows
+    HVX_DATAPACK(state.dw_wgts_buf.data, state.dw_bias_buf.data, state.pw_bias_buf.data, state.row_buf.data, state.win_buf.data,
+                 state.src_buf.data, state.win.data, state.win_dil.data, state.mid_buf.data, state.pw_win.data);
+    HVX_ARRAY_PARTITION_COMPLETE(state.row_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.src_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_dil.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.pw_win.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.sum_global.data, 0);
+
+    // iterates through the tensor vector by vector (flattened loop, the dst fms are only iterated at src positions that produce a dst)
+    int64_t ptr_src = 0, ptr_dst = 0;
+    int64_t src_row = 0, src_col = 0, fm_v = 0, knl_v = 0, chnl_v = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+
+        // buffer the src, mid, dst, wgts and bias vectors
+        typename param_::src_vec src_data{};
+        typename param_::mid_vec mid_data{};
+        typename param_::dst_vec dst_data{};
+        typename param_::dw_wgts_vec dw_wgts_data{};
+        typename param_::dw_bias_vec dw_bias_data{};
+        typename param_::pw_wgts_vec pw_wgts_data{};
+        typename param_::pw_bias_vec pw_bias_data{};
+
+        // comp conditions for src and dst (TODO: delete template parameters except param_)
+        const auto cond =
+            hvx::util::WinCompCond<dw_param::src_rows, dw_param::src_cols, dw_param::dst_rows, dw_param::dst_cols,
+                                   dw_param::src_row_vec_size, dw_param::src_col_vec_size, dw_param::dst_row_vec_size,
+                                   dw_param::dst_col_vec_size, dw_param::knl_win_rows, dw_param::knl_win_cols, dw_param::knl_rows,
+                                   dw_param::knl_cols, dw_param::pad_rows_up, dw_param::pad_rows_down, dw_param::pad_cols_left,
+                                   dw_param::pad_cols_right, dw_param::str_cols, dw_param::str_rows, dw_param::dil_rows,
+                                   dw_param::dil_cols>(src_col, src_row);
+        const bool cond_dst  = (cond.dst_row && cond.dst_col);
+        const bool cond_chnl = (fm_v == 0);
+        const bool cond_fm   = (chnl_v == (param_::chnl_vec_elms - 1));
+
+        // the weights/bias of the depthwise stage are indexed by the src chnl vector of the dst pixel (only read with the first dst fm)
+        const int64_t ptr_mid = (ptr_dst / param_::fm_vec_elms) * param_::chnl_vec_elms + chnl_v;
+
+        // read next src vector
+        hvx::util::StreamReadData<>(src, src_data, ptr_src, (cond.src_row && cond.src_col && cond_chnl));
+
+        // updates the window and its buffers (the src vector is buffered for the remaining dst fms)
+        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, dw_param::ohd_cols, dw_param::knl_rows,
+                             dw_param::knl_cols, dw_param::dil_rows, dw_param::dil_cols, dw_param::str_rows, dw_param::str_cols,
+                             dw_param::knl_sel_rows, dw_param::knl_sel_cols, dw_param::knl_win_rows, dw_param::knl_win_cols,
+                             dw_param::knl_vec_rows, dw_param::knl_vec_cols, dw_param::knl_ovr_rows, dw_param::knl_ovr_cols,
+                             dw_param::dst_row_vec_size, dw_param::dst_col_vec_size, param_::fm_vec_elms>(
+            src_row, src_col, chnl_v, fm_v, src_data, state.row_buf, state.src_buf, state.win_buf, state.win_dil, state.win, !cond_dst);
+
+        // read weights and bias vectors of both stages (TODO: delete template parameters except param_)
+        hvx::util::WeightsUpdate<typename param_::wgts_type, dw_param::wgts_vec_size, 1, param_::chnl_vec_elms, param_::buffer_wgts>(
+            0, chnl_v, ptr_mid, state.dw_wgts_buffered, (cond_dst && cond_chnl), dw_wgts, state.dw_wgts_buf, dw_wgts_data);
+        hvx::util::BiasUpdate<typename param_::bias_type, param_::chnl_vec_size, dw_param::bias_vec_elms, param_::buffer_bias>(
+            ptr_mid, state.dw_bias_buffered, (with_bias_ && cond_dst && cond_chnl), dw_bias, state.dw_bias_buf, dw_bias_data);
+        hvx::util::WeightsUpdate<typename param_::wgts_type, pw_param::wgts_vec_size, param_::chnl_vec_elms, param_::fm_vec_elms,
+                                 param_::buffer_wgts>(chnl_v, fm_v, ptr_dst, state.pw_wgts_buffered, cond_dst, pw_wgts, state.pw_wgts_buf,
+                                                      pw_wgts_data);
+        hvx::util::BiasUpdate<typename param_::bias_type, param_::fm_vec_size, pw_param::bias_vec_elms, param_::buffer_bias>(
+            ptr_dst, state.pw_bias_buffered, (with_bias_ && cond_dst && cond_fm), pw_bias, state.pw_bias_buf, pw_bias_data);
+
+        // applies the depthwise function with the first dst fm, the remaining dst fms reuse its buffered result
+        if (cond_dst == true) {
+            if (cond_chnl == true) {
+                hvx::nn::DepthwiseComp<dw_param>(state.win, dw_wgts_data, dw_bias_data, mid_data);
+                state.mid_buf.Set(mid_data, chnl_v);
+            } else {
+                mid_data = state.mid_buf.Get(chnl_v);
+            }
+        }
+
+        // applies the pointwise function on the depthwise result (the 1x1 window of the pointwise stage)
+        state.pw_win.Set(mid_data, 0);
+        if (cond_dst == true)
+            hvx::nn::ConvComp<pw_param>(chnl_v, 0, state.sum_global, state.pw_win, pw_wgts_data, pw_bias_data, dst_data);
+
+        // write next dst vector
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, (cond_dst && cond_fm));
+
+        // next src chnl, dst fm and src position
+        hvx::nn::ConvScheduleNext<param_>(cond_dst, src_row, src_col, fm_v, knl_v, chnl_v);
+    }
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
+}
+
+/*!
+ * @brief top function of the depthwise-separable layer (uses a single state for each parameter set)
+ */
+template<typename param_, bool with_bias_ = false>
+HVX_FORCE_INLINE auto
+SeparableTop(typename param_::src_port* src,
+             typename param_::dw_wgts_vec* dw_wgts,
+             typename param_::dw_bias_vec* dw_bias,
+             typename param_::pw_wgts_vec* pw_wgts,
+             typename param_::pw_bias_vec* pw_bias,
+             typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::SeparableState<param_> state;
+    hvx::nn::SeparableTop<param_, with_bias_>(state, src, dw_wgts, dw_bias, pw_wgts, pw_bias, dst);
+}
+
+/******************************************************************************************************************************************/
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_SEPARABLE_H_
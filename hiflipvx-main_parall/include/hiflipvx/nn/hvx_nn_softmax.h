@@ -43,7 +43,8 @@ template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>
          typename chnls_v                       = hvx::util::VectorParam<1, 1>,
          hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
          hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
-         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact>
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         hvx::util::softmax_e softmax_type_     = hvx::util::softmax_e::kTwoPass>
 struct SoftmaxParam {
     // tensor parameters
     using src_dim = hvx::util::TensorParam<4, chnls_v, src_cols_v, src_rows_v, batch_v>;
@@ -73,12 +74,19 @@ struct SoftmaxParam {
     static constexpr auto underflow_type = underflow_type_;
     static constexpr auto exec_type      = exec_type_;
 
+    // computation scheme (kOnline normalizes the previous pixel while reading the next one, using a ping-pong buffer)
+    static constexpr auto softmax_type = softmax_type_;
+    static constexpr auto pixels       = batch * src_rows * src_cols;
+    static constexpr auto buf_elms     = (softmax_type == hvx::util::softmax_e::kOnline) ? (2 * chnl_vec_elms) : (chnl_vec_elms);
+
     // latency
-    static constexpr auto lat = 2 * batch * src_rows * src_cols * chnl_vec_elms;
+    static constexpr auto lat = (softmax_type == hvx::util::softmax_e::kOnline) ? ((pixels + 1) * chnl_vec_elms)
+                                                                                : (2 * pixels * chnl_vec_elms);
 
-    // block processing (bp) to prevent loop dependency by summation
+    // block processing (bp) to prevent loop dependency by summation (kOnline: running max and sum per block, merged per pixel)
     // hvx::util::Min(chnl_vec_elms_, static_cast<int64_t>((hvx::util::is_dfixed_v<src_type_>) ? (1) : (8)));
-    static constexpr auto bp_width = 1;
+    static constexpr auto bp_width =
+        (softmax_type == hvx::util::softmax_e::kOnline) ? (hvx::util::Min(chnl_vec_elms, static_cast<decltype(chnl_vec_elms)>(4))) : (1);
 
     // constructor (verifies the dimensions and data types)
     constexpr SoftmaxParam() {
@@ -142,20 +150,99 @@ SoftmaxCompStage2(int64_t chnl_v,
 }
 
 /*!
- * @brief
+ * @brief the state of a softmax layer instance
  */
 template<typename param_>
+struct SoftmaxState : hvx::util::LayerArena<SoftmaxState<param_>> {
+    // buffers the exponential of all incoming values [dont initialize]
+    hvx::util::array1d<typename param_::buf_vec, param_::buf_elms> wgts_buf;
+
+    // buffers the global sum  [dont initialize]
+    hvx::util::array1d<typename param_::comp_type, param_::bp_width> sum_global;
+
+    // online softmax: max of each buffered vector, running max/sum per block, max/inverse sum of the previous pixel [dont initialize]
+    hvx::util::array1d<typename param_::buf_type, param_::buf_elms> max_buf;
+    hvx::util::array1d<typename param_::buf_type, param_::bp_width> run_max;
+    hvx::util::array1d<typename param_::buf_type, param_::bp_width> run_sum;
+    typename param_::buf_type fin_max;
+    typename param_::buf_type fin_inv;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+};
+
+/*!
+ * @brief top function of the softmax layer using the online softmax (the state of the layer instance is passed by the caller)
+ */
+template<typename param_, std::enable_if_t<param_::softmax_type == hvx::util::softmax_e::kOnline, bool> = true>
 HVX_FORCE_INLINE auto
-SoftmaxTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+SoftmaxTop(hvx::nn::SoftmaxState<param_>& state, typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
     HVX_INLINE_TOP();
+    HVX_DATAPACK(state.wgts_buf.data);
+    HVX_ARRAY_PARTITION_COMPLETE(state.run_max.data, 0);
+    HVX_ARRAY_PARTITION_COMPLETE(state.run_sum.data, 0);
+    HVX_FALSE_DEPENDENCE(state.wgts_buf.data);
+    HVX_FALSE_DEPENDENCE(state.max_buf.data);
+    auto& exp_buf = state.wgts_buf;
+    auto& max_buf = state.max_buf;
+    auto& run_max = state.run_max;
+    auto& run_sum = state.run_sum;
+    auto& fin_max = state.fin_max;
+    auto& fin_inv = state.fin_inv;
+
+    // Softmax Computation (reads pixel "pixel" and writes pixel "pixel - 1")
+    int64_t ptr_src = 0, ptr_dst = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
 
-    // buffers the exponential of all incoming values [dont initialize]
-    static hvx::util::array1d<typename param_::buf_vec, param_::chnl_vec_elms> wgts_buf;
-    HVX_DATAPACK(wgts_buf.data);
+        // flattening loop to improve latency
+        const int64_t pixel  = i / param_::chnl_vec_elms;
+        const int64_t chnl_v = i % param_::chnl_vec_elms;
+        const int64_t bp     = chnl_v % param_::bp_width;
+        const int64_t ptr_rd = (pixel & 1) * param_::chnl_vec_elms + chnl_v;
+        const int64_t ptr_wr = ((pixel + 1) & 1) * param_::chnl_vec_elms + chnl_v;
+        const bool cond_rd   = (pixel < param_::pixels);
+        const bool cond_wr   = (pixel > 0);
 
-    // buffers the global sum  [dont initialize]
-    static hvx::util::array1d<typename param_::comp_type, param_::bp_width> sum_global;
-    HVX_ARRAY_PARTITION_COMPLETE(sum_global.data, 0);
+        // buffer the src and dst vectors
+        typename param_::src_vec src_data{};
+        typename param_::buf_vec exp_data{};
+        typename param_::buf_type vec_max{};
+        typename param_::dst_vec dst_data{};
+
+        // calculates: m(i) = n(i) * exp(m - M) / S (previous pixel)
+        if (cond_wr) {
+            exp_data = exp_buf.Get(ptr_wr);
+            vec_max  = max_buf.Get(ptr_wr);
+            hvx::nn::impl::SoftmaxOnlineStage2<param_>(exp_data, vec_max, fin_max, fin_inv, dst_data);
+            hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, true);
+        }
+
+        // calculates: n(i) = exp(src(i) - m) | M: running max, S: running sum of all n (current pixel)
+        if (cond_rd) {
+            hvx::util::StreamReadData<>(src, src_data, ptr_src, true);
+            hvx::nn::impl::SoftmaxOnlineStage1<param_>(chnl_v < param_::bp_width, src_data, exp_data, vec_max, run_max.Get(bp),
+                                                       run_sum.Get(bp));
+            exp_buf.Set(exp_data, ptr_rd);
+            max_buf.Set(vec_max, ptr_rd);
+            if (chnl_v == (param_::chnl_vec_elms - 1))
+                hvx::nn::impl::SoftmaxOnlineFinal<param_>(run_max, run_sum, fin_max, fin_inv);
+        }
+    }
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
+}
+
+/*!
+ * @brief top function of the softmax layer (the state of the layer instance is passed by the caller)
+ */
+template<typename param_, std::enable_if_t<param_::softmax_type == hvx::util::softmax_e::kTwoPass, bool> = true>
+HVX_FORCE_INLINE auto
+SoftmaxTop(hvx::nn::SoftmaxState<param_>& state, typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    HVX_DATAPACK(state.wgts_buf.data);
+    HVX_ARRAY_PARTITION_COMPLETE(state.sum_global.data, 0);
+    auto& wgts_buf   = state.wgts_buf;
+    auto& sum_global = state.sum_global;
 
     // Softmax Computation
     int64_t ptr_src = 0, ptr_dst = 0;
@@ -188,6 +275,17 @@ SoftmaxTop(typename param_::src_port* src, typename param_::dst_port* dst) noexc
     hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
 }
 
+/*!
+ * @brief top function of the softmax layer (uses a single state for each parameter set)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+SoftmaxTop(typename param_::src_port* src, typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::SoftmaxState<param_> state;
+    hvx::nn::SoftmaxTop<param_>(state, src, dst);
+}
+
 /******************************************************************************************************************************************/
 } // namespace nn
 } // namespace hvx
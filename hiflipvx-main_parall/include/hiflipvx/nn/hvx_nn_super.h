@@ -167,6 +167,7 @@ struct SuperParam {
     static constexpr auto overflow_type  = overflow_type_;
     static constexpr auto underflow_type = underflow_type_;
     static constexpr auto exec_type      = exec_type_;
+    using epilogue                       = hvx::util::EpilogueParam<>; // no fused epilogue
 
     // latency
     static constexpr auto lat_bats = batch_vec_elms;  
@@ -176,7 +177,12 @@ struct SuperParam {
     static constexpr auto lat_cols  = src_col_vec_elms + ohd_cols;
     static constexpr auto lat_chnls = chnl_vec_elms;
     static constexpr auto lat_fms = fm_vec_elms;
-    static constexpr auto lat     = lat_bats * lat_rows * lat_cols * lat_chnls * lat_fms;
+    static constexpr auto lat_full = lat_bats * lat_rows * lat_cols * lat_chnls * lat_fms;
+
+    // iteration-skipping schedule (src positions without a dst only iterate over the src chnls)
+    static constexpr auto lat_dst_pix = lat_bats * dst_row_vec_elms * dst_col_vec_elms;
+    static constexpr auto lat_src_pix = lat_bats * lat_rows * lat_cols;
+    static constexpr auto lat         = (lat_dst_pix * lat_fms + (lat_src_pix - lat_dst_pix)) * lat_chnls;
 
     // buffer parameters
     static constexpr auto buf_bats = batch_vec_size;
@@ -192,6 +198,12 @@ struct SuperParam {
     static constexpr auto buffer_wgts  = buf_wgts_;
     static constexpr auto buffer_bias  = buf_bias_;
 
+    // parameters for a single batch vector
+    using sample_param =
+        SuperParam<src_type_, dst_type_, wgts_type_, bias_type_, hvx::util::VectorParam<batch_vec_size, batch_vec_size>, src_rows_v,
+                   src_cols_v, chnls_v, fms_v, knl_rows_v, knl_cols_v, pad_rows, pad_cols, dil_, str_, buf_wgts_, buf_bias_, overflow_type_,
+                   underflow_type_, exec_type_, layer_type_, pool_type_>;
+
     // constructor (verifies the dimensions and types)
     constexpr SuperParam() {
         // TODO: implement the possibility that the kernel does not have to be vectorized
@@ -358,11 +370,68 @@ SuperComp(int64_t chnl_v,
 }
 
 /*!
- * @brief top function of the conv layer
+ * @brief the state of a super layer instance (buffered weights/bias, line buffers and windows)
+ */
+template<typename param_>
+struct SuperState : hvx::util::LayerArena<SuperState<param_>> {
+    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
+    hvx::util::array1d<typename param_::wgts_vec, param_::wgts_vec_elms> wgts_buf;
+    hvx::util::array1d<typename param_::bias_vec, param_::bias_vec_elms> bias_buf;
+    bool wgts_buffered = false, bias_buffered = false;
+
+    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
+    hvx::util::array2d<typename param_::src_vec, param_::row_buf_elms, param_::row_buf_num> row_buf1;
+    hvx::util::array2d<typename param_::src_vec, param_::win_buf_elms, param_::win_buf_num> win_buf1;
+    hvx::util::array2d<typename param_::src_vec, param_::src_buf_elms, param_::src_buf_num> src_buf1;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_elms> win1;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_dil_elms> win_dil1;
+
+    hvx::util::array2d<typename param_::src_vec, param_::row_buf_elms, param_::row_buf_num> row_buf2;
+    hvx::util::array2d<typename param_::src_vec, param_::win_buf_elms, param_::win_buf_num> win_buf2;
+    hvx::util::array2d<typename param_::src_vec, param_::src_buf_elms, param_::src_buf_num> src_buf2;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_elms> win2;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_dil_elms> win_dil2;
+    // buffers the global sum for one dst vector [dont initialize]
+    hvx::util::array1d<typename param_::comp_vec, param_::sum_global_elms> sum_global;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+
+    /*!
+     * @brief weights and bias are read again on the next execution
+     */
+    HVX_FORCE_INLINE auto Reset() noexcept -> void {
+        wgts_buffered = false;
+        bias_buffered = false;
+    }
+};
+
+/*!
+ * @brief advances the loop counters of the iteration-skipping schedule (src positions without a dst only iterate over the src chnls,
+ * src positions with a dst iterate over the src chnls for every dst fm)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+SuperScheduleNext(bool cond_dst, int64_t& src_row, int64_t& src_col, int64_t& fm_i, int64_t& chnl_v) noexcept -> void {
+    HVX_INLINE_TOP();
+    const int64_t fm_elms = (cond_dst == true) ? (param_::lat_fms) : (1);
+    const bool last_chnl  = (chnl_v == (param_::lat_chnls - 1));
+    const bool last_fm    = last_chnl && (fm_i == (fm_elms - 1));
+    const bool last_col   = last_fm && (src_col == (param_::lat_cols - 1));
+    const bool last_row   = last_col && (src_row == (param_::lat_rows - 1));
+    chnl_v                = (last_chnl == true) ? (0) : (chnl_v + 1);
+    fm_i                  = (last_fm == true) ? (0) : ((last_chnl == true) ? (fm_i + 1) : (fm_i));
+    src_col               = (last_col == true) ? (0) : ((last_fm == true) ? (src_col + 1) : (src_col));
+    src_row               = (last_row == true) ? (0) : ((last_col == true) ? (src_row + 1) : (src_row));
+}
+
+/*!
+ * @brief top function of the super layer (the state of the layer instance is passed by the caller)
  */
 template<typename param_, bool with_bias_ = false, hvx::util::pooling_e pool_type_, hvx::util::layer_e layer_type_>
 HVX_FORCE_INLINE auto
-SuperTop(typename param_::src_port* src1,
+SuperTop(hvx::nn::SuperState<param_>& state,
+         typename param_::src_port* src1,
          typename param_::src2_port* src2,
          typename param_::wgts_vec* wgts,
          typename param_::bias_vec* bias,
@@ -370,113 +439,131 @@ SuperTop(typename param_::src_port* src1,
          typename param_::dst2_port* dst2) noexcept -> void {
     HVX_INLINE_TOP();
 
-    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
-    static hvx::util::array1d<typename param_::wgts_vec, param_::wgts_vec_elms> wgts_buf;
-    static hvx::util::array1d<typename param_::bias_vec, param_::bias_vec_elms> bias_buf;
-    static bool wgts_buffered_ = false, bias_buffered_ = false;
-
-    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
-    static hvx::util::array2d<typename param_::src_vec, param_::row_buf_elms, param_::row_buf_num> row_buf1;
-    static hvx::util::array2d<typename param_::src_vec, param_::win_buf_elms, param_::win_buf_num> win_buf1;
-    static hvx::util::array2d<typename param_::src_vec, param_::src_buf_elms, param_::src_buf_num> src_buf1;
-    static hvx::util::array1d<typename param_::chnl_vec, param_::win_elms> win1;
-    static hvx::util::array1d<typename param_::chnl_vec, param_::win_dil_elms> win_dil1;
-
-    static hvx::util::array2d<typename param_::src_vec, param_::row_buf_elms, param_::row_buf_num> row_buf2;
-    static hvx::util::array2d<typename param_::src_vec, param_::win_buf_elms, param_::win_buf_num> win_buf2;
-    static hvx::util::array2d<typename param_::src_vec, param_::src_buf_elms, param_::src_buf_num> src_buf2;
-    static hvx::util::array1d<typename param_::chnl_vec, param_::win_elms> win2;
-    static hvx::util::array1d<typename param_::chnl_vec, param_::win_dil_elms> win_dil2;
-    // buffers the global sum for one dst vector [dont initialize]
-    static hvx::util::array1d<typename param_::comp_vec, param_::sum_global_elms> sum_global;
-
     // directives for buffers and windows
-    HVX_DATAPACK(bias_buf.data, row_buf1.data, win_buf1.data, src_buf1.data, win1.data, win_dil1.data, row_buf2.data, win_buf2.data, src_buf2.data, win2.data, win_dil2.data); // wgts_buf.data,
-    HVX_ARRAY_PARTITION_COMPLETE(row_buf1.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_buf1.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(src_buf1.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win1.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_dil1.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(row_buf2.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_buf2.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(src_buf2.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win2.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_dil2.data, 1);    
-    HVX_ARRAY_PARTITION_COMPLETE(sum_global.data, 0);
-
-    // iterates through the tensor vector by vector
+    HVX_DATAPACK(state.bias_buf.data, state.row_buf1.data, state.win_buf1.data, state.src_buf1.data, state.win1.data, state.win_dil1.data,
+                 state.row_buf2.data, state.win_buf2.data, state.src_buf2.data, state.win2.data, state.win_dil2.data); // wgts_buf.data,
+    HVX_ARRAY_PARTITION_COMPLETE(state.row_buf1.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_buf1.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.src_buf1.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win1.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_dil1.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.row_buf2.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_buf2.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.src_buf2.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win2.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_dil2.data, 1);    
+    HVX_ARRAY_PARTITION_COMPLETE(state.sum_global.data, 0);
+
+    // references to the state of the layer instance
+    bool& wgts_buffered_ = state.wgts_buffered;
+    bool& bias_buffered_ = state.bias_buffered;
+    auto& wgts_buf       = state.wgts_buf;
+    auto& bias_buf       = state.bias_buf;
+    auto& row_buf1       = state.row_buf1;
+    auto& win_buf1       = state.win_buf1;
+    auto& src_buf1       = state.src_buf1;
+    auto& win1           = state.win1;
+    auto& win_dil1       = state.win_dil1;
+    auto& row_buf2       = state.row_buf2;
+    auto& win_buf2       = state.win_buf2;
+    auto& src_buf2       = state.src_buf2;
+    auto& win2           = state.win2;
+    auto& win_dil2       = state.win_dil2;
+    auto& sum_global     = state.sum_global;
+
+    // iterates through the tensor vector by vector (flattened loop, the dst fms are only iterated at src positions that produce a dst)
     int64_t ptr_src1 = 0, ptr_src2 = 0, ptr_dst1 = 0, ptr_dst2 = 0;
-    for (int64_t sample = 0; sample < param_::lat_bats; ++sample) {
-        for (int64_t ptr_pix = 0; ptr_pix < param_::lat_cols * param_::lat_rows; ++ptr_pix) {
-            for (int64_t ptr_wgt = 0; ptr_wgt < param_::lat_chnls * param_::lat_fms; ++ptr_wgt) {
-                HVX_PIPELINE_ON(1, frp);
-                // HVX_PRAGMA(HLS dependence variable = sum_global type = inter distance = param_::sum_global_elms true)
-
-                // HVX_PRAGMA(HLS dependence variable = sum_global type = inter direction = WAW|WAR distance = 3 true);
-
-                // buffer the src, dst, wgts and bias vectors
-                typename param_::src_vec src_data1{};
-                typename param_::src_vec src_data2{};
-                typename param_::dst_vec dst_data1{};
-                typename param_::dst_vec dst_data2{};
-                typename param_::wgts_vec wgts_data{};
-                typename param_::bias_vec bias_data{};
-
-                // flattening loop to improve latency (TODO: loop inefficient for stride >= 2)
-                const int64_t src_row = ptr_pix / param_::lat_cols;
-                const int64_t src_col = ptr_pix % param_::lat_cols;
-                const int64_t fm_v           = ptr_wgt / param_::lat_chnls * (layer_type_ == hvx::util::layer_e::Conv);
-                const int64_t chnl_v         = ptr_wgt % param_::lat_chnls;
-                const int64_t wgt_src_chnl_v = chnl_v * (layer_type_ == hvx::util::layer_e::Conv);
-                const int64_t wgt_dst_chnl_v =
-                    fm_v * (layer_type_ == hvx::util::layer_e::Conv) + chnl_v * (layer_type_ == hvx::util::layer_e::Depthwise);
-                // comp conditions for src and dst (TODO: delete template parameters except param_)4
-                const auto cond =
-                    hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::src_row_vec_size,
-                                        param_::src_col_vec_size, param_::dst_row_vec_size, param_::dst_col_vec_size, param_::knl_win_rows,
-                                        param_::knl_win_cols, param_::knl_rows, param_::knl_cols, param_::pad_rows_up, param_::pad_rows_down,
-                                        param_::pad_cols_left, param_::pad_cols_right, param_::str_cols, param_::str_rows, param_::dil_rows,
-                                        param_::dil_cols>(src_col, src_row);
-                const bool cond_chnl = (fm_v == 0);
-                const bool cond_fm   = (chnl_v == (param_::chnl_vec_elms - 1)) || (layer_type_ != hvx::util::layer_e::Conv);
-                const bool cond_wgts = (cond.dst_row && cond.dst_col && (layer_type_ != hvx::util::layer_e::Pool));
-                const bool cond_bias = (with_bias_ && cond.dst_row && cond.dst_col && cond_fm && (layer_type_ != hvx::util::layer_e::Pool));
-                // read next src vector
-                hvx::util::StreamReadData<>(src1, src_data1, ptr_src1, (cond.src_row && cond.src_col && cond_chnl));
-                hvx::util::StreamReadData<>(src2, src_data2, ptr_src2, (cond.src_row && cond.src_col && cond_chnl));
-                // updates the window and its buffers (TODO: delete template parameters except param_) 
-                hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::ohd_cols, param_::knl_rows, param_::knl_cols,
-                                    param_::dil_rows, param_::dil_cols, param_::str_rows, param_::str_cols, param_::knl_sel_rows,
-                                    param_::knl_sel_cols, param_::knl_win_rows, param_::knl_win_cols, param_::knl_vec_rows, param_::knl_vec_cols,
-                                    param_::knl_ovr_rows, param_::knl_ovr_cols, param_::dst_row_vec_size, param_::dst_col_vec_size>(
-                    src_row, src_col, chnl_v, fm_v, src_data1, row_buf1, src_buf1, win_buf1, win_dil1, win1);
-                hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::ohd_cols, param_::knl_rows, param_::knl_cols,
-                                    param_::dil_rows, param_::dil_cols, param_::str_rows, param_::str_cols, param_::knl_sel_rows,
-                                    param_::knl_sel_cols, param_::knl_win_rows, param_::knl_win_cols, param_::knl_vec_rows, param_::knl_vec_cols,
-                                    param_::knl_ovr_rows, param_::knl_ovr_cols, param_::dst_row_vec_size, param_::dst_col_vec_size>(
-                    src_row, src_col, chnl_v, fm_v, src_data2, row_buf2, src_buf2, win_buf2, win_dil2, win2);                    
-                // read weights src vector (TODO: delete template parameters except param_)
-                hvx::util::WeightsUpdate<typename param_::wgts_type, param_::wgts_vec_size, param_::wgt_src_chnl_vec_elms,
-                                        param_::wgt_dst_chnl_vec_elms, param_::buffer_wgts>(wgt_src_chnl_v, wgt_dst_chnl_v, ptr_dst1,
-                                                                                            wgts_buffered_, cond_wgts, wgts, wgts_buf, wgts_data);
-
-                // read bias src vector (TODO: delete template parameters except param_)
-                hvx::util::BiasUpdate<typename param_::bias_type, param_::dst_chnls_v::vec_size, param_::bias_vec_elms, param_::buffer_bias>(
-                    ptr_dst1, bias_buffered_, cond_bias, bias, bias_buf, bias_data);
-
-                // applies conv function on an src vector
-                hvx::nn::SuperComp<param_, pool_type_, layer_type_>(chnl_v, sum_global, win1, wgts_data, bias_data, dst_data1);
-                hvx::nn::SuperComp<param_, pool_type_, layer_type_>(chnl_v, sum_global, win2, wgts_data, bias_data, dst_data2);
-
-                // write next dst vector
-                hvx::util::StreamWriteData<>(dst1, dst_data1, ptr_dst1, (cond.dst_row && cond.dst_col && cond_fm));
-                hvx::util::StreamWriteData<>(dst2, dst_data2, ptr_dst2, (cond.dst_row && cond.dst_col && cond_fm));
-            }
+    int64_t src_row = 0, src_col = 0, fm_i = 0, chnl_v = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+        // HVX_PRAGMA(HLS dependence variable = sum_global type = inter distance = param_::sum_global_elms true)
+
+        // HVX_PRAGMA(HLS dependence variable = sum_global type = inter direction = WAW|WAR distance = 3 true);
+
+        // buffer the src, dst, wgts and bias vectors
+        typename param_::src_vec src_data1{};
+        typename param_::src_vec src_data2{};
+        typename param_::dst_vec dst_data1{};
+        typename param_::dst_vec dst_data2{};
+        typename param_::wgts_vec wgts_data{};
+        typename param_::bias_vec bias_data{};
+
+        // comp conditions for src and dst (TODO: delete template parameters except param_)
+        const auto cond =
+            hvx::util::WinCompCond<param_::src_rows, param_::src_cols, param_::dst_rows, param_::dst_cols, param_::src_row_vec_size,
+                                   param_::src_col_vec_size, param_::dst_row_vec_size, param_::dst_col_vec_size, param_::knl_win_rows,
+                                   param_::knl_win_cols, param_::knl_rows, param_::knl_cols, param_::pad_rows_up, param_::pad_rows_down,
+                                   param_::pad_cols_left, param_::pad_cols_right, param_::str_cols, param_::str_rows, param_::dil_rows,
+                                   param_::dil_cols>(src_col, src_row);
+        const bool cond_dst = (cond.dst_row && cond.dst_col);
+
+        // weights and dst chnl vectors of the layer type
+        const int64_t fm_v           = fm_i * (layer_type_ == hvx::util::layer_e::Conv);
+        const int64_t wgt_src_chnl_v = chnl_v * (layer_type_ == hvx::util::layer_e::Conv);
+        const int64_t wgt_dst_chnl_v =
+            fm_v * (layer_type_ == hvx::util::layer_e::Conv) + chnl_v * (layer_type_ == hvx::util::layer_e::Depthwise);
+        const bool cond_chnl = (fm_v == 0);
+        const bool cond_fm   = (chnl_v == (param_::chnl_vec_elms - 1)) || (layer_type_ != hvx::util::layer_e::Conv);
+        const bool cond_wgts = (cond_dst && (layer_type_ != hvx::util::layer_e::Pool));
+        const bool cond_bias = (with_bias_ && cond_dst && cond_fm && (layer_type_ != hvx::util::layer_e::Pool));
+
+        // read next src vector
+        hvx::util::StreamReadData<>(src1, src_data1, ptr_src1, (cond.src_row && cond.src_col && cond_chnl));
+        hvx::util::StreamReadData<>(src2, src_data2, ptr_src2, (cond.src_row && cond.src_col && cond_chnl));
+
+        // updates the window and its buffers (TODO: delete template parameters except param_)
+        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::ohd_cols, param_::knl_rows, param_::knl_cols,
+                             param_::dil_rows, param_::dil_cols, param_::str_rows, param_::str_cols, param_::knl_sel_rows,
+                             param_::knl_sel_cols, param_::knl_win_rows, param_::knl_win_cols, param_::knl_vec_rows, param_::knl_vec_cols,
+                             param_::knl_ovr_rows, param_::knl_ovr_cols, param_::dst_row_vec_size, param_::dst_col_vec_size>(
+            src_row, src_col, chnl_v, fm_v, src_data1, row_buf1, src_buf1, win_buf1, win_dil1, win1);
+        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, param_::ohd_cols, param_::knl_rows, param_::knl_cols,
+                             param_::dil_rows, param_::dil_cols, param_::str_rows, param_::str_cols, param_::knl_sel_rows,
+                             param_::knl_sel_cols, param_::knl_win_rows, param_::knl_win_cols, param_::knl_vec_rows, param_::knl_vec_cols,
+                             param_::knl_ovr_rows, param_::knl_ovr_cols, param_::dst_row_vec_size, param_::dst_col_vec_size>(
+            src_row, src_col, chnl_v, fm_v, src_data2, row_buf2, src_buf2, win_buf2, win_dil2, win2);
+
+        // read weights src vector (TODO: delete template parameters except param_)
+        hvx::util::WeightsUpdate<typename param_::wgts_type, param_::wgts_vec_size, param_::wgt_src_chnl_vec_elms,
+                                 param_::wgt_dst_chnl_vec_elms, param_::buffer_wgts>(wgt_src_chnl_v, wgt_dst_chnl_v, ptr_dst1, wgts_buffered_,
+                                                                                     cond_wgts, wgts, wgts_buf, wgts_data);
+
+        // read bias src vector (TODO: delete template parameters except param_)
+        hvx::util::BiasUpdate<typename param_::bias_type, param_::dst_chnls_v::vec_size, param_::bias_vec_elms, param_::buffer_bias>(
+            ptr_dst1, bias_buffered_, cond_bias, bias, bias_buf, bias_data);
+
+        // applies conv function on an src vector (only at src positions that produce a dst)
+        if (cond_dst == true) {
+            hvx::nn::SuperComp<param_, pool_type_, layer_type_>(chnl_v, sum_global, win1, wgts_data, bias_data, dst_data1);
+            hvx::nn::SuperComp<param_, pool_type_, layer_type_>(chnl_v, sum_global, win2, wgts_data, bias_data, dst_data2);
         }
-    }        
+
+        // write next dst vector
+        hvx::util::StreamWriteData<>(dst1, dst_data1, ptr_dst1, (cond_dst && cond_fm));
+        hvx::util::StreamWriteData<>(dst2, dst_data2, ptr_dst2, (cond_dst && cond_fm));
+
+        // next src chnl, dst fm and src position
+        hvx::nn::SuperScheduleNext<param_>(cond_dst, src_row, src_col, fm_i, chnl_v);
+    }
     // hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
 }
 
+/*!
+ * @brief top function of the super layer (uses a single state for each parameter set)
+ */
+template<typename param_, bool with_bias_ = false, hvx::util::pooling_e pool_type_, hvx::util::layer_e layer_type_>
+HVX_FORCE_INLINE auto
+SuperTop(typename param_::src_port* src1,
+         typename param_::src2_port* src2,
+         typename param_::wgts_vec* wgts,
+         typename param_::bias_vec* bias,
+         typename param_::dst_port* dst1,
+         typename param_::dst2_port* dst2) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::SuperState<param_> state;
+    hvx::nn::SuperTop<param_, with_bias_, pool_type_, layer_type_>(state, src1, src2, wgts, bias, dst1, dst2);
+}
+
 /******************************************************************************************************************************************/
 } // namespace nn
 } // namespace hvx
@@ -309,37 +309,65 @@ SuperComp(
 }
 
 /*!
- * @brief top function of the conv layer
+ * @brief the state of a super layer instance (buffered weights/bias, line buffers and windows)
+ */
+template<typename param_>
+struct Super_Re_State : hvx::util::LayerArena<Super_Re_State<param_>> {
+    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
+    hvx::util::array1d<typename param_::wgts_vec, param_::wgts_vec_elms> wgts_buf;
+    hvx::util::array1d<typename param_::bias_vec, param_::bias_vec_elms> bias_buf;
+    bool wgts_buffered = false, bias_buffered = false;
+
+    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
+    hvx::util::array2d<typename param_::src_vec, param_::row_buf_elms, param_::row_buf_num> row_buf;
+    hvx::util::array2d<typename param_::src_vec, param_::win_buf_elms, param_::win_buf_num> win_buf;
+    hvx::util::array2d<typename param_::src_vec, param_::src_buf_elms, param_::src_buf_num> src_buf;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_elms> win;
+    hvx::util::array1d<typename param_::chnl_vec, param_::win_dil_elms> win_dil;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+
+    /*!
+     * @brief weights and bias are read again on the next execution
+     */
+    HVX_FORCE_INLINE auto Reset() noexcept -> void {
+        wgts_buffered = false;
+        bias_buffered = false;
+    }
+};
+
+/*!
+ * @brief top function of the super layer (the state of the layer instance is passed by the caller)
  */
 template<typename param_, bool with_bias_ = false, hvx::util::pooling_e pool_type_, hvx::util::layer_e layer_type_>
 HVX_FORCE_INLINE auto
-SuperTop(typename param_::src_port* src,
+SuperTop(hvx::nn::Super_Re_State<param_>& state,
+         typename param_::src_port* src,
          typename param_::wgts_vec* wgts,
          typename param_::bias_vec* bias,
          typename param_::dst_port* dst) noexcept -> void {
     HVX_INLINE_TOP();
 
-    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
-    static hvx::util::array1d<typename param_::wgts_vec, param_::wgts_vec_elms> wgts_buf;
-    static hvx::util::array1d<typename param_::bias_vec, param_::bias_vec_elms> bias_buf;
-    static bool wgts_buffered_ = false, bias_buffered_ = false;
-
-    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
-    static hvx::util::array2d<typename param_::src_vec, param_::row_buf_elms, param_::row_buf_num> row_buf;
-    static hvx::util::array2d<typename param_::src_vec, param_::win_buf_elms, param_::win_buf_num> win_buf;
-    static hvx::util::array2d<typename param_::src_vec, param_::src_buf_elms, param_::src_buf_num> src_buf;
-    static hvx::util::array1d<typename param_::chnl_vec, param_::win_elms> win;
-    static hvx::util::array1d<typename param_::chnl_vec, param_::win_dil_elms> win_dil;
-
-
     // directives for buffers and windows
-    HVX_DATAPACK(bias_buf.data, row_buf.data, win_buf.data, src_buf.data, win.data, win_dil.data); // wgts_buf.data,
-    HVX_ARRAY_PARTITION_COMPLETE(row_buf.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_buf.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(src_buf.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win.data, 1);
-    HVX_ARRAY_PARTITION_COMPLETE(win_dil.data, 1);
-
+    HVX_DATAPACK(state.bias_buf.data, state.row_buf.data, state.win_buf.data, state.src_buf.data, state.win.data,
+                 state.win_dil.data); // wgts_buf.data,
+    HVX_ARRAY_PARTITION_COMPLETE(state.row_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.src_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_dil.data, 1);
+
+    // references to the state of the layer instance
+    bool& wgts_buffered_ = state.wgts_buffered;
+    bool& bias_buffered_ = state.bias_buffered;
+    auto& wgts_buf       = state.wgts_buf;
+    auto& bias_buf       = state.bias_buf;
+    auto& row_buf        = state.row_buf;
+    auto& win_buf        = state.win_buf;
+    auto& src_buf        = state.src_buf;
+    auto& win            = state.win;
+    auto& win_dil        = state.win_dil;
 
     // iterates through the tensor vector by vector
     int64_t ptr_src = 0, ptr_dst = 0;
@@ -404,6 +432,20 @@ SuperTop(typename param_::src_port* src,
     hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
 }
 
+/*!
+ * @brief top function of the super layer (uses a single state for each parameter set)
+ */
+template<typename param_, bool with_bias_ = false, hvx::util::pooling_e pool_type_, hvx::util::layer_e layer_type_>
+HVX_FORCE_INLINE auto
+SuperTop(typename param_::src_port* src,
+         typename param_::wgts_vec* wgts,
+         typename param_::bias_vec* bias,
+         typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::Super_Re_State<param_> state;
+    hvx::nn::SuperTop<param_, with_bias_, pool_type_, layer_type_>(state, src, wgts, bias, dst);
+}
+
 /******************************************************************************************************************************************/
 } // namespace nn
 } // namespace hvx
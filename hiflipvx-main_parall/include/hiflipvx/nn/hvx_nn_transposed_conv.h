@@ -0,0 +1,379 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_transposed_conv.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Transposed convolution (learned upsampling) through sub-pixel decomposition. The dst rows/cols are vectorized by the stride, so every
+ *  src pixel produces one dst vector with "str_rows x str_cols" dst pixels (phases). Each phase is a stride-1 convolution of the src with
+ *  the kernel taps of its phase, all phases share one window over the src. Only these taps are multiplied, no zeros are inserted.
+ */
+
+#ifndef HVX_NN_TRANSPOSED_CONV_H_
+#define HVX_NN_TRANSPOSED_CONV_H_
+
+#include "hvx_nn_conv.h"
+
+namespace hvx {
+namespace nn {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief All compile time parameters and checks for the transposed convolution function. The number of dst rows/cols is
+ * "(src - 1) * str - 2 * pad + knl + out_pad", it has to be "str" times the number of src rows/cols.
+ */
+template<typename src_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the inputs
+         typename dst_type_                     = hvx::util::dfixed<int16_t, 15>, // data type for the outputs
+         typename wgts_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the weights
+         typename bias_type_                    = hvx::util::dfixed<int16_t, 15>, // data type for the bias
+         typename batch_v                       = hvx::util::VectorParam<1, 1>,   // batch size
+         typename src_rows_v                    = hvx::util::VectorParam<1, 1>,   // number of rows in the input tensor
+         typename src_cols_v                    = hvx::util::VectorParam<1, 1>,   // number of columns in the input tensor
+         typename chnls_v                       = hvx::util::VectorParam<1, 1>,   // number of channels (equal to input channels)
+         typename fms_v                         = hvx::util::VectorParam<1, 1>,   // number of feature maps (equal to output channels)
+         typename knl_rows_v                    = hvx::util::VectorParam<1, 1>,   // number of rows in the kernel (fully vectorized)
+         typename knl_cols_v                    = hvx::util::VectorParam<1, 1>,   // number of columns in the kernel (fully vectorized)
+         typename pad_                          = hvx::util::Array2dParam<0, 0>,  // number of dst elements removed on both sides
+         typename str_                          = hvx::util::Array2dParam<1, 1>,  // upsampling factor in (Y/X)-direction
+         typename out_pad_                      = hvx::util::Array2dParam<0, 0>,  // number of dst elements added on the bottom/right side
+         int64_t buf_wgts_                      = false,                          // if weights should be internally buffered on first read
+         int64_t buf_bias_                      = false,                          // if bias should be buffered internally on first read
+         hvx::util::overflow_e overflow_type_   = hvx::util::overflow_e::kSaturate,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kTrunc,
+         hvx::util::execution_e exec_type_      = hvx::util::execution_e::kExact,
+         typename epilogue_                     = hvx::util::EpilogueParam<>> // fused requantization/activation after the bias
+struct TransposedConvParam {
+    // dst pixel "o" of phase "(o + pad) % str" sums up the kernel taps "phase + str * j" with the src pixels "(o + pad) / str - j"
+    static constexpr auto sub_knl_rows = (knl_rows_v::elms + str_::rows - 1) / str_::rows;
+    static constexpr auto sub_knl_cols = (knl_cols_v::elms + str_::cols - 1) / str_::cols;
+    static constexpr auto sub_knl_elms = sub_knl_rows * sub_knl_cols;
+    static constexpr auto ofs_min_rows = pad_::rows / str_::rows;
+    static constexpr auto ofs_min_cols = pad_::cols / str_::cols;
+    static constexpr auto ofs_max_rows = (str_::rows - 1 + pad_::rows) / str_::rows;
+    static constexpr auto ofs_max_cols = (str_::cols - 1 + pad_::cols) / str_::cols;
+
+    // window over the src that contains the taps of all phases of a dst vector (stride 1, symmetric padding)
+    static constexpr auto win_knl_rows = sub_knl_rows + ofs_max_rows - ofs_min_rows;
+    static constexpr auto win_knl_cols = sub_knl_cols + ofs_max_cols - ofs_min_cols;
+    static constexpr auto win_pad_rows = hvx::util::Max(sub_knl_rows - 1 - ofs_min_rows, static_cast<int64_t>(0));
+    static constexpr auto win_pad_cols = hvx::util::Max(sub_knl_cols - 1 - ofs_min_cols, static_cast<int64_t>(0));
+
+    // tensor parameters (the dst rows/cols are vectorized by the stride)
+    using dst_rows_v = hvx::util::VectorParam<(src_rows_v::elms - 1) * str_::rows - 2 * pad_::rows + knl_rows_v::elms + out_pad_::rows,
+                                              str_::rows>;
+    using dst_cols_v = hvx::util::VectorParam<(src_cols_v::elms - 1) * str_::cols - 2 * pad_::cols + knl_cols_v::elms + out_pad_::cols,
+                                              str_::cols>;
+    using src_dim    = hvx::util::TensorParam<4, chnls_v, src_cols_v, src_rows_v, batch_v>;
+    using dst_dim    = hvx::util::TensorParam<4, fms_v, dst_cols_v, dst_rows_v, batch_v>;
+    using wgts_dim   = hvx::util::TensorParam<4, knl_cols_v, knl_rows_v, chnls_v, fms_v>;
+    using bias_dim   = hvx::util::TensorParam<1, fms_v>;
+
+    // parameters of the window buffers
+    using win_param = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, src_rows_v, src_cols_v, chnls_v, fms_v,
+                                         hvx::util::VectorParam<win_knl_rows, win_knl_rows>,
+                                         hvx::util::VectorParam<win_knl_cols, win_knl_cols>,
+                                         hvx::util::Array2dParam<win_pad_rows, win_pad_cols>, hvx::util::Array2dParam<0, 0>,
+                                         hvx::util::Array2dParam<1, 1>, buf_wgts_, buf_bias_, overflow_type_, underflow_type_, exec_type_>;
+
+    // dimensions
+    static constexpr auto batch            = batch_v::elms;
+    static constexpr auto src_rows         = src_rows_v::elms;
+    static constexpr auto src_row_vec_size = src_rows_v::vec_size;
+    static constexpr auto src_cols         = src_cols_v::elms;
+    static constexpr auto dst_rows         = dst_rows_v::elms;
+    static constexpr auto dst_row_vec_size = dst_rows_v::vec_size;
+    static constexpr auto dst_row_vec_elms = dst_rows_v::vec_elms;
+    static constexpr auto dst_cols         = dst_cols_v::elms;
+    static constexpr auto dst_col_vec_size = dst_cols_v::vec_size;
+    static constexpr auto dst_col_vec_elms = dst_cols_v::vec_elms;
+    static constexpr auto chnls            = chnls_v::elms;
+    static constexpr auto chnl_vec_size    = chnls_v::vec_size;
+    static constexpr auto chnl_vec_elms    = chnls_v::elms / chnls_v::vec_size;
+    static constexpr auto fms              = fms_v::elms;
+    static constexpr auto fm_vec_size      = fms_v::vec_size;
+    static constexpr auto fm_vec_elms      = fms_v::elms / fms_v::vec_size;
+    static constexpr auto wgts_vec_size    = wgts_dim::vec_size;
+    static constexpr auto wgts_vec_elms    = wgts_dim::vec_elms;
+    static constexpr auto bias_vec_size    = bias_dim::vec_size;
+    static constexpr auto bias_vec_elms    = bias_dim::vec_elms;
+
+    // data types
+    using src_type  = src_type_;
+    using dst_type  = dst_type_;
+    using wgts_type = wgts_type_;
+    using bias_type = bias_type_;
+    using comp_type = hvx::util::def_int_type_t<src_type, wgts_type_>;
+    using src_vec   = hvx::util::vector<src_type, src_dim::vec_size>;
+    using dst_vec   = hvx::util::vector<dst_type, dst_dim::vec_size>;
+    using wgts_vec  = hvx::util::vector<wgts_type, wgts_dim::vec_size>;
+    using bias_vec  = hvx::util::vector<bias_type, bias_dim::vec_size>;
+    using comp_vec  = hvx::util::vector<comp_type, fm_vec_size>;
+    using chnl_vec  = hvx::util::vector<src_type, chnl_vec_size>;
+    using src_port  = src_vec;
+    using dst_port  = dst_vec;
+    using wgts_port = wgts_vec;
+    using bias_port = bias_vec;
+
+    // kernel parameters (the taps of one phase are summed up in one call)
+    static constexpr auto knl_rows          = knl_rows_v::elms;
+    static constexpr auto knl_cols          = knl_cols_v::elms;
+    static constexpr auto knl_elms          = knl_rows * knl_cols;
+    static constexpr auto knl_rows_vec_size = sub_knl_rows;
+    static constexpr auto knl_cols_vec_size = sub_knl_cols;
+    static constexpr auto pad_rows          = pad_::rows;
+    static constexpr auto pad_cols          = pad_::cols;
+    static constexpr auto str_rows          = str_::rows;
+    static constexpr auto str_cols          = str_::cols;
+    static constexpr auto out_pad_rows      = out_pad_::rows;
+    static constexpr auto out_pad_cols      = out_pad_::cols;
+    static constexpr auto knl_dil_rows      = win_param::knl_dil_rows;
+    static constexpr auto pad_rows_up       = win_param::pad_rows_up;
+    static constexpr auto buffer_wgts       = buf_wgts_;
+    static constexpr auto buffer_bias       = buf_bias_;
+
+    // global sum for every phase of a dst vector, products summed up in one cycle and multipliers of the datapath (without zero taps)
+    static constexpr auto sum_global_elms = dst_row_vec_size * dst_col_vec_size;
+    static constexpr auto sum_elms        = sub_knl_elms * chnl_vec_size;
+    static constexpr auto mults           = sum_elms * fm_vec_size * sum_global_elms;
+
+    // numerical stability
+    static constexpr auto overflow_type  = overflow_type_;
+    static constexpr auto underflow_type = underflow_type_;
+    static constexpr auto exec_type      = exec_type_;
+
+    // fused epilogue
+    using epilogue = epilogue_;
+
+    // latency (iteration-skipping schedule of the direct conv on the window, one dst vector per src pixel)
+    static constexpr auto lat_rows     = win_param::lat_rows;
+    static constexpr auto lat_cols     = win_param::lat_cols;
+    static constexpr auto lat_chnls    = chnl_vec_elms;
+    static constexpr auto lat_fms      = fm_vec_elms;
+    static constexpr auto lat_knls     = 1;
+    static constexpr auto lat_wait_fms = 1;
+    static constexpr auto lat_dst_pix  = batch * dst_row_vec_elms * dst_col_vec_elms;
+    static constexpr auto lat_src_pix  = batch * lat_rows * lat_cols;
+    static constexpr auto lat          = (lat_dst_pix * lat_fms + (lat_src_pix - lat_dst_pix) * lat_wait_fms) * lat_chnls;
+
+    // constructor (verifies the dimensions and types)
+    constexpr TransposedConvParam() {
+        static_assert((pad_rows < knl_rows) && (pad_cols < knl_cols), "Padding has to be smaller than the kernel!");
+        static_assert((out_pad_rows < str_rows) && (out_pad_cols < str_cols), "Output padding has to be smaller than the stride!");
+        static_assert(sub_knl_rows >= (ofs_min_rows + 1) && sub_knl_cols >= (ofs_min_cols + 1), "Padding too large for the kernel!");
+        static_assert((win_param::dst_rows == dst_row_vec_elms) && (win_param::dst_cols == dst_col_vec_elms),
+                      "Dst rows/cols are no multiple \"str\" of the src rows/cols (adapt \"out_pad\")!");
+        hvx::util::TensorVerifyIfVecSizeIs1<src_dim, false, true, true, true, true, true>();
+        hvx::util::TensorVerifyIfVecSizeIs1<dst_dim, false, false, false, true, true, true>();
+        hvx::util::BiasVerifyDim<bias_dim, dst_rows, dst_cols, fms, fm_vec_size>();
+        hvx::nn::impl::ConvVerifyType<src_type, wgts_type, bias_type, dst_type>();
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief applies the transposed conv function on an src vector. Every phase of the dst vector collects its taps from the shared window
+ * (the window stores the newest element first), taps outside of the kernel get a zero weight and are removed at compile time.
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+TransposedConvComp(int64_t chnl_v,
+                   hvx::util::array1d<typename param_::comp_vec, param_::sum_global_elms>& sum_global_vec,
+                   hvx::util::array1d<typename param_::chnl_vec, param_::win_param::win_elms>& win,
+                   typename param_::wgts_vec& wgts_data,
+                   typename param_::bias_vec& bias_data,
+                   typename param_::dst_vec& dst_data) noexcept -> void {
+    HVX_INLINE_TOP();
+    using win_param = typename param_::win_param;
+
+    for (int64_t row_p = 0; row_p < param_::dst_row_vec_size; ++row_p) {
+        HVX_UNROLL();
+        for (int64_t col_p = 0; col_p < param_::dst_col_vec_size; ++col_p) {
+            HVX_UNROLL();
+            const int64_t pix_p     = row_p * param_::dst_col_vec_size + col_p;
+            const int64_t phase_row = (row_p + param_::pad_rows) % param_::str_rows;
+            const int64_t phase_col = (col_p + param_::pad_cols) % param_::str_cols;
+            const int64_t win_row   = param_::ofs_max_rows - (row_p + param_::pad_rows) / param_::str_rows;
+            const int64_t win_col   = param_::ofs_max_cols - (col_p + param_::pad_cols) / param_::str_cols;
+            for (int64_t fm_p = 0; fm_p < param_::fm_vec_size; ++fm_p) {
+                HVX_UNROLL();
+
+                // buffers needed win and wgts to comp one dst element
+                hvx::util::vector<typename param_::wgts_type, param_::sum_elms> wgts_tmp{};
+                hvx::util::vector<typename param_::src_type, param_::sum_elms> win_tmp{};
+
+                // get the taps of the phase (the weights are stored in reversed order, like the kernel of a direct conv)
+                for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+                    for (int64_t sub_row = 0; sub_row < param_::sub_knl_rows; ++sub_row) {
+                        for (int64_t sub_col = 0; sub_col < param_::sub_knl_cols; ++sub_col) {
+                            const int64_t knl_row  = phase_row + sub_row * param_::str_rows;
+                            const int64_t knl_col  = phase_col + sub_col * param_::str_cols;
+                            const int64_t win_pix  = (win_row + sub_row) * win_param::knl_sel_cols + (win_col + sub_col);
+                            const int64_t ptr_sub  = chnl_p * param_::sub_knl_elms;
+                            const int64_t ptr_win  = ptr_sub + sub_row * param_::sub_knl_cols + sub_col;
+                            const int64_t ptr_wgts = ptr_sub + (param_::sub_knl_rows - 1 - sub_row) * param_::sub_knl_cols +
+                                                     (param_::sub_knl_cols - 1 - sub_col);
+                            if ((knl_row < param_::knl_rows) && (knl_col < param_::knl_cols)) {
+                                const int64_t ptr_knl =
+                                    (fm_p * param_::chnl_vec_size + chnl_p) * param_::knl_elms + knl_row * param_::knl_cols + knl_col;
+                                wgts_tmp.Set(wgts_data.Get(ptr_knl), ptr_wgts);
+                            }
+                            win_tmp.Set(win.Get(win_pix).Get(chnl_p), ptr_win);
+                        }
+                    }
+                }
+
+                // applies conv function on a single element
+                hvx::nn::impl::ConvComp<param_>(chnl_v, sum_global_vec.Get(pix_p).Get(fm_p), win_tmp, wgts_tmp, bias_data.Get(fm_p),
+                                                dst_data.Get(pix_p * param_::fm_vec_size + fm_p));
+            }
+        }
+    }
+}
+
+/*!
+ * @brief the state of a transposed conv layer instance (buffered weights/bias, line buffers and window)
+ */
+template<typename param_>
+struct TransposedConvState : hvx::util::LayerArena<TransposedConvState<param_>> {
+    using win_param = typename param_::win_param;
+
+    // buffer the weights and bias (if needed) does not read when IP executes multiple times [dont initialize]
+    hvx::util::array1d<typename param_::wgts_vec, param_::wgts_vec_elms> wgts_buf;
+    hvx::util::array1d<typename param_::bias_vec, param_::bias_vec_elms> bias_buf;
+    bool wgts_buffered = false, bias_buffered = false;
+
+    // buffers needed src elements for window to not read same element twice from global memory [dont initialize]
+    hvx::util::array2d<typename param_::src_vec, win_param::row_buf_elms, win_param::row_buf_num> row_buf;
+    hvx::util::array2d<typename param_::src_vec, win_param::win_buf_elms, win_param::win_buf_num> win_buf;
+    hvx::util::array2d<typename param_::src_vec, win_param::src_buf_elms, win_param::src_buf_num> src_buf;
+    hvx::util::array1d<typename param_::chnl_vec, win_param::win_elms> win;
+    hvx::util::array1d<typename param_::chnl_vec, win_param::win_dil_elms> win_dil;
+
+    // buffers the global sum for one dst vector [dont initialize]
+    hvx::util::array1d<typename param_::comp_vec, param_::sum_global_elms> sum_global;
+
+    // closes the arena of the state (last member)
+    hvx::util::ArenaSeal arena_seal;
+
+    /*!
+     * @brief weights and bias are read again on the next execution
+     */
+    HVX_FORCE_INLINE auto Reset() noexcept -> void {
+        wgts_buffered = false;
+        bias_buffered = false;
+    }
+};
+
+/*!
+ * @brief top function of the transposed conv layer (the state of the layer instance is passed by the caller)
+ */
+template<typename param_, bool with_bias_ = false>
+HVX_FORCE_INLINE auto
+TransposedConvTop(hvx::nn::TransposedConvState<param_>& state,
+                  typename param_::src_port* src,
+                  typename param_::wgts_vec* wgts,
+                  typename param_::bias_vec* bias,
+                  typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    using win_param = typename param_::win_param;
+
+    // directives for buffers and windows
+    HVX_DATAPACK(state.bias_buf.data, state.row_buf.data, state.win_buf.data, state.src_buf.data, state.win.data, state.win_dil.data);
+    HVX_ARRAY_PARTITION_COMPLETE(state.row_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.src_buf.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.win_dil.data, 1);
+    HVX_ARRAY_PARTITION_COMPLETE(state.sum_global.data, 0);
+
+    // iterates through the tensor vector by vector (flattened loop, the dst fms are only iterated at src positions that produce a dst)
+    int64_t ptr_src = 0, ptr_dst = 0;
+    int64_t src_row = 0, src_col = 0, fm_v = 0, knl_v = 0, chnl_v = 0;
+    for (int64_t i = 0; i < param_::lat; ++i) {
+        HVX_PIPELINE_ON(1, frp);
+
+        // buffer the src, dst, wgts and bias vectors
+        typename param_::src_vec src_data{};
+        typename param_::dst_vec dst_data{};
+        typename param_::wgts_vec wgts_data{};
+        typename param_::bias_vec bias_data{};
+
+        // comp conditions for src and dst (TODO: delete template parameters except param_)
+        const auto cond =
+            hvx::util::WinCompCond<win_param::src_rows, win_param::src_cols, win_param::dst_rows, win_param::dst_cols,
+                                   win_param::src_row_vec_size, win_param::src_col_vec_size, win_param::dst_row_vec_size,
+                                   win_param::dst_col_vec_size, win_param::knl_win_rows, win_param::knl_win_cols, win_param::knl_rows,
+                                   win_param::knl_cols, win_param::pad_rows_up, win_param::pad_rows_down, win_param::pad_cols_left,
+                                   win_param::pad_cols_right, win_param::str_cols, win_param::str_rows, win_param::dil_rows,
+                                   win_param::dil_cols>(src_col, src_row);
+        const bool cond_dst  = (cond.dst_row && cond.dst_col);
+        const bool cond_chnl = (fm_v == 0);
+        const bool cond_fm   = (chnl_v == (param_::chnl_vec_elms - 1));
+        const bool cond_bias = (with_bias_ && cond_dst && cond_fm);
+
+        // read next src vector
+        hvx::util::StreamReadData<>(src, src_data, ptr_src, (cond.src_row && cond.src_col && cond_chnl));
+
+        // updates the window and its buffers (TODO: delete template parameters except param_)
+        hvx::util::WinUpdate<typename param_::src_type, typename param_::src_dim, win_param::ohd_cols, win_param::knl_rows,
+                             win_param::knl_cols, win_param::dil_rows, win_param::dil_cols, win_param::str_rows, win_param::str_cols,
+                             win_param::knl_sel_rows, win_param::knl_sel_cols, win_param::knl_win_rows, win_param::knl_win_cols,
+                             win_param::knl_vec_rows, win_param::knl_vec_cols, win_param::knl_ovr_rows, win_param::knl_ovr_cols,
+                             win_param::dst_row_vec_size, win_param::dst_col_vec_size, param_::fm_vec_elms>(
+            src_row, src_col, chnl_v, fm_v, src_data, state.row_buf, state.src_buf, state.win_buf, state.win_dil, state.win, !cond_dst);
+
+        // read weights and bias vectors (TODO: delete template parameters except param_)
+        hvx::util::WeightsUpdate<typename param_::wgts_type, param_::wgts_vec_size, param_::chnl_vec_elms, param_::fm_vec_elms,
+                                 param_::buffer_wgts>(chnl_v, fm_v, ptr_dst, state.wgts_buffered, cond_dst, wgts, state.wgts_buf,
+                                                      wgts_data);
+        hvx::util::BiasUpdate<typename param_::bias_type, param_::fm_vec_size, param_::bias_vec_elms, param_::buffer_bias>(
+            ptr_dst, state.bias_buffered, cond_bias, bias, state.bias_buf, bias_data);
+
+        // applies the transposed conv function on an src vector (only at src positions that produce a dst)
+        if (cond_dst == true)
+            hvx::nn::TransposedConvComp<param_>(chnl_v, state.sum_global, state.win, wgts_data, bias_data, dst_data);
+
+        // write next dst vector
+        hvx::util::StreamWriteData<>(dst, dst_data, ptr_dst, (cond_dst && cond_fm));
+
+        // next src chnl, dst fm and src position
+        hvx::nn::ConvScheduleNext<param_>(cond_dst, src_row, src_col, fm_v, knl_v, chnl_v);
+    }
+    hvx::util::StreamSignalVerify<typename param_::src_dim, typename param_::dst_dim>(ptr_src, ptr_dst);
+}
+
+/*!
+ * @brief top function of the transposed conv layer (uses a single state for each parameter set)
+ */
+template<typename param_, bool with_bias_ = false>
+HVX_FORCE_INLINE auto
+TransposedConvTop(typename param_::src_port* src,
+                  typename param_::wgts_vec* wgts,
+                  typename param_::bias_vec* bias,
+                  typename param_::dst_port* dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    static hvx::nn::TransposedConvState<param_> state;
+    hvx::nn::TransposedConvTop<param_, with_bias_>(state, src, wgts, bias, dst);
+}
+
+/******************************************************************************************************************************************/
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_TRANSPOSED_CONV_H_
@@ -0,0 +1,164 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_attention_dfixed.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Scores, softmax weights and the weighted sum of the values of the attention layer (like the softmax, the exponentials are computed
+ *  in floating-point).
+ */
+
+#ifndef HVX_NN_ATTENTION_DFIXED_H_
+#define HVX_NN_ATTENTION_DFIXED_H_
+
+#include "hvx_nn_softmax_dfixed.h"
+
+namespace hvx {
+namespace nn {
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief verifies the data types of the attention layer
+ */
+template<typename src_type_,
+         typename dst_type_,
+         std::enable_if_t<hvx::util::is_dfixed_v<src_type_>, bool>      = true,
+         std::enable_if_t<hvx::util::is_dfixed_v<dst_type_>, bool>      = true,
+         std::enable_if_t<src_type_::is_flt == dst_type_::is_flt, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+AttentionVerifyType() noexcept -> void {
+    HVX_INLINE_TOP();
+    hvx::nn::impl::SoftmaxVerifyType<src_type_, dst_type_>();
+}
+
+/*!
+ * @brief Calculates the dot product of a query and a key vector part by part (integer sum), and the scaled score after the last part
+ */
+template<typename param_, std::enable_if_t<param_::src_type::is_int, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+AttentionScore(bool first,
+               bool last,
+               typename param_::src_vec& q_vec,
+               typename param_::src_vec& k_vec,
+               typename param_::dot_type& dot,
+               typename param_::buf_type& score) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // the product of two src values has twice the fraction size
+    constexpr auto shift = 1.0f / static_cast<float>(static_cast<int64_t>(1) << (2 * param_::src_type::frac_bits));
+
+    // dot product of the vector parts
+    int64_t sum = 0;
+    for (int64_t dim_p = 0; dim_p < param_::dim_vec_size; ++dim_p) {
+        HVX_UNROLL();
+        sum += static_cast<int64_t>(q_vec.Get(dim_p).data) * static_cast<int64_t>(k_vec.Get(dim_p).data);
+    }
+    dot.data = (first == true) ? (sum) : (dot.data + sum);
+
+    // scaled score
+    if (last == true)
+        score.data = static_cast<float>(dot.data) * shift * param_::Scale();
+}
+
+/*!
+ * @brief Calculates the dot product of a query and a key vector part by part (floating-point sum), and the scaled score after the last part
+ */
+template<typename param_, std::enable_if_t<param_::src_type::is_flt, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+AttentionScore(bool first,
+               bool last,
+               typename param_::src_vec& q_vec,
+               typename param_::src_vec& k_vec,
+               typename param_::dot_type& dot,
+               typename param_::buf_type& score) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // dot product of the vector parts
+    float sum = 0.0f;
+    for (int64_t dim_p = 0; dim_p < param_::dim_vec_size; ++dim_p) {
+        HVX_UNROLL();
+        sum += static_cast<float>(q_vec.Get(dim_p).data) * static_cast<float>(k_vec.Get(dim_p).data);
+    }
+    dot.data = (first == true) ? (sum) : (dot.data + sum);
+
+    // scaled score
+    if (last == true)
+        score.data = dot.data * param_::Scale();
+}
+
+/*!
+ * @brief Calculates the softmax weight w = exp(s - M) of a score (M is the maximum of all scores), and adds it to the sum of all weights
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+AttentionWeight(bool first,
+                typename param_::buf_type score,
+                typename param_::buf_type score_max,
+                typename param_::buf_type& weight,
+                typename param_::buf_type& weight_sum) noexcept -> void {
+    HVX_INLINE_TOP();
+    weight.data     = std::exp(score.data - score_max.data);
+    weight_sum.data = (first == true) ? (weight.data) : (weight_sum.data + weight.data);
+}
+
+/*!
+ * @brief Calculates the weighted sum of the value vectors part by part: acc(i) = acc(i) + w * v(i)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+AttentionValue(bool first, typename param_::buf_type weight, typename param_::src_vec& v_vec, typename param_::buf_vec& acc_vec) noexcept
+    -> void {
+    HVX_INLINE_TOP();
+
+    // fixed-point parameters
+    constexpr auto shift = (param_::src_type::is_int == true)
+                               ? (1.0f / static_cast<float>(static_cast<int64_t>(1) << param_::src_type::frac_bits))
+                               : (1.0f);
+
+    for (int64_t dim_p = 0; dim_p < param_::dim_vec_size; ++dim_p) {
+        HVX_UNROLL();
+        const float val         = weight.data * static_cast<float>(v_vec.Get(dim_p).data) * shift;
+        acc_vec.Get(dim_p).data = (first == true) ? (val) : (acc_vec.Get(dim_p).data + val);
+    }
+}
+
+/*!
+ * @brief Calculates the dst vector from the weighted sum of the values: dst(i) = acc(i) / S
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+AttentionResult(typename param_::buf_vec& acc_vec, typename param_::buf_type weight_sum, typename param_::dst_vec& dst_vec) noexcept
+    -> void {
+    HVX_INLINE_TOP();
+
+    // replace division by multiplication
+    const float sum_inv = 1.0f / weight_sum.data;
+
+    for (int64_t dim_p = 0; dim_p < param_::dim_vec_size; ++dim_p) {
+        HVX_UNROLL();
+        hvx::nn::impl::SoftmaxToDst<param_>(acc_vec.Get(dim_p).data * sum_inv, dst_vec.Get(dim_p));
+    }
+}
+
+/******************************************************************************************************************************************/
+} // namespace impl
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_ATTENTION_DFIXED_H_
@@ -65,7 +65,75 @@ ConvVerifyType() noexcept -> void {
 }
 
 /*!
- * @brief comp global sum, add bias and apply overflow/underflow policies (using fixed-point numbers)
+ * @brief verifies the types of a per-channel quantized layer (the src, wgts and dst are integer codes, their scales are part of the
+ * requantization in the bias)
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         std::enable_if_t<hvx::util::is_dqbias_v<bias_type_>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+ConvVerifyType() noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // compile time assertions
+    static_assert(hvx::util::is_dfixed_v<src_type_> && hvx::util::is_dfixed_v<wgts_type_> && hvx::util::is_dfixed_v<dst_type_>,
+                  "A per-channel quantized layer needs dfixed src, wgts and dst!");
+    static_assert(hvx::util::CompareDataType<typename src_type_::data_type, uint8_t, uint16_t, int8_t, int16_t>() &&
+                      hvx::util::CompareDataType<typename wgts_type_::data_type, int8_t, int16_t>() &&
+                      hvx::util::CompareDataType<typename bias_type_::data_type, int32_t>() &&
+                      hvx::util::CompareDataType<typename dst_type_::data_type, uint8_t, uint16_t, int8_t, int16_t>(),
+                  "Data type is not supported for a per-channel quantized layer!");
+    static_assert((src_type_::frac_bits == 0) && (wgts_type_::frac_bits == 0) && (dst_type_::frac_bits == 0),
+                  "A per-channel quantized layer uses integer codes without fraction bits!");
+    static_assert((bias_type_::src_zero >= static_cast<int64_t>(std::numeric_limits<typename src_type_::data_type>::lowest())) &&
+                      (bias_type_::src_zero <= static_cast<int64_t>(std::numeric_limits<typename src_type_::data_type>::max())),
+                  "The src zero point is no src code!");
+}
+
+/*!
+ * @brief converts a rational compile time constant to a fixed-point number with "frac_bits_" fraction bits (rounded to nearest)
+ */
+template<typename ratio_, int32_t frac_bits_>
+HVX_FORCE_INLINE constexpr auto
+ConvRatioToFixed() noexcept -> int64_t {
+    constexpr int64_t num = ratio_::num * (static_cast<int64_t>(1) << frac_bits_);
+    return (num >= 0) ? ((num + ratio_::den / 2) / ratio_::den) : ((num - ratio_::den / 2) / ratio_::den);
+}
+
+/*!
+ * @brief applies the activation of the epilogue on a fixed-point number with "frac_bits_" fraction bits (Sigmoid and Tanh are
+ * interpolated from a lookup table, like the gates of the RNN layers)
+ */
+template<typename param_, int32_t frac_bits_>
+HVX_FORCE_INLINE constexpr auto
+ConvEpilogueAct(int64_t res) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    using epilogue      = typename param_::epilogue;
+    constexpr auto arg1 = hvx::nn::impl::ConvRatioToFixed<typename epilogue::arg1, frac_bits_>();
+    constexpr auto arg2 = hvx::nn::impl::ConvRatioToFixed<typename epilogue::arg2, frac_bits_>();
+    switch (epilogue::act) {
+        case hvx::util::elmwise_e::Abs:
+            return hvx::util::Abs(res);
+        case hvx::util::elmwise_e::Clip:
+            return hvx::util::Clamp(res, arg1, arg2);
+        case hvx::util::elmwise_e::MaxConst:
+            return hvx::util::Max(res, arg1);
+        case hvx::util::elmwise_e::MinConst:
+            return hvx::util::Min(res, arg1);
+        case hvx::util::elmwise_e::Sigmoid:
+            return hvx::util::DfixedSigmoid<frac_bits_, param_::underflow_type>(res);
+        case hvx::util::elmwise_e::Tanh:
+            return hvx::util::DfixedTanh<frac_bits_, param_::underflow_type>(res);
+        default:
+            return res;
+    }
+}
+
+/*!
+ * @brief comp global sum, add bias and apply the epilogue and the overflow/underflow policies (using fixed-point numbers). The scale of
+ * the epilogue is applied before the result is rounded to the dst fraction size, the shift and the activation afterwards.
  */
 template<typename param_,
          std::enable_if_t<param_::src_type::is_int, bool>  = true,
@@ -78,12 +146,15 @@ ConvAddBias(int64_t src_chnl_v,
             typename param_::comp_type& sum_global,
             typename param_::bias_type::data_type bias) noexcept -> int64_t {
     HVX_INLINE_TOP();
+    static_assert(!hvx::util::is_dqbias_v<typename param_::bias_type>, "A per-channel quantized layer is requantized by ConvRequant!");
 
-    // fraction sizes
+    // fraction sizes (the scale of the epilogue is a fixed-point number with "scl_frac_bits" fraction bits)
+    using epilogue                   = typename param_::epilogue;
+    constexpr int32_t scl_frac_bits  = (epilogue::is_scaled == true) ? 16 : 0;
     constexpr int32_t bias_frac_bits = param_::bias_type::frac_bits;
     constexpr int32_t dst_frac_bits  = param_::dst_type::frac_bits;
     constexpr int32_t sum_frac_bits  = param_::src_type::frac_bits + param_::wgts_type::frac_bits;
-    constexpr int32_t res_frac_bits  = hvx::util::Max(sum_frac_bits, bias_frac_bits);
+    constexpr int32_t res_frac_bits  = hvx::util::Max(sum_frac_bits, bias_frac_bits) + scl_frac_bits;
     constexpr int32_t dst_shift      = hvx::util::Abs(res_frac_bits - dst_frac_bits);
     constexpr int32_t res_shift      = hvx::util::Abs(sum_frac_bits - bias_frac_bits);
 
@@ -95,11 +166,23 @@ ConvAddBias(int64_t src_chnl_v,
     // sum conv_t and bias_t (shift to value with bigger fraction size)
     auto res = (sum_frac_bits > bias_frac_bits) ? (sum_global_t + (bias_t << res_shift)) : (bias_t + (sum_global_t << res_shift));
 
-    // Rounding (shift to dst fraction size)
-    if (param_::underflow_type == hvx::util::underflow_e::kRound)
+    // epilogue: requantization scale
+    if (epilogue::is_scaled == true)
+        res *= hvx::nn::impl::ConvRatioToFixed<typename epilogue::scale, scl_frac_bits>();
+
+    // Rounding (shift to dst fraction size). A fused epilogue requantizes the result and rounds at half of the dst lsb.
+    if ((param_::underflow_type == hvx::util::underflow_e::kRound) && (epilogue::is_fused == false))
         res += static_cast<int64_t>(1) << hvx::util::Max(res_frac_bits - 1, 0);
+    if ((param_::underflow_type == hvx::util::underflow_e::kRound) && (epilogue::is_fused == true) && (res_frac_bits > dst_frac_bits))
+        res += static_cast<int64_t>(1) << hvx::util::Max(dst_shift - 1, 0);
     res = (res_frac_bits > dst_frac_bits) ? (res >> dst_shift) : (res << dst_shift);
 
+    // epilogue: shift and activation (in the dst fraction size)
+    if (epilogue::is_shifted == true)
+        res += hvx::nn::impl::ConvRatioToFixed<typename epilogue::shift, dst_frac_bits>();
+    if (epilogue::is_active == true)
+        res = hvx::nn::impl::ConvEpilogueAct<param_, dst_frac_bits>(res);
+
     // Check for overflow
     if (param_::overflow_type == hvx::util::overflow_e::kSaturate) {
         res = hvx::util::Max(res, static_cast<int64_t>(std::numeric_limits<typename param_::dst_type::data_type>::lowest()));
@@ -150,17 +233,121 @@ ConvAddBias(int64_t src_chnl_v,
     // convert back and add bias
     float res = static_cast<float>(sum_global_int) * shift_inv + static_cast<float>(bias);
 
+    // epilogue: requantization scale, shift and activation
+    using epilogue = typename param_::epilogue;
+    if (epilogue::is_scaled == true)
+        res *= static_cast<float>(epilogue::scale::num) / static_cast<float>(epilogue::scale::den);
+    if (epilogue::is_shifted == true)
+        res += static_cast<float>(epilogue::shift::num) / static_cast<float>(epilogue::shift::den);
+    if (epilogue::is_active == true) {
+        const auto arg1 = static_cast<float>(epilogue::arg1::num) / static_cast<float>(epilogue::arg1::den);
+        const auto arg2 = static_cast<float>(epilogue::arg2::num) / static_cast<float>(epilogue::arg2::den);
+        res             = hvx::util::FltOp<epilogue::act>(res, arg1, arg2);
+    }
+
     // write the result back
     return res;
 }
 
+/*!
+ * @brief comp global sum (int32), add bias and apply the per-channel requantization (like TFLite/ONNX QLinearConv, rounded once): the
+ * accumulator plus the bias is multiplied by the multiplier of the dst chnl and shifted right by "31 + shift" (rounded half up, down, up
+ * or towards zero by the underflow policy). The shift of the epilogue is the dst zero point, its activation clamps the result in the dst
+ * scale (e.g. Clip for a fused ReLU/ReLU6).
+ */
+template<typename param_, std::enable_if_t<hvx::util::is_dqbias_v<typename param_::bias_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+ConvRequant(int64_t src_chnl_v,
+            int64_t sum_local,
+            typename param_::comp_type& sum_global,
+            const typename param_::bias_type& bias) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+
+    // the accumulator cannot overflow, if all products are summed up in int32
+    using src_data                 = typename param_::src_type::data_type;
+    using wgts_data                = typename param_::wgts_type::data_type;
+    using epilogue                 = typename param_::epilogue;
+    constexpr int64_t src_max      = hvx::util::Max(-static_cast<int64_t>(std::numeric_limits<src_data>::lowest()),
+                                                    static_cast<int64_t>(std::numeric_limits<src_data>::max()));
+    constexpr int64_t wgts_max     = -static_cast<int64_t>(std::numeric_limits<wgts_data>::lowest());
+    constexpr int64_t acc_max      = param_::chnls * param_::knl_elms * src_max * wgts_max;
+    constexpr int64_t int32_max    = std::numeric_limits<int32_t>::max();
+    constexpr int64_t int32_lowest = std::numeric_limits<int32_t>::lowest();
+    static_assert(acc_max <= int32_max, "Possible overflow of the int32 accumulator! To many src chnls!");
+    static_assert(!epilogue::is_scaled, "The scale of a per-channel quantized layer is the multiplier of the bias!");
+    static_assert((epilogue::act == hvx::util::elmwise_e::None) || (epilogue::act == hvx::util::elmwise_e::Clip) ||
+                      (epilogue::act == hvx::util::elmwise_e::MaxConst) || (epilogue::act == hvx::util::elmwise_e::MinConst),
+                  "Activation is not supported by a per-channel quantized layer!");
+
+    // update global summation (int32)
+    const auto sum_global_t = (src_chnl_v == 0) ? (static_cast<int32_t>(sum_local)) : (static_cast<int32_t>(sum_global.data + sum_local));
+    sum_global.data         = sum_global_t;
+
+    // add bias (saturated to int32, so that the product with the multiplier fits into int64)
+    const auto acc = hvx::util::Clamp(static_cast<int64_t>(sum_global_t) + static_cast<int64_t>(bias.data), int32_lowest, int32_max);
+
+    // requantization (an arithmetic right shift rounds down, the underflow policy adds an offset to the product before)
+    const int32_t shift = 31 + static_cast<int32_t>(bias.shift);
+    const int64_t lsb   = static_cast<int64_t>(1) << shift;
+    auto res            = acc * static_cast<int64_t>(bias.mult);
+    if (param_::underflow_type == hvx::util::underflow_e::kRound)
+        res += lsb >> 1;
+    else if (param_::underflow_type == hvx::util::underflow_e::kCeil)
+        res += lsb - 1;
+    else if ((param_::underflow_type == hvx::util::underflow_e::kTrunc) && (res < 0))
+        res += lsb - 1;
+    res >>= shift;
+
+    // epilogue: zero point and activation (in the dst scale)
+    if (epilogue::is_shifted == true)
+        res += hvx::nn::impl::ConvRatioToFixed<typename epilogue::shift, 0>();
+    if (epilogue::is_active == true)
+        res = hvx::nn::impl::ConvEpilogueAct<param_, 0>(res);
+
+    // Check for overflow
+    if (param_::overflow_type == hvx::util::overflow_e::kSaturate) {
+        res = hvx::util::Max(res, static_cast<int64_t>(std::numeric_limits<typename param_::dst_type::data_type>::lowest()));
+        res = hvx::util::Min(res, static_cast<int64_t>(std::numeric_limits<typename param_::dst_type::data_type>::max()));
+    }
+
+    // write the result back
+    return res;
+}
+
+/*!
+ * @brief comp the result of a dst element from its partial sum (add the bias or requantize per dst chnl)
+ */
+template<typename param_, typename sum_type_, std::enable_if_t<hvx::util::is_dfixed_v<typename param_::bias_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+ConvOutput(int64_t src_chnl_v,
+           sum_type_ sum_local,
+           typename param_::comp_type& sum_global,
+           const typename param_::bias_type& bias) noexcept -> sum_type_ {
+    HVX_INLINE_TOP();
+    return hvx::nn::impl::ConvAddBias<param_>(src_chnl_v, sum_local, sum_global, bias.data);
+}
+
+/*!
+ * @brief comp the result of a dst element from its partial sum (add the bias or requantize per dst chnl)
+ */
+template<typename param_, typename sum_type_, std::enable_if_t<hvx::util::is_dqbias_v<typename param_::bias_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+ConvOutput(int64_t src_chnl_v,
+           sum_type_ sum_local,
+           typename param_::comp_type& sum_global,
+           const typename param_::bias_type& bias) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    return hvx::nn::impl::ConvRequant<param_>(src_chnl_v, static_cast<int64_t>(sum_local), sum_global, bias);
+}
+
 /*!
  * @brief comp an vector of dst chnls
  */
 template<typename param_,
          std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool>      = true,
          std::enable_if_t<hvx::util::is_dfixed_v<typename param_::wgts_type>, bool>     = true,
-         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::bias_type>, bool>     = true,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::bias_type> ||
+                              hvx::util::is_dqbias_v<typename param_::bias_type>, bool>    = true,
          std::enable_if_t<hvx::util::is_dfixed_v<typename param_::dst_type>, bool>      = true,
          std::enable_if_t<param_::src_type::is_flt == param_::wgts_type::is_flt, bool>  = true,
          std::enable_if_t<param_::bias_type::is_flt == param_::wgts_type::is_flt, bool> = true,
@@ -174,19 +361,25 @@ ConvComp(int64_t src_chnl_v,
          typename param_::dst_type& dst) noexcept -> void {
     HVX_INLINE_TOP();
 
-    // use float32 or int64 for internal computation (type dependent)
-    using comp_type = std::conditional_t<std::is_integral<typename param_::src_type::data_type>::value, int64_t, float>;
+    // use float32, int64 or int32 (per-channel quantized layer) for internal computation (type dependent)
+    using int_type  = std::conditional_t<hvx::util::is_dqbias_v<typename param_::bias_type>, int32_t, int64_t>;
+    using comp_type = std::conditional_t<std::is_integral<typename param_::src_type::data_type>::value, int_type, float>;
+
+    // kernel elements summed up in one call (a partially vectorized kernel is summed up part by part)
+    constexpr int64_t knl_rows = param_::knl_rows_vec_size;
+    constexpr int64_t knl_cols = param_::knl_cols_vec_size;
+    constexpr int64_t knl_elms = knl_rows * knl_cols;
 
     // variables
     comp_type sum_local{};
 
     //
     for (int64_t src_chnl_p = 0; src_chnl_p < param_::chnl_vec_size; ++src_chnl_p) {
-        for (int64_t knl_row = 0; knl_row < param_::knl_rows; ++knl_row) {
-            for (int64_t knl_col = 0; knl_col < param_::knl_cols; ++knl_col) {
-                const int64_t win_ptr  = src_chnl_p * param_::knl_elms + knl_row * param_::knl_cols + knl_col;
-                const int64_t knl_ptr  = (param_::knl_rows - 1 - knl_row) * param_::knl_cols + (param_::knl_cols - 1 - knl_col);
-                const int64_t wgts_ptr = (src_chnl_p * param_::knl_elms) + knl_ptr;
+        for (int64_t knl_row = 0; knl_row < knl_rows; ++knl_row) {
+            for (int64_t knl_col = 0; knl_col < knl_cols; ++knl_col) {
+                const int64_t win_ptr  = src_chnl_p * knl_elms + knl_row * knl_cols + knl_col;
+                const int64_t knl_ptr  = (knl_rows - 1 - knl_row) * knl_cols + (knl_cols - 1 - knl_col);
+                const int64_t wgts_ptr = (src_chnl_p * knl_elms) + knl_ptr;
                 const auto src         = static_cast<comp_type>(win_vec.Get(win_ptr).data);
                 const auto wgt         = static_cast<comp_type>(wgts_vec.Get(wgts_ptr).data);
                 sum_local += src * wgt;
@@ -194,8 +387,8 @@ ConvComp(int64_t src_chnl_v,
         }
     }
 
-    // comp global sum, add bias and apply overflow/underflow policies
-    const auto res = hvx::nn::impl::ConvAddBias<param_>(src_chnl_v, sum_local, sum_global, bias.data);
+    // comp global sum, add bias (or requantize) and apply overflow/underflow policies
+    const auto res = hvx::nn::impl::ConvOutput<param_>(src_chnl_v, sum_local, sum_global, bias);
 
     // convert to dst type
     dst.data = static_cast<typename param_::dst_type::data_type>(res);
@@ -64,6 +64,8 @@ ConvComp(int64_t chnl_v,
          typename param_::bias_type& bias,
          typename param_::dst_type& dst) noexcept -> void {
     HVX_INLINE_TOP();
+    static_assert(!param_::epilogue::is_scaled && !param_::epilogue::is_shifted && !param_::epilogue::is_active,
+                  "The epilogue is not supported for dfloat!");
 
     //
     constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
@@ -76,16 +78,21 @@ ConvComp(int64_t chnl_v,
     constexpr auto add_man_bits = hvx::util::Max(param_::comp_type::man_bits, param_::bias_type::man_bits);
     using add_type              = dynfloat::dfloat<add_exp_bits, add_man_bits>;
 
+    // kernel elements summed up in one call (a partially vectorized kernel is summed up part by part)
+    constexpr int64_t knl_rows = param_::knl_rows_vec_size;
+    constexpr int64_t knl_cols = param_::knl_cols_vec_size;
+    constexpr int64_t knl_elms = knl_rows * knl_cols;
+
     // variables
     typename param_::comp_type sum_local{};
 
     // compute local sum
     for (int64_t src_chnl_p = 0; src_chnl_p < param_::chnl_vec_size; ++src_chnl_p) {
-        for (int64_t knl_row = 0; knl_row < param_::knl_rows; ++knl_row) {
-            for (int64_t knl_col = 0; knl_col < param_::knl_cols; ++knl_col) {
-                const int64_t win_ptr  = src_chnl_p * param_::knl_elms + knl_row * param_::knl_cols + knl_col;
-                const int64_t knl_ptr  = (param_::knl_rows - 1 - knl_row) * param_::knl_cols + (param_::knl_cols - 1 - knl_col);
-                const int64_t wgts_ptr = (src_chnl_p * param_::knl_elms) + knl_ptr;
+        for (int64_t knl_row = 0; knl_row < knl_rows; ++knl_row) {
+            for (int64_t knl_col = 0; knl_col < knl_cols; ++knl_col) {
+                const int64_t win_ptr  = src_chnl_p * knl_elms + knl_row * knl_cols + knl_col;
+                const int64_t knl_ptr  = (knl_rows - 1 - knl_row) * knl_cols + (knl_cols - 1 - knl_col);
+                const int64_t wgts_ptr = (src_chnl_p * knl_elms) + knl_ptr;
 
                 //
                 const auto mul =
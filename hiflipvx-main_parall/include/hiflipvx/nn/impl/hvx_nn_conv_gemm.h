@@ -0,0 +1,485 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_conv_gemm.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  CPU fast path of the conv layer for the C-simulation (dfixed only): im2col followed by a cache blocked GEMM (AVX-512, AVX2 or scalar,
+ *  selected at compile time). The sums and the final bias/rounding/overflow step (ConvAddBias) are bit exact with ConvComp. Integers are
+ *  summed exactly in 64 bit, floats are summed per src chnl vector in the same order as ConvComp (bit exact as long as the compiler does
+ *  not contract the float multiply-adds differently, e.g. -ffp-contract=off). ConvGemmTop calls it directly, a layer with
+ *  "sim_type_ = sim_e::kGemm" in its ConvParam/DenseParam uses it in ConvTop/DenseTop. Not available during synthesis.
+ */
+
+#ifndef HVX_NN_CONV_GEMM_H_
+#define HVX_NN_CONV_GEMM_H_
+
+#include "hvx_nn_conv_dfixed.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <algorithm>
+#include <limits>
+#include <vector>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+// number of dst pixels that are converted by im2col at once
+#ifndef HVX_SIM_GEMM_BLOCK_M
+#define HVX_SIM_GEMM_BLOCK_M 64
+#endif
+
+// maximum number of kernel elements (K dimension) that are multiplied at once
+#ifndef HVX_SIM_GEMM_BLOCK_K
+#define HVX_SIM_GEMM_BLOCK_K 256
+#endif
+
+namespace hvx {
+namespace nn {
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief largest absolute value of an integer type (the maximum of an int64 if it does not fit into an int64, 0 for floats)
+ */
+template<typename data_>
+constexpr auto
+ConvGemmAbsMax() noexcept -> int64_t {
+    if (std::numeric_limits<data_>::is_integer == false)
+        return 0;
+    if (std::numeric_limits<data_>::digits >= std::numeric_limits<int64_t>::digits)
+        return std::numeric_limits<int64_t>::max();
+    return hvx::util::Max(static_cast<int64_t>(std::numeric_limits<data_>::max()),
+                          -static_cast<int64_t>(std::numeric_limits<data_>::lowest()));
+}
+
+/*!
+ * @brief Compile time parameters of the conv GEMM
+ */
+template<typename param_>
+struct ConvGemmParam {
+    using src_data  = typename param_::src_type::data_type;
+    using wgts_data = typename param_::wgts_type::data_type;
+
+    // largest absolute value of a src and a wgts element (integer only)
+    static constexpr bool is_flt      = param_::src_type::is_flt;
+    static constexpr int64_t src_max  = hvx::nn::impl::ConvGemmAbsMax<src_data>();
+    static constexpr int64_t wgts_max = hvx::nn::impl::ConvGemmAbsMax<wgts_data>();
+
+    // integers are packed into int32 if src and wgts fit into it (the SIMD kernels multiply signed int32) and summed in int32 lanes if at
+    // least "acc32_min" products fit into an int32. All other integers (e.g. uint32 or int64) are packed into int64.
+    static constexpr int64_t acc32_min = 16;
+    static constexpr bool pack32       = !is_flt && (src_max <= std::numeric_limits<int32_t>::max()) &&
+                                   (wgts_max <= std::numeric_limits<int32_t>::max());
+    static constexpr int64_t prod_max  = pack32 ? hvx::util::Max(src_max * wgts_max, static_cast<int64_t>(1)) : 1;
+    static constexpr int64_t acc32_len = pack32 ? (std::numeric_limits<int32_t>::max() / prod_max) : 0;
+    static constexpr bool acc32        = acc32_len >= acc32_min;
+    using pack_type                    = std::conditional_t<is_flt, float, std::conditional_t<pack32, int32_t, int64_t>>;
+    using acc_type                     = std::conditional_t<is_flt, float, int64_t>;
+
+    // number of dst chnls (N dimension) computed by one SIMD tile
+#if defined(__AVX512F__)
+    static constexpr int64_t n_tile = (!pack32) ? 1 : (acc32 ? 32 : 16);
+#elif defined(__AVX2__)
+    static constexpr int64_t n_tile = (!pack32) ? 1 : (acc32 ? 16 : 8);
+#else
+    static constexpr int64_t n_tile = 1;
+#endif
+
+    // GEMM dimensions (M = dst pixels, N = fms, K = chnls * knl elements) and blocking
+    static constexpr int64_t m_elms  = param_::dst_rows * param_::dst_cols;
+    static constexpr int64_t n_elms  = param_::fms;
+    static constexpr int64_t n_pad   = ((n_elms + n_tile - 1) / n_tile) * n_tile;
+    static constexpr int64_t k_elms  = param_::chnls * param_::knl_elms;
+    static constexpr int64_t m_block = hvx::util::Min(static_cast<int64_t>(HVX_SIM_GEMM_BLOCK_M), m_elms);
+    static constexpr int64_t k_block = is_flt ? param_::sum_elms
+                                              : (acc32 ? hvx::util::Min(static_cast<int64_t>(HVX_SIM_GEMM_BLOCK_K), acc32_len)
+                                                       : static_cast<int64_t>(HVX_SIM_GEMM_BLOCK_K));
+    static constexpr int64_t m_rows  = 4; // rows of a register tile
+};
+
+/*!
+ * @brief name of the instruction set the GEMM kernels were compiled for ("none" if only the scalar kernel is available)
+ */
+constexpr auto
+ConvGemmIsa() noexcept -> const char* {
+#if defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX2__)
+    return "AVX2";
+#else
+    return "none";
+#endif
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief acc[m][n] += sum_k a[m][k] * b[k][n] for "rows_" rows (scalar, k ascending for every element)
+ */
+template<int64_t rows_, typename pack_type_, typename acc_type_>
+HVX_FORCE_INLINE auto
+ConvGemmKernelScalar(const pack_type_* a, int64_t a_stride, const pack_type_* b, int64_t n_pad, int64_t k_len, acc_type_* acc,
+                     int64_t acc_stride) noexcept -> void {
+    for (int64_t row = 0; row < rows_; ++row) {
+        const pack_type_* a_row = a + row * a_stride;
+        acc_type_* acc_row      = acc + row * acc_stride;
+        for (int64_t k = 0; k < k_len; ++k) {
+            const auto a_elm        = static_cast<acc_type_>(a_row[k]);
+            const pack_type_* b_row = b + k * n_pad;
+            for (int64_t n = 0; n < n_pad; ++n)
+                acc_row[n] += a_elm * static_cast<acc_type_>(b_row[n]);
+        }
+    }
+}
+
+/*!
+ * @brief acc[m][n] += sum_k a[m][k] * b[k][n] for "rows_" rows (int32 lanes, "k_len" products must fit into an int32)
+ */
+template<int64_t rows_>
+HVX_FORCE_INLINE auto
+ConvGemmKernelAcc32(const int32_t* a, int64_t a_stride, const int32_t* b, int64_t n_pad, int64_t k_len, int64_t* acc,
+                    int64_t acc_stride) noexcept -> void {
+#if defined(__AVX512F__)
+    for (int64_t n = 0; n < n_pad; n += 32) {
+        __m512i sum[rows_][2];
+        for (int64_t row = 0; row < rows_; ++row) {
+            sum[row][0] = _mm512_setzero_si512();
+            sum[row][1] = _mm512_setzero_si512();
+        }
+        for (int64_t k = 0; k < k_len; ++k) {
+            const __m512i b0 = _mm512_loadu_si512(b + k * n_pad + n);
+            const __m512i b1 = _mm512_loadu_si512(b + k * n_pad + n + 16);
+            for (int64_t row = 0; row < rows_; ++row) {
+                const __m512i a_elm = _mm512_set1_epi32(a[row * a_stride + k]);
+                sum[row][0]         = _mm512_add_epi32(sum[row][0], _mm512_mullo_epi32(a_elm, b0));
+                sum[row][1]         = _mm512_add_epi32(sum[row][1], _mm512_mullo_epi32(a_elm, b1));
+            }
+        }
+        for (int64_t row = 0; row < rows_; ++row) {
+            for (int64_t half = 0; half < 2; ++half) {
+                int64_t* acc_ptr = acc + row * acc_stride + n + half * 16;
+                const __m512i lo = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(sum[row][half]));
+                const __m512i hi = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(sum[row][half], 1));
+                _mm512_storeu_si512(acc_ptr, _mm512_add_epi64(_mm512_loadu_si512(acc_ptr), lo));
+                _mm512_storeu_si512(acc_ptr + 8, _mm512_add_epi64(_mm512_loadu_si512(acc_ptr + 8), hi));
+            }
+        }
+    }
+#elif defined(__AVX2__)
+    for (int64_t n = 0; n < n_pad; n += 16) {
+        __m256i sum[rows_][2];
+        for (int64_t row = 0; row < rows_; ++row) {
+            sum[row][0] = _mm256_setzero_si256();
+            sum[row][1] = _mm256_setzero_si256();
+        }
+        for (int64_t k = 0; k < k_len; ++k) {
+            const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k * n_pad + n));     // NOLINT
+            const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k * n_pad + n + 8)); // NOLINT
+            for (int64_t row = 0; row < rows_; ++row) {
+                const __m256i a_elm = _mm256_set1_epi32(a[row * a_stride + k]);
+                sum[row][0]         = _mm256_add_epi32(sum[row][0], _mm256_mullo_epi32(a_elm, b0));
+                sum[row][1]         = _mm256_add_epi32(sum[row][1], _mm256_mullo_epi32(a_elm, b1));
+            }
+        }
+        for (int64_t row = 0; row < rows_; ++row) {
+            for (int64_t half = 0; half < 2; ++half) {
+                auto* acc_ptr    = reinterpret_cast<__m256i*>(acc + row * acc_stride + n + half * 8); // NOLINT
+                const __m256i lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(sum[row][half]));
+                const __m256i hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(sum[row][half], 1));
+                _mm256_storeu_si256(acc_ptr, _mm256_add_epi64(_mm256_loadu_si256(acc_ptr), lo));
+                _mm256_storeu_si256(acc_ptr + 1, _mm256_add_epi64(_mm256_loadu_si256(acc_ptr + 1), hi));
+            }
+        }
+    }
+#else
+    hvx::nn::impl::ConvGemmKernelScalar<rows_>(a, a_stride, b, n_pad, k_len, acc, acc_stride);
+#endif
+}
+
+/*!
+ * @brief acc[m][n] += sum_k a[m][k] * b[k][n] for "rows_" rows (int64 lanes, signed 32 x 32 bit products)
+ */
+template<int64_t rows_>
+HVX_FORCE_INLINE auto
+ConvGemmKernelAcc64(const int32_t* a, int64_t a_stride, const int32_t* b, int64_t n_pad, int64_t k_len, int64_t* acc,
+                    int64_t acc_stride) noexcept -> void {
+#if defined(__AVX512F__)
+    for (int64_t n = 0; n < n_pad; n += 16) {
+        __m512i sum[rows_][2];
+        for (int64_t row = 0; row < rows_; ++row) {
+            sum[row][0] = _mm512_loadu_si512(acc + row * acc_stride + n);
+            sum[row][1] = _mm512_loadu_si512(acc + row * acc_stride + n + 8);
+        }
+        for (int64_t k = 0; k < k_len; ++k) {
+            const __m512i b0 = _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k * n_pad + n))); // NOLINT
+            const __m512i b1 = _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k * n_pad + n) + 1)); // NOLINT
+            for (int64_t row = 0; row < rows_; ++row) {
+                const __m512i a_elm = _mm512_set1_epi64(a[row * a_stride + k]);
+                sum[row][0]         = _mm512_add_epi64(sum[row][0], _mm512_mul_epi32(a_elm, b0));
+                sum[row][1]         = _mm512_add_epi64(sum[row][1], _mm512_mul_epi32(a_elm, b1));
+            }
+        }
+        for (int64_t row = 0; row < rows_; ++row) {
+            _mm512_storeu_si512(acc + row * acc_stride + n, sum[row][0]);
+            _mm512_storeu_si512(acc + row * acc_stride + n + 8, sum[row][1]);
+        }
+    }
+#elif defined(__AVX2__)
+    for (int64_t n = 0; n < n_pad; n += 8) {
+        __m256i sum[rows_][2];
+        for (int64_t row = 0; row < rows_; ++row) {
+            sum[row][0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + row * acc_stride + n));     // NOLINT
+            sum[row][1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + row * acc_stride + n + 4)); // NOLINT
+        }
+        for (int64_t k = 0; k < k_len; ++k) {
+            const __m256i b0 = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + k * n_pad + n)));     // NOLINT
+            const __m256i b1 = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + k * n_pad + n + 4))); // NOLINT
+            for (int64_t row = 0; row < rows_; ++row) {
+                const __m256i a_elm = _mm256_set1_epi64x(a[row * a_stride + k]);
+                sum[row][0]         = _mm256_add_epi64(sum[row][0], _mm256_mul_epi32(a_elm, b0));
+                sum[row][1]         = _mm256_add_epi64(sum[row][1], _mm256_mul_epi32(a_elm, b1));
+            }
+        }
+        for (int64_t row = 0; row < rows_; ++row) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + row * acc_stride + n), sum[row][0]);     // NOLINT
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + row * acc_stride + n + 4), sum[row][1]); // NOLINT
+        }
+    }
+#else
+    hvx::nn::impl::ConvGemmKernelScalar<rows_>(a, a_stride, b, n_pad, k_len, acc, acc_stride);
+#endif
+}
+
+/*!
+ * @brief multiplies "rows" rows of the im2col block with a block of the packed weights (selects the kernel of the data types)
+ */
+template<typename gemm_, int64_t rows_>
+HVX_FORCE_INLINE auto
+ConvGemmKernel(const typename gemm_::pack_type* a,
+               const typename gemm_::pack_type* b,
+               int64_t k_len,
+               typename gemm_::acc_type* acc) noexcept -> void {
+    constexpr int64_t a_stride   = gemm_::k_elms;
+    constexpr int64_t acc_stride = gemm_::n_pad;
+    if (gemm_::n_tile == 1)
+        hvx::nn::impl::ConvGemmKernelScalar<rows_>(a, a_stride, b, gemm_::n_pad, k_len, acc, acc_stride);
+    else if (gemm_::acc32)
+        hvx::nn::impl::ConvGemmKernelAcc32<rows_>(reinterpret_cast<const int32_t*>(a), a_stride, reinterpret_cast<const int32_t*>(b),
+                                                  gemm_::n_pad, k_len, reinterpret_cast<int64_t*>(acc), acc_stride); // NOLINT
+    else
+        hvx::nn::impl::ConvGemmKernelAcc64<rows_>(reinterpret_cast<const int32_t*>(a), a_stride, reinterpret_cast<const int32_t*>(b),
+                                                  gemm_::n_pad, k_len, reinterpret_cast<int64_t*>(acc), acc_stride); // NOLINT
+}
+
+/*!
+ * @brief multiplies all rows of the im2col block with a block of the packed weights (register tiles of "m_rows" rows)
+ */
+template<typename gemm_>
+HVX_FORCE_INLINE auto
+ConvGemmBlock(const typename gemm_::pack_type* a, const typename gemm_::pack_type* b, int64_t rows, int64_t k_len,
+              typename gemm_::acc_type* acc) noexcept -> void {
+    int64_t row = 0;
+    for (; row + gemm_::m_rows <= rows; row += gemm_::m_rows)
+        hvx::nn::impl::ConvGemmKernel<gemm_, gemm_::m_rows>(a + row * gemm_::k_elms, b, k_len, acc + row * gemm_::n_pad);
+    for (; row < rows; ++row)
+        hvx::nn::impl::ConvGemmKernel<gemm_, 1>(a + row * gemm_::k_elms, b, k_len, acc + row * gemm_::n_pad);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief packs the weights into a K x N matrix (flipped kernel, like in ConvComp)
+ */
+template<typename param_, typename gemm_ = hvx::nn::impl::ConvGemmParam<param_>>
+auto
+ConvGemmPackWgts(const typename param_::wgts_vec* wgts, std::vector<typename gemm_::pack_type>& b) -> void {
+    b.assign(static_cast<std::size_t>(gemm_::k_elms * gemm_::n_pad), 0);
+    for (int64_t fm = 0; fm < param_::fms; ++fm) {
+        const int64_t fm_v = fm / param_::fm_vec_size;
+        const int64_t fm_p = fm % param_::fm_vec_size;
+        for (int64_t chnl = 0; chnl < param_::chnls; ++chnl) {
+            const int64_t chnl_v = chnl / param_::chnl_vec_size;
+            const int64_t chnl_p = chnl % param_::chnl_vec_size;
+            const auto& wgts_vec = wgts[fm_v * param_::chnl_vec_elms + chnl_v]; // NOLINT
+            for (int64_t knl_pix = 0; knl_pix < param_::knl_elms; ++knl_pix) {
+                const int64_t knl_ptr = param_::knl_elms - 1 - knl_pix;
+                const int64_t k       = chnl * param_::knl_elms + knl_pix;
+                b[static_cast<std::size_t>(k * gemm_::n_pad + fm)] = static_cast<typename gemm_::pack_type>(
+                    wgts_vec.data[fm_p * param_::sum_elms + chnl_p * param_::knl_elms + knl_ptr].data); // NOLINT
+            }
+        }
+    }
+}
+
+/*!
+ * @brief converts the windows of "rows" dst pixels (starting at "m_beg") of a sample into the rows of a matrix (im2col). The window is
+ * stored in reverse order (like the window of WinUpdate), so the floats are summed in the same order as in ConvComp. Padded elements are
+ * the src zero point (like in WinUpdate).
+ */
+template<typename param_, typename gemm_ = hvx::nn::impl::ConvGemmParam<param_>>
+auto
+ConvGemmIm2col(const typename param_::src_vec* src, int64_t m_beg, int64_t rows, typename gemm_::pack_type* a) -> void {
+    std::fill(a, a + rows * gemm_::k_elms, static_cast<typename gemm_::pack_type>(param_::src_zero));
+    for (int64_t row = 0; row < rows; ++row) {
+        const int64_t dst_row = (m_beg + row) / param_::dst_cols;
+        const int64_t dst_col = (m_beg + row) % param_::dst_cols;
+        for (int64_t knl_row = 0; knl_row < param_::knl_rows; ++knl_row) {
+            const int64_t src_row = dst_row * param_::str_rows - param_::pad_rows_up + knl_row * (param_::dil_rows + 1);
+            if (src_row < 0 || src_row >= param_::src_rows)
+                continue;
+            for (int64_t knl_col = 0; knl_col < param_::knl_cols; ++knl_col) {
+                const int64_t src_col = dst_col * param_::str_cols - param_::pad_cols_left + knl_col * (param_::dil_cols + 1);
+                if (src_col < 0 || src_col >= param_::src_cols)
+                    continue;
+                const int64_t knl_pix = (param_::knl_rows - 1 - knl_row) * param_::knl_cols + (param_::knl_cols - 1 - knl_col);
+                const auto* src_pix   = src + (src_row * param_::src_cols + src_col) * param_::chnl_vec_elms; // NOLINT
+                for (int64_t chnl = 0; chnl < param_::chnls; ++chnl) {
+                    const auto data = src_pix[chnl / param_::chnl_vec_size].data[chnl % param_::chnl_vec_size].data; // NOLINT
+                    a[row * gemm_::k_elms + chnl * param_::knl_elms + knl_pix] = static_cast<typename gemm_::pack_type>(data);
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * @brief applies ConvAddBias (or ConvRequant) on a summation and converts it to the dst type
+ */
+template<typename param_, bool with_bias_>
+HVX_FORCE_INLINE auto
+ConvGemmStore(int64_t chnl_v,
+              typename param_::comp_type& sum_global,
+              typename hvx::nn::impl::ConvGemmParam<param_>::acc_type sum_local,
+              const typename param_::bias_vec* bias,
+              int64_t fm,
+              typename param_::dst_vec* dst_pix) noexcept -> void {
+    const int64_t fm_v = fm / param_::fm_vec_size;
+    const int64_t fm_p = fm % param_::fm_vec_size;
+    typename param_::bias_type bias_data{};
+    if (with_bias_)
+        bias_data = bias[fm_v].data[fm_p]; // NOLINT
+    const auto res = hvx::nn::impl::ConvOutput<param_>(chnl_v, sum_local, sum_global, bias_data);
+    dst_pix[fm_v].data[fm_p].data = static_cast<typename param_::dst_type::data_type>(res); // NOLINT
+}
+
+/*!
+ * @brief conv layer computed by im2col and GEMM (integers are summed over all chnls at once)
+ */
+template<typename param_, bool with_bias_, std::enable_if_t<param_::src_type::is_int, bool> = true>
+auto
+ConvGemmSample(const typename param_::src_vec* src,
+               const std::vector<typename hvx::nn::impl::ConvGemmParam<param_>::pack_type>& b,
+               const typename param_::bias_vec* bias,
+               typename param_::dst_vec* dst) -> void {
+    using gemm = hvx::nn::impl::ConvGemmParam<param_>;
+    std::vector<typename gemm::pack_type> a(static_cast<std::size_t>(gemm::m_block * gemm::k_elms));
+    std::vector<int64_t> acc(static_cast<std::size_t>(gemm::m_block * gemm::n_pad));
+    for (int64_t m_beg = 0; m_beg < gemm::m_elms; m_beg += gemm::m_block) {
+        const int64_t rows = hvx::util::Min(gemm::m_block, gemm::m_elms - m_beg);
+        hvx::nn::impl::ConvGemmIm2col<param_>(src, m_beg, rows, a.data());
+        std::fill(acc.begin(), acc.end(), 0);
+        for (int64_t k_beg = 0; k_beg < gemm::k_elms; k_beg += gemm::k_block) {
+            const int64_t k_len = hvx::util::Min(gemm::k_block, gemm::k_elms - k_beg);
+            hvx::nn::impl::ConvGemmBlock<gemm>(a.data() + k_beg, b.data() + k_beg * gemm::n_pad, rows, k_len, acc.data());
+        }
+        for (int64_t row = 0; row < rows; ++row) {
+            auto* dst_pix = dst + (m_beg + row) * param_::fm_vec_elms; // NOLINT
+            for (int64_t fm = 0; fm < param_::fms; ++fm) {
+                typename param_::comp_type sum_global{};
+                hvx::nn::impl::ConvGemmStore<param_, with_bias_>(0, sum_global, acc[static_cast<std::size_t>(row * gemm::n_pad + fm)],
+                                                                 bias, fm, dst_pix);
+            }
+        }
+    }
+}
+
+/*!
+ * @brief conv layer computed by im2col and GEMM (floats are summed per src chnl vector like in ConvComp)
+ */
+template<typename param_, bool with_bias_, std::enable_if_t<param_::src_type::is_flt, bool> = true>
+auto
+ConvGemmSample(const typename param_::src_vec* src,
+               const std::vector<typename hvx::nn::impl::ConvGemmParam<param_>::pack_type>& b,
+               const typename param_::bias_vec* bias,
+               typename param_::dst_vec* dst) -> void {
+    using gemm = hvx::nn::impl::ConvGemmParam<param_>;
+    std::vector<float> a(static_cast<std::size_t>(gemm::m_block * gemm::k_elms));
+    std::vector<float> acc(static_cast<std::size_t>(gemm::m_block * gemm::n_pad));
+    std::vector<typename param_::comp_type> sum_global(static_cast<std::size_t>(gemm::m_block * gemm::n_pad));
+    for (int64_t m_beg = 0; m_beg < gemm::m_elms; m_beg += gemm::m_block) {
+        const int64_t rows = hvx::util::Min(gemm::m_block, gemm::m_elms - m_beg);
+        hvx::nn::impl::ConvGemmIm2col<param_>(src, m_beg, rows, a.data());
+        for (int64_t chnl_v = 0; chnl_v < param_::chnl_vec_elms; ++chnl_v) {
+            const int64_t k_beg = chnl_v * param_::sum_elms;
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            hvx::nn::impl::ConvGemmBlock<gemm>(a.data() + k_beg, b.data() + k_beg * gemm::n_pad, rows, param_::sum_elms, acc.data());
+            for (int64_t row = 0; row < rows; ++row) {
+                auto* dst_pix = dst + (m_beg + row) * param_::fm_vec_elms; // NOLINT
+                for (int64_t fm = 0; fm < param_::fms; ++fm) {
+                    const auto ptr = static_cast<std::size_t>(row * gemm::n_pad + fm);
+                    hvx::nn::impl::ConvGemmStore<param_, with_bias_>(chnl_v, sum_global[ptr], acc[ptr], bias, fm, dst_pix);
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * @brief conv layer computed by im2col and GEMM for all samples of the batch (src and dst need to be in memory)
+ */
+template<typename param_,
+         bool with_bias_,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool> = true,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::dst_type>, bool> = true>
+auto
+ConvGemm(const typename param_::src_vec* src,
+         const typename param_::wgts_vec* wgts,
+         const typename param_::bias_vec* bias,
+         typename param_::dst_vec* dst) -> bool {
+    using gemm = hvx::nn::impl::ConvGemmParam<param_>;
+    constexpr int64_t src_sample_elms = param_::src_rows * param_::src_cols * param_::chnl_vec_elms;
+    constexpr int64_t dst_sample_elms = gemm::m_elms * param_::fm_vec_elms;
+    std::vector<typename gemm::pack_type> b;
+    hvx::nn::impl::ConvGemmPackWgts<param_>(wgts, b);
+    for (int64_t batch = 0; batch < param_::batch; ++batch)
+        hvx::nn::impl::ConvGemmSample<param_, with_bias_>(src + batch * src_sample_elms, b, bias, dst + batch * dst_sample_elms);
+    return true;
+}
+
+/*!
+ * @brief the GEMM is not available for the data types (the caller uses the streaming implementation)
+ */
+template<typename param_,
+         bool with_bias_,
+         std::enable_if_t<!hvx::util::is_dfixed_v<typename param_::src_type> || !hvx::util::is_dfixed_v<typename param_::dst_type>, bool> =
+             true>
+auto
+ConvGemm(const typename param_::src_vec*,
+         const typename param_::wgts_vec*,
+         const typename param_::bias_vec*,
+         typename param_::dst_vec*) -> bool {
+    return false;
+}
+
+/******************************************************************************************************************************************/
+} // namespace impl
+} // namespace nn
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE
+#endif // HVX_NN_CONV_GEMM_H_
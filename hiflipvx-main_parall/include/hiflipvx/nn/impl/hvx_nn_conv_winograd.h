@@ -0,0 +1,385 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_conv_winograd.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Winograd F(2x2,3x3) and F(4x4,3x3) kernels of the conv layer: Y = A^T [(G g G^T) * (B^T d B)] A (matrices of Lavin & Gray). The
+ *  weights are transformed once at load time (ConvWinogradWeights), B^T and A^T only contain integers, so for dfixed the input transform,
+ *  the products, the sum over all src chnls and the output transform are computed in int64 and the only additional error is the rounding
+ *  of the transformed weights U = G g G^T to the wgts type. If the transform domain could overflow int64 (wide wgts or many src chnls),
+ *  the products are shifted right by WinogradShiftBits() before they are summed (and the result is shifted back after the output
+ *  transform).\n
+ *  Precision bounds (per dst element, compared to the direct conv with the untransformed wgts, see ConvWinogradErrorBound):
+ *  - F(2x2,3x3): |V| <= 4 * max|d|, |U| <= 2.25 * max|g| (wgts need 2 more integer bits), the output transform amplifies the rounding
+ *    error of U by up to 9, i.e. |err| <= chnls * 36 * max|d| * 2^-(wgts_frac + 1).
+ *  - F(4x4,3x3): |V| <= 100 * max|d|, |U| <= max|g|, the output transform amplifies by up to 361, i.e. |err| <= chnls * 36100 * max|d| *
+ *    2^-(wgts_frac + 1). This is ~10 bits more than for F(2x2,3x3), so the wgts need at least WinogradFracBits() = 10 more fraction bits
+ *    than the dst (e.g. int32 wgts for int16 dst), which is verified at compile time.
+ *  Both results are rounded to the dst type, which adds up to one dst lsb.
+ *  The float mode sums in float32 and converts to int48 (like ConvAddBias) at the end of the output transform.
+ */
+
+#ifndef HVX_NN_CONV_WINOGRAD_H_
+#define HVX_NN_CONV_WINOGRAD_H_
+
+#include "hvx_nn_conv_dfixed.h"
+#include <cmath>
+#include <limits>
+
+namespace hvx {
+namespace nn {
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief data type of the transform domain (int64 for fixed-point, float32 for floating-point and dfloat)
+ */
+template<typename type_, typename = void>
+struct conv_winograd_type {
+    using type = float;
+};
+template<typename type_>
+struct conv_winograd_type<type_, std::enable_if_t<hvx::util::is_dfixed_v<type_>>> {
+    using type = std::conditional_t<std::is_integral<typename type_::data_type>::value, int64_t, float>;
+};
+template<typename type_>
+using conv_winograd_type_t = typename conv_winograd_type<type_>::type;
+
+/*!
+ * @brief coefficient of the input transform B^T (tile_ + 2 rows and cols)
+ */
+template<int64_t tile_>
+HVX_FORCE_INLINE constexpr auto
+WinogradBt(int64_t row, int64_t col) noexcept -> int64_t {
+    constexpr int64_t bt2[4][4] = {{1, 0, -1, 0}, {0, 1, 1, 0}, {0, -1, 1, 0}, {0, 1, 0, -1}};
+    constexpr int64_t bt4[6][6] = {{4, 0, -5, 0, 1, 0},  {0, -4, -4, 1, 1, 0}, {0, 4, -4, -1, 1, 0},
+                                   {0, -2, -1, 2, 1, 0}, {0, 2, -1, -2, 1, 0}, {0, 4, 0, -5, 0, 1}};
+    return (tile_ == 2) ? bt2[row][col] : bt4[row][col]; // NOLINT
+}
+
+/*!
+ * @brief coefficient of the output transform A^T (tile_ rows, tile_ + 2 cols)
+ */
+template<int64_t tile_>
+HVX_FORCE_INLINE constexpr auto
+WinogradAt(int64_t row, int64_t col) noexcept -> int64_t {
+    constexpr int64_t at2[2][4] = {{1, 1, 1, 0}, {0, 1, -1, -1}};
+    constexpr int64_t at4[4][6] = {{1, 1, 1, 1, 1, 0}, {0, 1, -1, 2, -2, 0}, {0, 1, 1, 4, 4, 0}, {0, 1, -1, 8, -8, 1}};
+    return (tile_ == 2) ? at2[row][col] : at4[row][col]; // NOLINT
+}
+
+/*!
+ * @brief coefficient of the weights transform G (tile_ + 2 rows, 3 cols)
+ */
+template<int64_t tile_>
+constexpr auto
+WinogradG(int64_t row, int64_t col) noexcept -> double {
+    constexpr double g2[4][3] = {{1.0, 0.0, 0.0}, {0.5, 0.5, 0.5}, {0.5, -0.5, 0.5}, {0.0, 0.0, 1.0}};
+    constexpr double g4[6][3] = {{1.0 / 4.0, 0.0, 0.0},
+                                 {-1.0 / 6.0, -1.0 / 6.0, -1.0 / 6.0},
+                                 {-1.0 / 6.0, 1.0 / 6.0, -1.0 / 6.0},
+                                 {1.0 / 24.0, 1.0 / 12.0, 1.0 / 6.0},
+                                 {1.0 / 24.0, -1.0 / 12.0, 1.0 / 6.0},
+                                 {0.0, 0.0, 1.0}};
+    return (tile_ == 2) ? g2[row][col] : g4[row][col]; // NOLINT
+}
+
+/*!
+ * @brief gains of the transforms: |V| <= gain_v * max|d|, |U| <= gain_u * max|g| and |A^T M A| <= gain_a * max|M| (squared largest
+ * sum of the absolute coefficients of a row of B^T, G and A^T)
+ */
+template<int64_t tile_>
+struct WinogradGain {
+    static constexpr double gain_v = (tile_ == 2) ? (2.0 * 2.0) : (10.0 * 10.0);
+    static constexpr double gain_u = (tile_ == 2) ? (1.5 * 1.5) : (1.0 * 1.0);
+    static constexpr double gain_a = (tile_ == 2) ? (3.0 * 3.0) : (19.0 * 19.0);
+};
+
+/*!
+ * @brief number of bits the transforms add to the product of src and wgts (input and output transform, sum over all src chnls)
+ */
+template<int64_t tile_, int64_t chnls_>
+constexpr auto
+WinogradGrowthBits() noexcept -> int64_t {
+    return (tile_ == 2) ? (2 + 4 + hvx::util::Log2Ceil(chnls_)) : (7 + 9 + hvx::util::Log2Ceil(chnls_));
+}
+
+/*!
+ * @brief number of fraction bits the wgts need in addition to the dst (the error bound of F(4x4,3x3) is ~10 bits larger than the one of
+ * F(2x2,3x3))
+ */
+template<int64_t tile_>
+constexpr auto
+WinogradFracBits() noexcept -> int64_t {
+    return (tile_ == 4) ? 10 : 0;
+}
+
+/*!
+ * @brief number of bits the products of the transform domain are shifted right, so the sum over all src chnls and the output transform
+ * can not overflow int64 (0 for floating-point)
+ */
+template<typename param_>
+constexpr auto
+WinogradShiftBits() noexcept -> int64_t {
+    using src_data  = typename param_::src_type::data_type;
+    using wgts_data = typename param_::wgts_type::data_type;
+    constexpr int64_t bits =
+        8 * static_cast<int64_t>(sizeof(src_data) + sizeof(wgts_data)) + WinogradGrowthBits<param_::tile, param_::chnls>();
+    return std::is_integral<src_data>::value ? hvx::util::Max(static_cast<int64_t>(0), bits - 63) : 0;
+}
+
+/*!
+ * @brief shifts a product of the transform domain right (fixed-point)
+ */
+template<int64_t shift_>
+HVX_FORCE_INLINE constexpr auto
+WinogradShiftRight(int64_t value) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    return value >> shift_;
+}
+
+/*!
+ * @brief nothing to shift (floating-point)
+ */
+template<int64_t shift_>
+HVX_FORCE_INLINE constexpr auto
+WinogradShiftRight(float value) noexcept -> float {
+    HVX_INLINE_TOP();
+    return value;
+}
+
+/*!
+ * @brief shifts the result of the output transform back to the fraction size of the product of src and wgts (fixed-point)
+ */
+template<int64_t shift_>
+HVX_FORCE_INLINE constexpr auto
+WinogradShiftLeft(int64_t value) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    return value * (static_cast<int64_t>(1) << shift_);
+}
+
+/*!
+ * @brief nothing to shift (floating-point)
+ */
+template<int64_t shift_>
+HVX_FORCE_INLINE constexpr auto
+WinogradShiftLeft(float value) noexcept -> float {
+    HVX_INLINE_TOP();
+    return value;
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief verifies the parameters of the Winograd mode (nothing to verify for the direct conv)
+ */
+template<typename param_, std::enable_if_t<(param_::tile == 1), bool> = true>
+HVX_FORCE_INLINE constexpr auto
+ConvWinogradVerify() noexcept -> void {
+    HVX_INLINE_TOP();
+}
+
+/*!
+ * @brief verifies the parameters of the Winograd mode
+ */
+template<typename param_, std::enable_if_t<(param_::tile > 1), bool> = true>
+HVX_FORCE_INLINE constexpr auto
+ConvWinogradVerify() noexcept -> void {
+    HVX_INLINE_TOP();
+    using data_type = typename param_::src_type::data_type;
+    static_assert(hvx::util::is_dfixed_v<typename param_::src_type>, "Winograd is only supported for dfixed!");
+    static_assert(hvx::util::is_dfixed_v<typename param_::bias_type>, "Winograd is not supported for a per-channel quantized layer!");
+    static_assert((param_::knl_rows == 3) && (param_::knl_cols == 3), "Winograd is only supported for 3x3 kernels!");
+    static_assert(param_::knl_parts == 1, "Winograd needs a fully vectorized kernel!");
+    static_assert((param_::str_rows == 1) && (param_::str_cols == 1), "Winograd is only supported for stride 1!");
+    static_assert((param_::dil_rows == 0) && (param_::dil_cols == 0), "Winograd is not supported for dilation!");
+    static_assert((param_::src_row_vec_size == 1) && (param_::src_col_vec_size == 1), "Winograd needs a row/col vector size of 1!");
+    static_assert(((param_::dst_rows % param_::tile) == 0) && ((param_::dst_cols % param_::tile) == 0),
+                  "Winograd needs dst rows/cols that are a multiple of the tile size!");
+    static_assert(param_::wgts_type::is_signed, "Winograd needs signed weights (the transformed weights are signed)!");
+    static_assert(!std::is_integral<data_type>::value ||
+                      (param_::wgts_type::frac_bits >= (param_::dst_type::frac_bits + WinogradFracBits<param_::tile>())),
+                  "Winograd F(4x4,3x3) needs wgts with at least 10 more fraction bits than the dst (e.g. int32 wgts for int16 dst)!");
+    static_assert(!std::is_integral<data_type>::value ||
+                      ((8 * sizeof(data_type) + 8 * sizeof(typename param_::wgts_type::data_type) + 4 +
+                        hvx::util::Log2Ceil(param_::chnls)) < 64),
+                  "Possible number overflow! To many src chnls!");
+    static_assert(!std::is_integral<data_type>::value ||
+                      ((param_::src_type::frac_bits + param_::wgts_type::frac_bits - WinogradShiftBits<param_>()) >=
+                       param_::dst_type::frac_bits),
+                  "The Winograd transform domain has less fraction bits than the dst! To many src chnls!");
+}
+
+/*!
+ * @brief input transform V = B^T d B of one src chnl (the window stores the newest element first)
+ */
+template<typename param_, typename comp_type_>
+HVX_FORCE_INLINE constexpr auto
+ConvWinogradInput(int64_t chnl_p,
+                  hvx::util::array1d<typename param_::chnl_vec, param_::win_param::win_elms>& win,
+                  comp_type_ (&dst)[param_::tile_knl][param_::tile_knl]) noexcept -> void { // NOLINT
+    HVX_INLINE_TOP();
+    constexpr int64_t knl    = param_::tile_knl;
+    comp_type_ tmp[knl][knl] = {}; // NOLINT
+    for (int64_t row = 0; row < knl; ++row) {
+        HVX_UNROLL();
+        for (int64_t col = 0; col < knl; ++col) {
+            HVX_UNROLL();
+            comp_type_ sum{};
+            for (int64_t k = 0; k < knl; ++k) {
+                const auto src = static_cast<comp_type_>(win.Get((knl - 1 - k) * knl + (knl - 1 - col)).Get(chnl_p).data);
+                sum += static_cast<comp_type_>(WinogradBt<param_::tile>(row, k)) * src;
+            }
+            tmp[row][col] = sum; // NOLINT
+        }
+    }
+    for (int64_t row = 0; row < knl; ++row) {
+        HVX_UNROLL();
+        for (int64_t col = 0; col < knl; ++col) {
+            HVX_UNROLL();
+            comp_type_ sum{};
+            for (int64_t k = 0; k < knl; ++k)
+                sum += tmp[row][k] * static_cast<comp_type_>(WinogradBt<param_::tile>(col, k)); // NOLINT
+            dst[row][col] = sum;                                                              // NOLINT
+        }
+    }
+}
+
+/*!
+ * @brief output transform Y = A^T M A of one dst chnl
+ */
+template<typename param_, typename comp_type_>
+HVX_FORCE_INLINE constexpr auto
+ConvWinogradOutput(comp_type_ (&src)[param_::tile_knl][param_::tile_knl], comp_type_ (&dst)[param_::tile][param_::tile]) noexcept // NOLINT
+    -> void {
+    HVX_INLINE_TOP();
+    constexpr int64_t knl  = param_::tile_knl;
+    constexpr int64_t tile = param_::tile;
+    comp_type_ tmp[tile][knl] = {}; // NOLINT
+    for (int64_t row = 0; row < tile; ++row) {
+        HVX_UNROLL();
+        for (int64_t col = 0; col < knl; ++col) {
+            HVX_UNROLL();
+            comp_type_ sum{};
+            for (int64_t k = 0; k < knl; ++k)
+                sum += static_cast<comp_type_>(WinogradAt<tile>(row, k)) * src[k][col]; // NOLINT
+            tmp[row][col] = sum;                                                      // NOLINT
+        }
+    }
+    for (int64_t row = 0; row < tile; ++row) {
+        HVX_UNROLL();
+        for (int64_t col = 0; col < tile; ++col) {
+            HVX_UNROLL();
+            comp_type_ sum{};
+            for (int64_t k = 0; k < knl; ++k)
+                sum += tmp[row][k] * static_cast<comp_type_>(WinogradAt<tile>(col, k)); // NOLINT
+            dst[row][col] = sum;                                                      // NOLINT
+        }
+    }
+}
+
+/*!
+ * @brief accumulates U * V of one src chnl vector for a complete tile and, after the last src chnl vector, applies the output transform,
+ * adds the bias and stores the "tile x tile" dst elements of all dst chnls of the vector into the tile buffer
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+ConvWinogradComp(int64_t chnl_v,
+                 int64_t fm_v,
+                 int64_t tile_col,
+                 hvx::util::array1d<typename param_::chnl_vec, param_::win_param::win_elms>& win,
+                 typename param_::wgts_vec& wgts_data,
+                 typename param_::bias_vec& bias_data,
+                 hvx::util::array2d<typename param_::wino_type, param_::wino_elms, param_::fm_vec_size>& wino_sum,
+                 hvx::util::array2d<typename param_::dst_vec, param_::fm_vec_elms, param_::wino_buf_num>& wino_buf) noexcept -> void {
+    HVX_INLINE_TOP();
+    using comp_type         = typename param_::wino_type;
+    constexpr int64_t knl   = param_::tile_knl;
+    constexpr int64_t tile  = param_::tile;
+    constexpr int64_t elms  = param_::wino_elms;
+    constexpr int64_t chnls = param_::chnl_vec_size;
+    constexpr int64_t shift = hvx::nn::impl::WinogradShiftBits<param_>();
+
+    // input transform (shared by all dst chnls)
+    comp_type src_tf[chnls][knl][knl] = {}; // NOLINT
+    for (int64_t chnl_p = 0; chnl_p < chnls; ++chnl_p) {
+        HVX_UNROLL();
+        hvx::nn::impl::ConvWinogradInput<param_, comp_type>(chnl_p, win, src_tf[chnl_p]); // NOLINT
+    }
+
+    for (int64_t fm_p = 0; fm_p < param_::fm_vec_size; ++fm_p) {
+        HVX_UNROLL();
+
+        // element wise product in the transform domain, summed over all src chnls
+        comp_type sum[knl][knl] = {}; // NOLINT
+        for (int64_t row = 0; row < knl; ++row) {
+            for (int64_t col = 0; col < knl; ++col) {
+                const int64_t pix = row * knl + col;
+                comp_type acc     = (chnl_v == 0) ? static_cast<comp_type>(0) : wino_sum.Get(pix, fm_p);
+                for (int64_t chnl_p = 0; chnl_p < chnls; ++chnl_p) {
+                    const auto wgt = static_cast<comp_type>(wgts_data.Get(fm_p * chnls * elms + chnl_p * elms + pix).data);
+                    acc += hvx::nn::impl::WinogradShiftRight<shift>(wgt * src_tf[chnl_p][row][col]); // NOLINT
+                }
+                wino_sum.Set(acc, pix, fm_p);
+                sum[row][col] = acc; // NOLINT
+            }
+        }
+
+        // output transform, bias and overflow/underflow policies after the last src chnl vector
+        if (chnl_v == (param_::chnl_vec_elms - 1)) {
+            comp_type dst_tf[tile][tile] = {}; // NOLINT
+            hvx::nn::impl::ConvWinogradOutput<param_, comp_type>(sum, dst_tf);
+            for (int64_t row = 0; row < tile; ++row) {
+                for (int64_t col = 0; col < tile; ++col) {
+                    typename param_::comp_type sum_global{};
+                    const auto dst_sum = hvx::nn::impl::WinogradShiftLeft<shift>(dst_tf[row][col]); // NOLINT
+                    const auto res     = hvx::nn::impl::ConvAddBias<param_>(0, dst_sum, sum_global, bias_data.Get(fm_p).data);
+                    wino_buf.Get(fm_v, row * param_::dst_cols + tile_col + col).Get(fm_p).data =
+                        static_cast<typename param_::dst_type::data_type>(res);
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * @brief rounds a transformed weight to the wgts type (saturates for fixed-point)
+ */
+template<typename type_>
+auto
+ConvWinogradRound(double value) noexcept -> type_ {
+    using data_type = typename type_::data_type;
+    type_ dst{};
+    if (std::is_integral<data_type>::value) {
+        const double scaled = std::round(std::ldexp(value, type_::frac_bits));
+        const double lowest = static_cast<double>(std::numeric_limits<data_type>::lowest());
+        const double max    = static_cast<double>(std::numeric_limits<data_type>::max());
+        dst.data            = static_cast<data_type>(hvx::util::Clamp(scaled, lowest, max));
+    } else {
+        dst.data = static_cast<data_type>(value);
+    }
+    return dst;
+}
+
+/******************************************************************************************************************************************/
+} // namespace impl
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_CONV_WINOGRAD_H_
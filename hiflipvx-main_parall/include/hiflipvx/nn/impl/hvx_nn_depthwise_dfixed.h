@@ -25,7 +25,7 @@
 #ifndef HVX_NN_DEPTHWISE_DFIXED_H_
 #define HVX_NN_DEPTHWISE_DFIXED_H_
 
-#include "../../util/hvx_util_helper.h"
+#include "hvx_nn_conv_dfixed.h"
 
 namespace hvx {
 namespace nn {
@@ -78,11 +78,27 @@ template<typename param_,
 HVX_FORCE_INLINE constexpr auto
 DepthwiseAddBias(float sum, typename bias_type_::data_type bias) noexcept -> float {
     HVX_INLINE_TOP();
-    return sum + bias;
+
+    // add bias
+    float res = sum + bias;
+
+    // epilogue: requantization scale, shift and activation
+    using epilogue = typename param_::epilogue;
+    if (epilogue::is_scaled == true)
+        res *= static_cast<float>(epilogue::scale::num) / static_cast<float>(epilogue::scale::den);
+    if (epilogue::is_shifted == true)
+        res += static_cast<float>(epilogue::shift::num) / static_cast<float>(epilogue::shift::den);
+    if (epilogue::is_active == true) {
+        const auto arg1 = static_cast<float>(epilogue::arg1::num) / static_cast<float>(epilogue::arg1::den);
+        const auto arg2 = static_cast<float>(epilogue::arg2::num) / static_cast<float>(epilogue::arg2::den);
+        res             = hvx::util::FltOp<epilogue::act>(res, arg1, arg2);
+    }
+    return res;
 }
 
 /*!
- * @brief comp a single channel (using fixed-point numbers)
+ * @brief comp a single channel (using fixed-point numbers). The scale of the epilogue is applied before the result is rounded to the dst
+ * fraction size, the shift and the activation afterwards (like for the conv layer).
  */
 template<typename param_,
          typename src_type_,
@@ -97,11 +113,13 @@ HVX_FORCE_INLINE constexpr auto
 DepthwiseAddBias(int64_t sum, typename bias_type_::data_type bias) noexcept -> int64_t {
     HVX_INLINE_TOP();
 
-    // fraction sizes
+    // fraction sizes (the scale of the epilogue is a fixed-point number with "scl_frac_bits" fraction bits)
+    using epilogue                   = typename param_::epilogue;
+    constexpr int32_t scl_frac_bits  = (epilogue::is_scaled == true) ? 16 : 0;
     constexpr int32_t bias_frac_bits = bias_type_::frac_bits;
     constexpr int32_t dst_frac_bits  = dst_type_::frac_bits;
     constexpr int32_t sum_frac_bits  = src_type_::frac_bits + wgts_type_::frac_bits;
-    constexpr int32_t res_frac_bits  = hvx::util::Max(sum_frac_bits, bias_frac_bits);
+    constexpr int32_t res_frac_bits  = hvx::util::Max(sum_frac_bits, bias_frac_bits) + scl_frac_bits;
     constexpr int32_t dst_shift      = hvx::util::Abs(res_frac_bits - dst_frac_bits);
     constexpr int32_t res_shift      = hvx::util::Abs(sum_frac_bits - bias_frac_bits);
 
@@ -111,11 +129,23 @@ DepthwiseAddBias(int64_t sum, typename bias_type_::data_type bias) noexcept -> i
     // sum conv_t and bias_t (shift to value with bigger fraction size)
     auto res = (sum_frac_bits > bias_frac_bits) ? (sum + (bias_t << res_shift)) : (bias_t + (sum << res_shift));
 
-    // Rounding (shift to dst fraction size)
-    if (param_::underflow_type == hvx::util::underflow_e::kRound)
+    // epilogue: requantization scale
+    if (epilogue::is_scaled == true)
+        res *= hvx::nn::impl::ConvRatioToFixed<typename epilogue::scale, scl_frac_bits>();
+
+    // Rounding (shift to dst fraction size). A fused epilogue requantizes the result and rounds at half of the dst lsb.
+    if ((param_::underflow_type == hvx::util::underflow_e::kRound) && (epilogue::is_fused == false))
         res += static_cast<int64_t>(1) << hvx::util::Max(res_frac_bits - 1, 0);
+    if ((param_::underflow_type == hvx::util::underflow_e::kRound) && (epilogue::is_fused == true) && (res_frac_bits > dst_frac_bits))
+        res += static_cast<int64_t>(1) << hvx::util::Max(dst_shift - 1, 0);
     res = (res_frac_bits > dst_frac_bits) ? (res >> dst_shift) : (res << dst_shift);
 
+    // epilogue: shift and activation (in the dst fraction size)
+    if (epilogue::is_shifted == true)
+        res += hvx::nn::impl::ConvRatioToFixed<typename epilogue::shift, dst_frac_bits>();
+    if (epilogue::is_active == true)
+        res = hvx::nn::impl::ConvEpilogueAct<param_, dst_frac_bits>(res);
+
     // Check for overflow
     if (param_::overflow_type == hvx::util::overflow_e::kSaturate) {
         res = hvx::util::Max(res, static_cast<int64_t>(std::numeric_limits<typename dst_type_::data_type>::lowest()));
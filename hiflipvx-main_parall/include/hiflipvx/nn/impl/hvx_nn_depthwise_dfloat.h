@@ -69,6 +69,8 @@ DepthwiseComp(hvx::util::vector<src_type_, knl_cols_ * knl_rows_>& win_vec,
               bias_type_& bias,
               dst_type_& dst) noexcept -> void {
     HVX_INLINE_TOP();
+    static_assert(!param_::epilogue::is_scaled && !param_::epilogue::is_shifted && !param_::epilogue::is_active,
+                  "The epilogue is not supported for dfloat!");
 
     //
     constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
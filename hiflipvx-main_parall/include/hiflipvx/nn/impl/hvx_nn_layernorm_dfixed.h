@@ -26,6 +26,7 @@
 #define HVX_NN_LAYERNORM_DFIXED_H
 
 #include "../../util/hvx_util_helper.h"
+#include <cmath>
 
 namespace hvx {
 namespace nn {
@@ -118,6 +119,165 @@ LayernormComp(typename param_::src_type src,
     dst.data = static_cast<typename param_::dst_type::data_type>(res);
 }
 
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief statistics of one normalization group. Fixed-point sums src and src^2 exactly in int64, floating-point uses Welford's running
+ * mean and sum of squared deviations (merged vector by vector as proposed by Chan et al.) to avoid cancellation.
+ */
+template<typename type_>
+struct LayernormStatDfixed {
+    using acc_type = std::conditional_t<std::is_integral<typename type_::data_type>::value, int64_t, float>;
+    acc_type sum;  // fixed-point: sum of src, floating-point: running mean
+    acc_type sqr;  // fixed-point: sum of src^2, floating-point: sum of squared deviations from the running mean
+    float shift;   // subtracted from src before scaling (mean, 0 for RMSNorm)
+    float scale;   // 1 / sqrt(var + eps)
+};
+
+/*!
+ * @brief verifies that the exact sums of a normalization group cannot overflow
+ */
+template<typename param_, std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormVerifyStat() noexcept -> void {
+    HVX_INLINE_TOP();
+    constexpr int64_t src_bits = 8 * sizeof(typename param_::src_type::data_type);
+    static_assert(!param_::src_type::is_int || ((2 * src_bits + 2 * hvx::util::Log2Ceil(param_::norm_elms)) < 64),
+                  "Possible number overflow! To many elements in the normalization group!");
+}
+
+/*!
+ * @brief converts a floating-point result to the dst type (applies the overflow/underflow policies for fixed-point)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+LayernormToDst(float value, typename param_::dst_type& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    using data_type = typename param_::dst_type::data_type;
+    if (std::is_integral<data_type>::value) {
+        constexpr auto shift = static_cast<float>(static_cast<int64_t>(1) << param_::dst_type::frac_bits);
+        float scaled         = value * shift;
+        if (param_::underflow_type == hvx::util::underflow_e::kRound)
+            scaled += 0.5f;
+        if ((param_::underflow_type == hvx::util::underflow_e::kRound) || (param_::underflow_type == hvx::util::underflow_e::kFloor))
+            scaled = std::floor(scaled);
+        else if (param_::underflow_type == hvx::util::underflow_e::kCeil)
+            scaled = std::ceil(scaled);
+        auto res = static_cast<float>(hvx::util::Clamp(scaled, -9.0e18f, 9.0e18f));
+        if (param_::overflow_type == hvx::util::overflow_e::kSaturate) {
+            res = hvx::util::Max(res, static_cast<float>(std::numeric_limits<data_type>::lowest()));
+            res = hvx::util::Min(res, static_cast<float>(std::numeric_limits<data_type>::max()));
+        } else if (param_::overflow_type == hvx::util::overflow_e::kClip) {
+            res = hvx::util::Max(res, static_cast<float>(param_::clip_min));
+            res = hvx::util::Min(res, static_cast<float>(param_::clip_max));
+        }
+        dst.data = static_cast<data_type>(static_cast<int64_t>(res));
+    } else {
+        dst.data = static_cast<data_type>(value);
+    }
+}
+
+/*!
+ * @brief adds one src vector of a normalization group to its statistics (fixed-point)
+ */
+template<typename param_,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type> && param_::src_type::is_int, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormStatUpdate(int64_t elm_v, typename param_::src_vec& src, typename param_::stat_type& stat) noexcept -> void {
+    HVX_INLINE_TOP();
+    int64_t sum = 0, sqr = 0;
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        const auto val = static_cast<int64_t>(src.Get(chnl_p).data);
+        sum += val;
+        sqr += val * val;
+    }
+    stat.sum = (elm_v == 0) ? sum : (stat.sum + sum);
+    stat.sqr = (elm_v == 0) ? sqr : (stat.sqr + sqr);
+}
+
+/*!
+ * @brief adds one src vector of a normalization group to its statistics (floating-point)
+ */
+template<typename param_,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type> && param_::src_type::is_flt, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormStatUpdate(int64_t elm_v, typename param_::src_vec& src, typename param_::stat_type& stat) noexcept -> void {
+    HVX_INLINE_TOP();
+    constexpr auto vec_size = static_cast<float>(param_::chnl_vec_size);
+
+    // mean and squared deviations of the vector
+    float sum = 0.0f, sqr = 0.0f;
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        sum += static_cast<float>(src.Get(chnl_p).data);
+    }
+    const float mean = sum / vec_size;
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        const float diff = static_cast<float>(src.Get(chnl_p).data) - mean;
+        sqr += diff * diff;
+    }
+
+    // merge with the statistics of the previous vectors
+    const auto elms_old = static_cast<float>(elm_v) * vec_size;
+    const auto elms_new = elms_old + vec_size;
+    const float delta   = mean - stat.sum;
+    stat.sum            = (elm_v == 0) ? mean : (stat.sum + delta * (vec_size / elms_new));
+    stat.sqr            = (elm_v == 0) ? sqr : (stat.sqr + sqr + delta * delta * (elms_old * vec_size / elms_new));
+}
+
+/*!
+ * @brief computes shift and scale from the statistics of a complete normalization group
+ */
+template<typename param_, std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormStatFinal(typename param_::stat_type& stat) noexcept -> void {
+    HVX_INLINE_TOP();
+    constexpr auto elms = static_cast<float>(param_::norm_elms);
+    const float eps     = param_::eps;
+
+    // mean and variance (or mean of squares)
+    float mean = 0.0f, var = 0.0f;
+    if (param_::src_type::is_int) {
+        constexpr auto frac  = static_cast<float>(static_cast<int64_t>(1) << param_::src_type::frac_bits);
+        const auto sum       = static_cast<int64_t>(stat.sum);
+        const auto sqr       = static_cast<int64_t>(stat.sqr);
+        const auto var_numer = param_::norm_elms * sqr - sum * sum; // exact
+        mean                 = static_cast<float>(sum) / (elms * frac);
+        var                  = (param_::norm_type == hvx::util::norm_e::kRms) ? (static_cast<float>(sqr) / (elms * frac * frac))
+                                                                              : (static_cast<float>(var_numer) / (elms * elms * frac * frac));
+    } else {
+        mean = static_cast<float>(stat.sum);
+        var  = static_cast<float>(stat.sqr) / elms;
+        if (param_::norm_type == hvx::util::norm_e::kRms)
+            var += mean * mean;
+    }
+
+    // normalization
+    stat.shift = (param_::norm_type == hvx::util::norm_e::kRms) ? 0.0f : mean;
+    stat.scale = 1.0f / std::sqrt(hvx::util::Max(var, 0.0f) + eps);
+}
+
+/*!
+ * @brief Computes the layer normalization or RMSNorm of an element: (src - shift) * scale * wgts + bias
+ */
+template<typename param_,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool>  = true,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::dst_type>, bool>  = true,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::wgts_type>, bool> = true,
+         std::enable_if_t<hvx::util::is_dfixed_v<typename param_::bias_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormNormComp(typename param_::src_type src,
+                  typename param_::wgts_type wgt,
+                  typename param_::bias_type bias,
+                  typename param_::stat_type& stat,
+                  typename param_::dst_type& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    const float res = (static_cast<float>(src) - stat.shift) * stat.scale * static_cast<float>(wgt) + static_cast<float>(bias);
+    hvx::nn::impl::LayernormToDst<param_>(res, dst);
+}
+
 /******************************************************************************************************************************************/
 } // namespace impl
 } // namespace nn
@@ -80,6 +80,120 @@ LayernormComp(typename param_::src_type src,
     dst               = static_cast<typename param_::dst_type>(result);
 }
 
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief statistics of one normalization group, Welford's running mean and sum of squared deviations (merged vector by vector)
+ */
+template<typename type_>
+struct LayernormStatDfloat {
+    type_ sum;   // running mean
+    type_ sqr;   // sum of squared deviations from the running mean
+    type_ shift; // subtracted from src before scaling (mean, 0 for RMSNorm)
+    type_ scale; // 1 / sqrt(var + eps)
+};
+
+/*!
+ * @brief verifies that the exact sums of a normalization group cannot overflow
+ */
+template<typename param_, std::enable_if_t<dynfloat::is_dfloat_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormVerifyStat() noexcept -> void {
+    HVX_INLINE_TOP();
+}
+
+/*!
+ * @brief adds one src vector of a normalization group to its statistics
+ */
+template<typename param_, std::enable_if_t<dynfloat::is_dfloat_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormStatUpdate(int64_t elm_v, typename param_::src_vec& src, typename param_::stat_type& stat) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type);
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+    using src_type                = typename param_::src_type;
+
+    // mean and squared deviations of the vector
+    constexpr auto vec_size = static_cast<float>(param_::chnl_vec_size);
+    src_type sum{0.0f}, sqr{0.0f};
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        sum = dynfloat::add<df_execution>(sum, src.Get(chnl_p));
+    }
+    const auto mean = dynfloat::mul<df_execution>(sum, src_type{1.0f / vec_size});
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        const auto diff = dynfloat::sub<df_execution>(src.Get(chnl_p), mean);
+        sqr             = dynfloat::add<df_execution>(sqr, dynfloat::mul<df_execution>(diff, diff));
+    }
+
+    // merge with the statistics of the previous vectors
+    const auto elms_old = static_cast<float>(elm_v) * vec_size;
+    const auto elms_new = elms_old + vec_size;
+    const auto delta    = dynfloat::sub<df_execution>(mean, stat.sum);
+    const auto sum_new  = dynfloat::add<df_execution>(stat.sum, dynfloat::mul<df_execution>(delta, src_type{vec_size / elms_new}));
+    const auto sqr_cor  = dynfloat::mul<df_execution>(dynfloat::mul<df_execution>(delta, delta), src_type{elms_old * vec_size / elms_new});
+    const auto sqr_new  = dynfloat::add<df_execution>(dynfloat::add<df_execution>(stat.sqr, sqr), sqr_cor);
+    stat.sum            = (elm_v == 0) ? mean : sum_new;
+    stat.sqr            = (elm_v == 0) ? sqr : sqr_new;
+}
+
+/*!
+ * @brief computes shift and scale from the statistics of a complete normalization group
+ */
+template<typename param_, std::enable_if_t<dynfloat::is_dfloat_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormStatFinal(typename param_::stat_type& stat) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type);
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+    using src_type                = typename param_::src_type;
+
+    // variance (or mean of squares)
+    auto var = dynfloat::mul<df_execution>(stat.sqr, src_type{1.0f / static_cast<float>(param_::norm_elms)});
+    if (param_::norm_type == hvx::util::norm_e::kRms)
+        var = dynfloat::add<df_execution>(var, dynfloat::mul<df_execution>(stat.sum, stat.sum));
+
+    // normalization
+    stat.shift = (param_::norm_type == hvx::util::norm_e::kRms) ? src_type{0.0f} : stat.sum;
+    stat.scale = dynfloat::inv_sqrt<df_execution>(dynfloat::add<df_execution>(var, src_type{param_::eps}));
+}
+
+/*!
+ * @brief Computes the layer normalization or RMSNorm of an element: (src - shift) * scale * wgts + bias
+ */
+template<typename param_,
+         std::enable_if_t<dynfloat::is_dfloat_v<typename param_::src_type>, bool>  = true,
+         std::enable_if_t<dynfloat::is_dfloat_v<typename param_::dst_type>, bool>  = true,
+         std::enable_if_t<dynfloat::is_dfloat_v<typename param_::wgts_type>, bool> = true,
+         std::enable_if_t<dynfloat::is_dfloat_v<typename param_::bias_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+LayernormNormComp(typename param_::src_type src,
+                  typename param_::wgts_type wgt,
+                  typename param_::bias_type bias,
+                  typename param_::stat_type& stat,
+                  typename param_::dst_type& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type);
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+
+    // normalizes src and applies the affine transformation
+    const auto norm = dynfloat::mul<df_execution>(dynfloat::sub<df_execution>(src, stat.shift), stat.scale);
+    hvx::nn::impl::LayernormComp<param_>(norm, wgt, bias, dst);
+}
+
 /******************************************************************************************************************************************/
 } // namespace impl
 } // namespace nn
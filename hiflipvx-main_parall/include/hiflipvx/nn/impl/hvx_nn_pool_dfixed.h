@@ -190,6 +190,98 @@ PoolAvg(hvx::util::vector<src_type_, param_::knl_elms>& win_vec, dst_type_& dst)
     dst.data = static_cast<typename dst_type_::data_type>(res);
 }
 
+/*!
+ * @brief data type of the accumulator of the global pooling (int64 for fixed-point, float32 for floating-point, the dfloat type itself)
+ */
+template<typename type_, typename = void>
+struct pool_acc_type {
+    using type = type_;
+};
+template<typename type_>
+struct pool_acc_type<type_, std::enable_if_t<hvx::util::is_dfixed_v<type_>>> {
+    using type = std::conditional_t<std::is_integral<typename type_::data_type>::value, int64_t, float>;
+};
+template<typename type_>
+using pool_acc_type_t = typename pool_acc_type<type_>::type;
+
+/*!
+ * @brief Global pool: updates the accumulator of a chnl with the next src pixel (restarts on the first pixel)
+ */
+template<typename param_,
+         hvx::util::pooling_e pool_type_,
+         typename src_type_,
+         std::enable_if_t<hvx::util::is_dfixed_v<src_type_>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+GlobalPoolUpdate(bool first, src_type_& src, hvx::nn::impl::pool_acc_type_t<src_type_>& acc) noexcept -> void {
+    HVX_INLINE_TOP();
+    const auto val = static_cast<hvx::nn::impl::pool_acc_type_t<src_type_>>(src.data);
+    const auto upd = (pool_type_ == hvx::util::pooling_e::kMax) ? (hvx::util::Max(acc, val)) : (acc + val);
+    acc            = (first == true) ? (val) : (upd);
+}
+
+/*!
+ * @brief Global pool: converts the accumulator of a chnl to the dst (floating point values)
+ */
+template<typename param_,
+         hvx::util::pooling_e pool_type_,
+         typename dst_type_,
+         std::enable_if_t<hvx::util::is_dfixed_v<dst_type_> && dst_type_::is_flt, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+GlobalPoolResult(float acc, dst_type_& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // normalization
+    constexpr auto norm_flt = 1.0f / static_cast<float>(param_::pixels);
+    const float res         = (pool_type_ == hvx::util::pooling_e::kAvg) ? (acc * norm_flt) : (acc);
+
+    // convert to destination type and store result
+    dst.data = static_cast<typename dst_type_::data_type>(res);
+}
+
+/*!
+ * @brief Global pool: converts the accumulator of a chnl to the dst (integer values, the average is normalized with 24 additional
+ * fraction bits, since the number of pixels can be large)
+ */
+template<typename param_,
+         hvx::util::pooling_e pool_type_,
+         typename dst_type_,
+         std::enable_if_t<hvx::util::is_dfixed_v<dst_type_> && dst_type_::is_int, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+GlobalPoolResult(int64_t acc, dst_type_& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // constants
+    constexpr int32_t norm_bits = (pool_type_ == hvx::util::pooling_e::kAvg) ? 24 : 0;
+    constexpr int32_t src_bits  = static_cast<int32_t>(param_::src_type::frac_bits) + norm_bits;
+    constexpr int32_t dst_bits  = static_cast<int32_t>(dst_type_::frac_bits);
+    constexpr auto one          = static_cast<int64_t>(1);
+    constexpr auto norm_dbl     = static_cast<double>(one << norm_bits) / static_cast<double>(param_::pixels);
+    constexpr auto norm_int     = (pool_type_ == hvx::util::pooling_e::kAvg) ? (static_cast<int64_t>(norm_dbl + 0.5)) : (one);
+    constexpr auto shift_val    = static_cast<uint32_t>(hvx::util::Abs(src_bits - dst_bits));
+    constexpr auto half         = one << hvx::util::Max(0, static_cast<int32_t>(shift_val) - 1);
+    constexpr auto dst_max      = static_cast<int64_t>(std::numeric_limits<typename dst_type_::data_type>::max());
+    constexpr auto dst_min      = static_cast<int64_t>(std::numeric_limits<typename dst_type_::data_type>::lowest());
+
+    // normalization
+    int64_t res = acc * norm_int;
+
+    // shift to destination fraction size (check underflow policy)
+    if (src_bits < dst_bits) {
+        res = res << shift_val;
+    } else if (src_bits > dst_bits) {
+        if (param_::underflow_type == hvx::util::underflow_e::kRound)
+            res = res + half;
+        res = res >> shift_val;
+    }
+
+    // check overflow policy (the sum of all pixels exceeds the src range)
+    if (param_::overflow_type == hvx::util::overflow_e::kSaturate)
+        res = hvx::util::Clamp(res, dst_min, dst_max);
+
+    // convert to destination type and store result
+    dst.data = static_cast<typename dst_type_::data_type>(res);
+}
+
 /******************************************************************************************************************************************/
 } // namespace impl
 } // namespace nn
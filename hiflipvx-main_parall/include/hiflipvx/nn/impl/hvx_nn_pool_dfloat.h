@@ -102,6 +102,62 @@ PoolAvg(hvx::util::vector<src_type_, param_::knl_elms>& win_vec, dst_type_& dst)
     }
 }
 
+/*!
+ * @brief Global pool: updates the accumulator of a chnl with the next src pixel (restarts on the first pixel)
+ */
+template<typename param_,
+         hvx::util::pooling_e pool_type_,
+         typename src_type_,
+         std::enable_if_t<dynfloat::is_dfloat_v<src_type_>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+GlobalPoolUpdate(bool first, src_type_& src, src_type_& acc) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type);
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+
+    //
+    const auto upd = (pool_type_ == hvx::util::pooling_e::kMax) ? (hvx::util::Max(acc, src)) : (dynfloat::add<df_execution>(acc, src));
+    acc            = (first == true) ? (src) : (upd);
+}
+
+/*!
+ * @brief Global pool: converts the accumulator of a chnl to the dst
+ */
+template<typename param_,
+         hvx::util::pooling_e pool_type_,
+         typename acc_type_,
+         typename dst_type_,
+         std::enable_if_t<dynfloat::is_dfloat_v<acc_type_>, bool> = true,
+         std::enable_if_t<dynfloat::is_dfloat_v<dst_type_>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+GlobalPoolResult(acc_type_& acc, dst_type_& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type);
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+
+    // normalization (only the average)
+    constexpr auto dnm      = param_::pixels;
+    constexpr auto pow2_dnm = ((dnm - 1) & dnm) == 0;
+    if (pool_type_ != hvx::util::pooling_e::kAvg) {
+        dst = static_cast<dst_type_>(acc);
+    } else if (pow2_dnm) {
+        constexpr auto lg2_dnm = dynfloat::utils::lg2(dnm);
+        dst                    = static_cast<dst_type_>(acc >> lg2_dnm);
+    } else {
+        constexpr auto norm_flt = static_cast<acc_type_>(1.0 / static_cast<double>(dnm));
+        const auto mul_res      = dynfloat::mul<df_execution>(acc, norm_flt);
+        dst                     = static_cast<dst_type_>(mul_res);
+    }
+}
+
 /******************************************************************************************************************************************/
 } // namespace impl
 } // namespace nn
@@ -0,0 +1,268 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_nn_rnn_dfixed.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Fused gate summation and the LSTM/GRU cell update of the recurrent layer (fixed-point gate activations, or floating-point for
+ *  dfixed<float>).
+ */
+
+#ifndef HVX_NN_RNN_DFIXED_H_
+#define HVX_NN_RNN_DFIXED_H_
+
+#include "hvx_nn_conv_dfixed.h"
+
+namespace hvx {
+namespace nn {
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief verifies the data types of the recurrent layer
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         typename state_type_,
+         std::enable_if_t<hvx::util::is_dfixed_v<src_type_>, bool> = true,
+         std::enable_if_t<hvx::util::is_dfixed_v<dst_type_>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+RnnVerifyType() noexcept -> void {
+    HVX_INLINE_TOP();
+    hvx::nn::impl::ConvVerifyType<src_type_, wgts_type_, bias_type_, dst_type_>();
+    static_assert((src_type_::is_flt == true) ||
+                      ((src_type_::frac_bits <= state_type_::frac_bits) && (dst_type_::frac_bits <= state_type_::frac_bits)),
+                  "The fraction size of the src and dst can not be bigger than the one of the hidden state!");
+}
+
+/*!
+ * @brief the weights column and if the product is added for a sum of a hidden unit (the GRU sums up the "new" gate separately for the
+ * src and the hidden state, both use the same weights column)
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+RnnSumGate(int64_t sum_gate) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    return (param_::cell_type == hvx::util::rnn_e::kGru) ? (hvx::util::Min(sum_gate, static_cast<int64_t>(2))) : (sum_gate);
+}
+
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+RnnSumActive(int64_t sum_gate, bool is_src) noexcept -> bool {
+    HVX_INLINE_TOP();
+    return (param_::cell_type == hvx::util::rnn_e::kLstm) || (sum_gate < 2) || ((sum_gate == 2) == is_src);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief converts a src value to the hidden state type
+ */
+template<typename param_, std::enable_if_t<param_::src_type::is_int, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+RnnCastSrc(typename param_::src_type src, typename param_::state_type& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    dst.data = static_cast<typename param_::state_type::data_type>(
+        hvx::util::CastFixedToFixed<param_::src_type::frac_bits, param_::state_type::frac_bits, param_::underflow_type>(src.data));
+}
+
+template<typename param_, std::enable_if_t<param_::src_type::is_flt, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+RnnCastSrc(typename param_::src_type src, typename param_::state_type& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    dst.data = static_cast<float>(src.data);
+}
+
+/*!
+ * @brief multiplies an element of the concatenated input [src, hidden state] with the weights of all gates of a hidden vector and adds
+ * the products to the sums (integer sum)
+ */
+template<typename param_, std::enable_if_t<param_::src_type::is_int, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+RnnMac(bool first,
+       bool is_src,
+       typename param_::state_type src,
+       typename param_::wgts_vec& wgts_vec,
+       hvx::util::array1d<typename param_::comp_type, param_::sum_elms>& sum) noexcept -> void {
+    HVX_INLINE_TOP();
+    for (int64_t gate = 0; gate < param_::sum_gates; ++gate) {
+        HVX_UNROLL();
+        for (int64_t hidden_p = 0; hidden_p < param_::hidden_vec_size; ++hidden_p) {
+            HVX_UNROLL();
+            const int64_t ptr_wgts = hvx::nn::impl::RnnSumGate<param_>(gate) * param_::hidden_vec_size + hidden_p;
+            const int64_t ptr_sum  = gate * param_::hidden_vec_size + hidden_p;
+            const int64_t prod     = (hvx::nn::impl::RnnSumActive<param_>(gate, is_src) == true)
+                                       ? (static_cast<int64_t>(wgts_vec.Get(ptr_wgts).data) * static_cast<int64_t>(src.data))
+                                       : (0);
+            sum.Get(ptr_sum).data  = (first == true) ? (prod) : (sum.Get(ptr_sum).data + prod);
+        }
+    }
+}
+
+/*!
+ * @brief multiplies an element of the concatenated input [src, hidden state] with the weights of all gates of a hidden vector and adds
+ * the products to the sums (floating-point sum)
+ */
+template<typename param_, std::enable_if_t<param_::src_type::is_flt, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+RnnMac(bool first,
+       bool is_src,
+       typename param_::state_type src,
+       typename param_::wgts_vec& wgts_vec,
+       hvx::util::array1d<typename param_::comp_type, param_::sum_elms>& sum) noexcept -> void {
+    HVX_INLINE_TOP();
+    for (int64_t gate = 0; gate < param_::sum_gates; ++gate) {
+        HVX_UNROLL();
+        for (int64_t hidden_p = 0; hidden_p < param_::hidden_vec_size; ++hidden_p) {
+            HVX_UNROLL();
+            const int64_t ptr_wgts = hvx::nn::impl::RnnSumGate<param_>(gate) * param_::hidden_vec_size + hidden_p;
+            const int64_t ptr_sum  = gate * param_::hidden_vec_size + hidden_p;
+            const float prod       = (hvx::nn::impl::RnnSumActive<param_>(gate, is_src) == true)
+                                       ? (static_cast<float>(wgts_vec.Get(ptr_wgts).data) * src.data)
+                                       : (0.0f);
+            sum.Get(ptr_sum).data  = (first == true) ? (prod) : (sum.Get(ptr_sum).data + prod);
+        }
+    }
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief updates the hidden (and cell) state of a hidden vector from the gate sums and writes the hidden state to the dst (fixed-point)
+ */
+template<typename param_, std::enable_if_t<param_::src_type::is_int, bool> = true>
+HVX_FORCE_INLINE auto
+RnnCell(hvx::util::array1d<typename param_::comp_type, param_::sum_elms>& sum,
+        typename param_::bias_vec& bias_vec,
+        typename param_::state_vec& hidden_prev,
+        typename param_::state_vec& cell_prev,
+        typename param_::state_vec& hidden_next,
+        typename param_::state_vec& cell_next,
+        typename param_::dst_vec& dst_vec) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // fraction sizes (the gates are computed with the fraction size of the hidden state)
+    using state_data                = typename param_::state_type::data_type;
+    constexpr auto underflow        = param_::underflow_type;
+    constexpr int64_t frac_bits     = param_::state_type::frac_bits;
+    constexpr int64_t sum_frac_bits = param_::wgts_type::frac_bits + frac_bits;
+    constexpr int64_t one           = static_cast<int64_t>(1) << frac_bits;
+    constexpr auto state_min        = static_cast<int64_t>(std::numeric_limits<state_data>::lowest());
+    constexpr auto state_max        = static_cast<int64_t>(std::numeric_limits<state_data>::max());
+    constexpr auto dst_min          = static_cast<int64_t>(std::numeric_limits<typename param_::dst_type::data_type>::lowest());
+    constexpr auto dst_max          = static_cast<int64_t>(std::numeric_limits<typename param_::dst_type::data_type>::max());
+
+    for (int64_t hidden_p = 0; hidden_p < param_::hidden_vec_size; ++hidden_p) {
+        HVX_UNROLL();
+
+        // add the bias to the sums of all gates
+        hvx::util::vector<int64_t, param_::sum_gates> act{};
+        for (int64_t gate = 0; gate < param_::sum_gates; ++gate) {
+            HVX_UNROLL();
+            const int64_t ptr  = gate * param_::hidden_vec_size + hidden_p;
+            const int64_t bias = hvx::util::CastFixedToFixed<param_::bias_type::frac_bits, sum_frac_bits, underflow>(
+                static_cast<int64_t>(bias_vec.Get(ptr).data));
+            act.Get(gate)      = hvx::util::CastFixedToFixed<sum_frac_bits, frac_bits, underflow>(sum.Get(ptr).data + bias);
+        }
+
+        // cell update
+        const auto h_prev = static_cast<int64_t>(hidden_prev.Get(hidden_p).data);
+        const auto c_prev = static_cast<int64_t>(cell_prev.Get(hidden_p).data);
+        int64_t h_next = 0, c_next = 0;
+        if (param_::cell_type == hvx::util::rnn_e::kLstm) {
+            const int64_t gate_i = hvx::util::DfixedSigmoid<frac_bits, underflow>(act.Get(0));
+            const int64_t gate_f = hvx::util::DfixedSigmoid<frac_bits, underflow>(act.Get(1));
+            const int64_t gate_g = hvx::util::DfixedTanh<frac_bits, underflow>(act.Get(2));
+            const int64_t gate_o = hvx::util::DfixedSigmoid<frac_bits, underflow>(act.Get(3));
+            c_next = hvx::util::CastFixedToFixed<2 * frac_bits, frac_bits, underflow>(gate_f * c_prev + gate_i * gate_g);
+            c_next = hvx::util::Clamp(c_next, state_min, state_max);
+            h_next = hvx::util::CastFixedToFixed<2 * frac_bits, frac_bits, underflow>(
+                gate_o * hvx::util::DfixedTanh<frac_bits, underflow>(c_next));
+        } else {
+            const int64_t gate_z = hvx::util::DfixedSigmoid<frac_bits, underflow>(act.Get(0));
+            const int64_t gate_r = hvx::util::DfixedSigmoid<frac_bits, underflow>(act.Get(1));
+            const int64_t gate_n = hvx::util::DfixedTanh<frac_bits, underflow>(
+                act.Get(2) + hvx::util::CastFixedToFixed<2 * frac_bits, frac_bits, underflow>(gate_r * act.Get(3)));
+            h_next = hvx::util::CastFixedToFixed<2 * frac_bits, frac_bits, underflow>((one - gate_z) * gate_n + gate_z * h_prev);
+        }
+        hidden_next.Get(hidden_p).data = static_cast<state_data>(h_next);
+        cell_next.Get(hidden_p).data   = static_cast<state_data>(c_next);
+
+        // convert the hidden state to the dst type
+        int64_t dst = hvx::util::CastFixedToFixed<frac_bits, param_::dst_type::frac_bits, underflow>(h_next);
+        if (param_::overflow_type == hvx::util::overflow_e::kSaturate)
+            dst = hvx::util::Clamp(dst, dst_min, dst_max);
+        dst_vec.Get(hidden_p).data = static_cast<typename param_::dst_type::data_type>(dst);
+    }
+}
+
+/*!
+ * @brief updates the hidden (and cell) state of a hidden vector from the gate sums and writes the hidden state to the dst (floating-point)
+ */
+template<typename param_, std::enable_if_t<param_::src_type::is_flt, bool> = true>
+HVX_FORCE_INLINE auto
+RnnCell(hvx::util::array1d<typename param_::comp_type, param_::sum_elms>& sum,
+        typename param_::bias_vec& bias_vec,
+        typename param_::state_vec& hidden_prev,
+        typename param_::state_vec& cell_prev,
+        typename param_::state_vec& hidden_next,
+        typename param_::state_vec& cell_next,
+        typename param_::dst_vec& dst_vec) noexcept -> void {
+    HVX_INLINE_TOP();
+    for (int64_t hidden_p = 0; hidden_p < param_::hidden_vec_size; ++hidden_p) {
+        HVX_UNROLL();
+
+        // add the bias to the sums of all gates
+        hvx::util::vector<float, param_::sum_gates> act{};
+        for (int64_t gate = 0; gate < param_::sum_gates; ++gate) {
+            HVX_UNROLL();
+            const int64_t ptr = gate * param_::hidden_vec_size + hidden_p;
+            act.Get(gate)     = sum.Get(ptr).data + static_cast<float>(bias_vec.Get(ptr).data);
+        }
+
+        // cell update
+        const float h_prev = hidden_prev.Get(hidden_p).data;
+        const float c_prev = cell_prev.Get(hidden_p).data;
+        float h_next = 0.0f, c_next = 0.0f;
+        if (param_::cell_type == hvx::util::rnn_e::kLstm) {
+            const float gate_i = hvx::util::FltSigmoid(act.Get(0));
+            const float gate_f = hvx::util::FltSigmoid(act.Get(1));
+            const float gate_g = hvx::util::FltTanh(act.Get(2));
+            const float gate_o = hvx::util::FltSigmoid(act.Get(3));
+            c_next             = gate_f * c_prev + gate_i * gate_g;
+            h_next             = gate_o * hvx::util::FltTanh(c_next);
+        } else {
+            const float gate_z = hvx::util::FltSigmoid(act.Get(0));
+            const float gate_r = hvx::util::FltSigmoid(act.Get(1));
+            const float gate_n = hvx::util::FltTanh(act.Get(2) + gate_r * act.Get(3));
+            h_next             = (1.0f - gate_z) * gate_n + gate_z * h_prev;
+        }
+        hidden_next.Get(hidden_p).data = h_next;
+        cell_next.Get(hidden_p).data   = c_next;
+        dst_vec.Get(hidden_p).data     = static_cast<typename param_::dst_type::data_type>(h_next);
+    }
+}
+
+/******************************************************************************************************************************************/
+} // namespace impl
+} // namespace nn
+} // namespace hvx
+
+#endif // HVX_NN_RNN_DFIXED_H_
@@ -144,6 +144,138 @@ SoftmaxStage2(int64_t chnl_p,
     dst_vec.Get(chnl_p) = static_cast<dst_type_>(res);
 }
 
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Converts a result to a fixed-point dst element (applies the underflow and overflow policies, kClip saturates at the dst range)
+ */
+template<typename param_, std::enable_if_t<param_::dst_type::is_int, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxToDst(float value, typename param_::dst_type& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    using data_type = typename param_::dst_type::data_type;
+
+    // shift to the dst fraction size and round (the conversion to an integer truncates)
+    constexpr auto shift = static_cast<float>(static_cast<int64_t>(1) << param_::dst_type::frac_bits);
+    float scaled         = value * shift;
+    if (param_::underflow_type == hvx::util::underflow_e::kRound)
+        scaled = std::floor(scaled + 0.5f);
+    else if (param_::underflow_type == hvx::util::underflow_e::kFloor)
+        scaled = std::floor(scaled);
+    else if (param_::underflow_type == hvx::util::underflow_e::kCeil)
+        scaled = std::ceil(scaled);
+
+    // the int64 conversion is always defined, kWrap keeps the lower bits
+    auto res = static_cast<int64_t>(hvx::util::Clamp(scaled, -9.0e18f, 9.0e18f));
+    if (param_::overflow_type != hvx::util::overflow_e::kWrap)
+        res = hvx::util::Clamp(res, static_cast<int64_t>(std::numeric_limits<data_type>::lowest()),
+                               static_cast<int64_t>(std::numeric_limits<data_type>::max()));
+    dst.data = static_cast<data_type>(res);
+}
+
+/*!
+ * @brief Converts a result to a floating-point dst element
+ */
+template<typename param_, std::enable_if_t<param_::dst_type::is_flt, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxToDst(float value, typename param_::dst_type& dst) noexcept -> void {
+    HVX_INLINE_TOP();
+    dst.data = static_cast<typename param_::dst_type::data_type>(value);
+}
+
+/*!
+ * @brief Calculates for the online softmax: n(i) = exp(src(i) - m) of a vector with its max m, and merges m and the sum of all n into the
+ * running max M and sum S of a pixel: S = S * exp(M - max(M, m)) + sum(n) * exp(m - max(M, m))
+ */
+template<typename param_, std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxOnlineStage1(bool first,
+                    typename param_::src_vec& src_vec,
+                    typename param_::buf_vec& exp_vec,
+                    typename param_::buf_type& vec_max,
+                    typename param_::buf_type& run_max,
+                    typename param_::buf_type& run_sum) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // fixed-point parameters
+    constexpr auto src_frac_shift_inv = 1.0f / static_cast<float>(static_cast<int64_t>(1) << param_::src_type::frac_bits);
+
+    // maximum of the vector (tree)
+    float data[param_::chnl_vec_size]{}, tree[param_::chnl_vec_size]{}; // NOLINT
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        const auto src = static_cast<float>(src_vec.Get(chnl_p).data);
+        data[chnl_p]   = (param_::src_type::is_int == true) ? (src * src_frac_shift_inv) : (src); // NOLINT
+        tree[chnl_p]   = data[chnl_p];                                                         // NOLINT
+    }
+    const float max = hvx::util::TreeReduce(tree, [](float a, float b) { return hvx::util::Max(a, b); });
+
+    // exponentials of the vector (all <= 1) and their sum (tree)
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        const float exponential  = std::exp(data[chnl_p] - max); // NOLINT
+        exp_vec.Get(chnl_p).data = exponential;
+        tree[chnl_p]             = exponential; // NOLINT
+    }
+    const float sum = hvx::util::TreeReduce(tree, [](float a, float b) { return a + b; });
+
+    // merge into the running max and sum
+    const float max_new = (first == true) ? (max) : (hvx::util::Max(run_max.data, max));
+    const float sum_new = run_sum.data * std::exp(run_max.data - max_new) + sum * std::exp(max - max_new);
+    vec_max.data        = max;
+    run_sum.data        = (first == true) ? (sum) : (sum_new);
+    run_max.data        = max_new;
+}
+
+/*!
+ * @brief Calculates for the online softmax: the global max M and 1 / S of a pixel from the block-parallel running max and sums
+ */
+template<typename param_, std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxOnlineFinal(hvx::util::array1d<typename param_::buf_type, param_::bp_width>& run_max,
+                   hvx::util::array1d<typename param_::buf_type, param_::bp_width>& run_sum,
+                   typename param_::buf_type& fin_max,
+                   typename param_::buf_type& fin_inv) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    // global maximum (tree)
+    float tree[param_::bp_width]{}; // NOLINT
+    for (int64_t bp = 0; bp < param_::bp_width; ++bp) {
+        HVX_UNROLL();
+        tree[bp] = run_max.Get(bp).data; // NOLINT
+    }
+    const float max = hvx::util::TreeReduce(tree, [](float a, float b) { return hvx::util::Max(a, b); });
+
+    // rescaled global sum (tree)
+    for (int64_t bp = 0; bp < param_::bp_width; ++bp) {
+        HVX_UNROLL();
+        tree[bp] = run_sum.Get(bp).data * std::exp(run_max.Get(bp).data - max); // NOLINT
+    }
+    const float sum = hvx::util::TreeReduce(tree, [](float a, float b) { return a + b; });
+
+    // replace division by multiplication
+    fin_max.data = max;
+    fin_inv.data = 1.0f / sum;
+}
+
+/*!
+ * @brief Calculates for the online softmax: m(i) = n(i) * exp(m - M) / S
+ */
+template<typename param_, std::enable_if_t<hvx::util::is_dfixed_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxOnlineStage2(typename param_::buf_vec& exp_vec,
+                    typename param_::buf_type vec_max,
+                    typename param_::buf_type fin_max,
+                    typename param_::buf_type fin_inv,
+                    typename param_::dst_vec& dst_vec) noexcept -> void {
+    HVX_INLINE_TOP();
+    const float scale = std::exp(vec_max.data - fin_max.data) * fin_inv.data;
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        hvx::nn::impl::SoftmaxToDst<param_>(exp_vec.Get(chnl_p).data * scale, dst_vec.Get(chnl_p));
+    }
+}
+
 /******************************************************************************************************************************************/
 } // namespace impl
 } // namespace nn
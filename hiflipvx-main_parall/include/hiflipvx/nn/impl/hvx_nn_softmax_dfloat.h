@@ -114,6 +114,122 @@ SoftmaxStage2(int64_t chnl_p,
     dst_vec.Get(chnl_p) = dynfloat::mixed_mul<dst_type_, df_execution>(src_vec.Get(chnl_p), inv_sum); // buf_type * comp_type
 }
 
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Calculates for the online softmax: n(i) = exp(src(i) - m) of a vector with its max m, and merges m and the sum of all n into the
+ * running max M and sum S of a pixel: S = S * exp(M - max(M, m)) + sum(n) * exp(m - max(M, m))
+ */
+template<typename param_, std::enable_if_t<dynfloat::is_dfloat_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxOnlineStage1(bool first,
+                    typename param_::src_vec& src_vec,
+                    typename param_::buf_vec& exp_vec,
+                    typename param_::buf_type& vec_max,
+                    typename param_::buf_type& run_max,
+                    typename param_::buf_type& run_sum) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type); // param_::underflow_type
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);   // param_::overflow_type
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+    using buf_type                = typename param_::buf_type;
+
+    // maximum of the vector (tree)
+    buf_type tree[param_::chnl_vec_size]{}; // NOLINT
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        tree[chnl_p] = static_cast<buf_type>(src_vec.Get(chnl_p)); // NOLINT
+    }
+    const auto max = hvx::util::TreeReduce(tree, [](buf_type a, buf_type b) { return (a < b) ? (b) : (a); });
+
+    // exponentials of the vector (all <= 1) and their sum (tree)
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        const auto diff     = dynfloat::sub<df_execution>(static_cast<buf_type>(src_vec.Get(chnl_p)), max);
+        exp_vec.Get(chnl_p) = dynfloat::exp<df_execution>(diff);
+        tree[chnl_p]        = exp_vec.Get(chnl_p); // NOLINT
+    }
+    const auto sum = hvx::util::TreeReduce(tree, [](buf_type a, buf_type b) { return dynfloat::add<df_execution>(a, b); });
+
+    // merge into the running max and sum
+    const auto max_new = (first == true) ? (max) : ((run_max < max) ? (max) : (run_max));
+    const auto run_scl = dynfloat::exp<df_execution>(dynfloat::sub<df_execution>(run_max, max_new));
+    const auto vec_scl = dynfloat::exp<df_execution>(dynfloat::sub<df_execution>(max, max_new));
+    const auto run_new = dynfloat::mul<df_execution>(run_sum, run_scl);
+    const auto sum_new = dynfloat::add<df_execution>(run_new, dynfloat::mul<df_execution>(sum, vec_scl));
+    vec_max            = max;
+    run_sum            = (first == true) ? (sum) : (sum_new);
+    run_max            = max_new;
+}
+
+/*!
+ * @brief Calculates for the online softmax: the global max M and 1 / S of a pixel from the block-parallel running max and sums
+ */
+template<typename param_, std::enable_if_t<dynfloat::is_dfloat_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxOnlineFinal(hvx::util::array1d<typename param_::buf_type, param_::bp_width>& run_max,
+                   hvx::util::array1d<typename param_::buf_type, param_::bp_width>& run_sum,
+                   typename param_::buf_type& fin_max,
+                   typename param_::buf_type& fin_inv) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type); // param_::underflow_type
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);   // param_::overflow_type
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+    using buf_type                = typename param_::buf_type;
+
+    // global maximum (tree)
+    buf_type tree[param_::bp_width]{}; // NOLINT
+    for (int64_t bp = 0; bp < param_::bp_width; ++bp) {
+        HVX_UNROLL();
+        tree[bp] = run_max.Get(bp); // NOLINT
+    }
+    const auto max = hvx::util::TreeReduce(tree, [](buf_type a, buf_type b) { return (a < b) ? (b) : (a); });
+
+    // rescaled global sum (tree)
+    for (int64_t bp = 0; bp < param_::bp_width; ++bp) {
+        HVX_UNROLL();
+        const auto scale = dynfloat::exp<df_execution>(dynfloat::sub<df_execution>(run_max.Get(bp), max));
+        tree[bp]         = dynfloat::mul<df_execution>(run_sum.Get(bp), scale); // NOLINT
+    }
+    const auto sum = hvx::util::TreeReduce(tree, [](buf_type a, buf_type b) { return dynfloat::add<df_execution>(a, b); });
+
+    // replace division by multiplication
+    fin_max = max;
+    fin_inv = dynfloat::reciprocal<df_execution>(sum);
+}
+
+/*!
+ * @brief Calculates for the online softmax: m(i) = n(i) * exp(m - M) / S
+ */
+template<typename param_, std::enable_if_t<dynfloat::is_dfloat_v<typename param_::src_type>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+SoftmaxOnlineStage2(typename param_::buf_vec& exp_vec,
+                    typename param_::buf_type vec_max,
+                    typename param_::buf_type fin_max,
+                    typename param_::buf_type fin_inv,
+                    typename param_::dst_vec& dst_vec) noexcept -> void {
+    HVX_INLINE_TOP();
+
+    //
+    constexpr auto execution      = hvx::util::ToDfloatExecution(param_::exec_type);
+    constexpr auto round          = hvx::util::ToDfloatUnderflow(param_::underflow_type); // param_::underflow_type
+    constexpr auto special_values = hvx::util::ToDfloatOverflow(param_::overflow_type);   // param_::overflow_type
+    using df_execution            = dynfloat::execution<execution, round, special_values>;
+
+    //
+    const auto scale = dynfloat::mul<df_execution>(dynfloat::exp<df_execution>(dynfloat::sub<df_execution>(vec_max, fin_max)), fin_inv);
+    for (int64_t chnl_p = 0; chnl_p < param_::chnl_vec_size; ++chnl_p) {
+        HVX_UNROLL();
+        dst_vec.Get(chnl_p) = dynfloat::mixed_mul<typename param_::dst_type, df_execution>(exp_vec.Get(chnl_p), scale);
+    }
+}
+
 /******************************************************************************************************************************************/
 } // namespace impl
 } // namespace nn
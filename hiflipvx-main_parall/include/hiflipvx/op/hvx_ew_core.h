@@ -27,6 +27,7 @@
 
 #include "impl/hvx_ew_dfixed.h"
 #include "impl/hvx_ew_dfloat.h"
+#include "impl/hvx_ew_simd.h"
 
 namespace hvx {
 namespace ew {
@@ -94,6 +95,12 @@ ElementwiseTop(typename param_::src1_port* src1,
                typename param_::dst_port* dst,
                const typename param_::arg_type arg1,
                const typename param_::arg_type arg2) noexcept -> void {
+#if !defined(HVX_SYNTHESIS_ACTIVE) && !defined(HVX_SIM_EW_SCALAR) && !defined(HVX_SIM_PROFILE)
+    // C-simulation fast path for integer tensors in memory (bypasses the streams, so it is disabled while profiling)
+    if (hvx::ew::impl::ElementwiseSimd<param_>(src1, src2, dst, arg1, arg2))
+        return;
+#endif
+
     // iterates through the tensor vector by vector
     int64_t src1_ptr = 0, src2_ptr = 0, ptr_dst = 0;
     for (int64_t i = 0; i < param_::vec_elms; ++i) {
@@ -0,0 +1,603 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_ew_simd.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  SIMD fast path of the integer (dfixed) elementwise operations for the C-simulation (AVX-512, AVX2 or SSE4.1, selected at compile
+ *  time). The values are widened to 32 bit lanes (or 64 bit lanes, if an intermediate result can exceed 32 bit), the operation and the
+ *  underflow/overflow policies are applied like in ElementwiseComp and the result is truncated to the dst type, so the result is bit
+ *  exact. Operations, types or instruction sets that are not covered use the scalar implementation. Not available during synthesis.
+ */
+
+#ifndef HVX_EW_SIMD_H_
+#define HVX_EW_SIMD_H_
+
+#include "hvx_ew_dfixed.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <cstring>
+#if defined(__SSE4_1__) || defined(__AVX2__) || defined(__AVX512F__)
+#if defined(__GNUC__) && !defined(__clang__) // False positive on GCC (the AVX-512 conversions start from an undefined register)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#endif
+
+namespace hvx {
+namespace ew {
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief SIMD registers of "bits_" bit lanes (no instruction set available)
+ */
+template<int64_t bits_>
+struct EwLanes {
+    static constexpr int64_t size = 0;
+};
+
+#if defined(__AVX512F__)
+/*!
+ * @brief SIMD registers of 32 bit lanes (AVX-512)
+ */
+template<>
+struct EwLanes<32> {
+    using reg                     = __m512i;
+    using mask                    = __mmask16;
+    static constexpr int64_t size = 16;
+
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Load(const type_* src) noexcept -> reg {
+        const auto* ptr = reinterpret_cast<const __m128i*>(src); // NOLINT
+        switch (sizeof(type_) * 2 + std::is_signed<type_>::value) {
+            case 2: return _mm512_cvtepu8_epi32(_mm_loadu_si128(ptr));
+            case 3: return _mm512_cvtepi8_epi32(_mm_loadu_si128(ptr));
+            case 4: return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))); // NOLINT
+            case 5: return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))); // NOLINT
+            default: return _mm512_loadu_si512(src);
+        }
+    }
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Store(type_* dst, reg value) noexcept -> void {
+        if (sizeof(type_) == 1)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm512_cvtepi32_epi8(value)); // NOLINT
+        else if (sizeof(type_) == 2)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm512_cvtepi32_epi16(value)); // NOLINT
+        else
+            _mm512_storeu_si512(dst, value);
+    }
+    static HVX_FORCE_INLINE auto Set1(int64_t value) noexcept -> reg { return _mm512_set1_epi32(static_cast<int32_t>(value)); }
+    static HVX_FORCE_INLINE auto Add(reg a, reg b) noexcept -> reg { return _mm512_add_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Sub(reg a, reg b) noexcept -> reg { return _mm512_sub_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Mul(reg a, reg b) noexcept -> reg { return _mm512_mullo_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Min(reg a, reg b) noexcept -> reg { return _mm512_min_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Max(reg a, reg b) noexcept -> reg { return _mm512_max_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Abs(reg a) noexcept -> reg { return _mm512_abs_epi32(a); }
+    static HVX_FORCE_INLINE auto And(reg a, reg b) noexcept -> reg { return _mm512_and_si512(a, b); }
+    static HVX_FORCE_INLINE auto Lt(reg a, reg b) noexcept -> mask { return _mm512_cmplt_epi32_mask(a, b); }
+    static HVX_FORCE_INLINE auto Ne(reg a, reg b) noexcept -> mask { return _mm512_cmpneq_epi32_mask(a, b); }
+    static HVX_FORCE_INLINE auto Select(mask cond, reg a, reg b) noexcept -> reg { return _mm512_mask_blend_epi32(cond, a, b); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Slli(reg a) noexcept -> reg { return _mm512_slli_epi32(a, static_cast<unsigned>(shift_)); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Srai(reg a) noexcept -> reg { return _mm512_srai_epi32(a, static_cast<unsigned>(shift_)); }
+};
+
+/*!
+ * @brief SIMD registers of 64 bit lanes (AVX-512)
+ */
+template<>
+struct EwLanes<64> {
+    using reg                     = __m512i;
+    using mask                    = __mmask8;
+    static constexpr int64_t size = 8;
+
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Load(const type_* src) noexcept -> reg {
+        const auto* ptr = reinterpret_cast<const __m128i*>(src); // NOLINT
+        switch (sizeof(type_) * 2 + std::is_signed<type_>::value) {
+            case 2: return _mm512_cvtepu8_epi64(_mm_loadl_epi64(ptr));
+            case 3: return _mm512_cvtepi8_epi64(_mm_loadl_epi64(ptr));
+            case 4: return _mm512_cvtepu16_epi64(_mm_loadu_si128(ptr));
+            case 5: return _mm512_cvtepi16_epi64(_mm_loadu_si128(ptr));
+            case 8: return _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))); // NOLINT
+            default: return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))); // NOLINT
+        }
+    }
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Store(type_* dst, reg value) noexcept -> void {
+        if (sizeof(type_) == 1)
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm512_cvtepi64_epi8(value)); // NOLINT
+        else if (sizeof(type_) == 2)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm512_cvtepi64_epi16(value)); // NOLINT
+        else
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm512_cvtepi64_epi32(value)); // NOLINT
+    }
+    static HVX_FORCE_INLINE auto Set1(int64_t value) noexcept -> reg { return _mm512_set1_epi64(value); }
+    static HVX_FORCE_INLINE auto Add(reg a, reg b) noexcept -> reg { return _mm512_add_epi64(a, b); }
+    static HVX_FORCE_INLINE auto Sub(reg a, reg b) noexcept -> reg { return _mm512_sub_epi64(a, b); }
+    static HVX_FORCE_INLINE auto Mul(reg a, reg b) noexcept -> reg { return _mm512_mul_epi32(a, b); } // operands fit into 32 bit
+    static HVX_FORCE_INLINE auto Min(reg a, reg b) noexcept -> reg { return _mm512_min_epi64(a, b); }
+    static HVX_FORCE_INLINE auto Max(reg a, reg b) noexcept -> reg { return _mm512_max_epi64(a, b); }
+    static HVX_FORCE_INLINE auto Abs(reg a) noexcept -> reg { return _mm512_abs_epi64(a); }
+    static HVX_FORCE_INLINE auto And(reg a, reg b) noexcept -> reg { return _mm512_and_si512(a, b); }
+    static HVX_FORCE_INLINE auto Lt(reg a, reg b) noexcept -> mask { return _mm512_cmplt_epi64_mask(a, b); }
+    static HVX_FORCE_INLINE auto Ne(reg a, reg b) noexcept -> mask { return _mm512_cmpneq_epi64_mask(a, b); }
+    static HVX_FORCE_INLINE auto Select(mask cond, reg a, reg b) noexcept -> reg { return _mm512_mask_blend_epi64(cond, a, b); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Slli(reg a) noexcept -> reg { return _mm512_slli_epi64(a, static_cast<unsigned>(shift_)); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Srai(reg a) noexcept -> reg { return _mm512_srai_epi64(a, static_cast<unsigned>(shift_)); }
+};
+
+#elif defined(__AVX2__)
+/*!
+ * @brief SIMD registers of 32 bit lanes (AVX2)
+ */
+template<>
+struct EwLanes<32> {
+    using reg                     = __m256i;
+    using mask                    = __m256i;
+    static constexpr int64_t size = 8;
+
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Load(const type_* src) noexcept -> reg {
+        const auto* ptr = reinterpret_cast<const __m128i*>(src); // NOLINT
+        switch (sizeof(type_) * 2 + std::is_signed<type_>::value) {
+            case 2: return _mm256_cvtepu8_epi32(_mm_loadl_epi64(ptr));
+            case 3: return _mm256_cvtepi8_epi32(_mm_loadl_epi64(ptr));
+            case 4: return _mm256_cvtepu16_epi32(_mm_loadu_si128(ptr));
+            case 5: return _mm256_cvtepi16_epi32(_mm_loadu_si128(ptr));
+            default: return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)); // NOLINT
+        }
+    }
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Store(type_* dst, reg value) noexcept -> void {
+        // gathers the lowest byte(s) of all lanes in the lowest 64/128 bit (truncation)
+        if (sizeof(type_) == 1) {
+            const __m256i index = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, //
+                                                   0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m256i bytes = _mm256_shuffle_epi8(value, index);
+            const __m256i res   = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(res)); // NOLINT
+        } else if (sizeof(type_) == 2) {
+            const __m256i index = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, //
+                                                   0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m256i words = _mm256_shuffle_epi8(value, index);
+            const __m256i res   = _mm256_permute4x64_epi64(words, 0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(res)); // NOLINT
+        } else {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), value); // NOLINT
+        }
+    }
+    static HVX_FORCE_INLINE auto Set1(int64_t value) noexcept -> reg { return _mm256_set1_epi32(static_cast<int32_t>(value)); }
+    static HVX_FORCE_INLINE auto Add(reg a, reg b) noexcept -> reg { return _mm256_add_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Sub(reg a, reg b) noexcept -> reg { return _mm256_sub_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Mul(reg a, reg b) noexcept -> reg { return _mm256_mullo_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Min(reg a, reg b) noexcept -> reg { return _mm256_min_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Max(reg a, reg b) noexcept -> reg { return _mm256_max_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Abs(reg a) noexcept -> reg { return _mm256_abs_epi32(a); }
+    static HVX_FORCE_INLINE auto And(reg a, reg b) noexcept -> reg { return _mm256_and_si256(a, b); }
+    static HVX_FORCE_INLINE auto Lt(reg a, reg b) noexcept -> mask { return _mm256_cmpgt_epi32(b, a); }
+    static HVX_FORCE_INLINE auto Ne(reg a, reg b) noexcept -> mask {
+        return _mm256_xor_si256(_mm256_cmpeq_epi32(a, b), _mm256_set1_epi32(-1));
+    }
+    static HVX_FORCE_INLINE auto Select(mask cond, reg a, reg b) noexcept -> reg { return _mm256_blendv_epi8(a, b, cond); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Slli(reg a) noexcept -> reg { return _mm256_slli_epi32(a, static_cast<int>(shift_)); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Srai(reg a) noexcept -> reg { return _mm256_srai_epi32(a, static_cast<int>(shift_)); }
+};
+
+/*!
+ * @brief SIMD registers of 64 bit lanes (AVX2, the missing 64 bit instructions are emulated)
+ */
+template<>
+struct EwLanes<64> {
+    using reg                     = __m256i;
+    using mask                    = __m256i;
+    static constexpr int64_t size = 4;
+
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Load(const type_* src) noexcept -> reg {
+        const auto* ptr = reinterpret_cast<const __m128i*>(src); // NOLINT
+        int32_t bytes   = 0;
+        switch (sizeof(type_) * 2 + std::is_signed<type_>::value) {
+            case 2: std::memcpy(&bytes, src, sizeof(bytes)); return _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+            case 3: std::memcpy(&bytes, src, sizeof(bytes)); return _mm256_cvtepi8_epi64(_mm_cvtsi32_si128(bytes));
+            case 4: return _mm256_cvtepu16_epi64(_mm_loadl_epi64(ptr));
+            case 5: return _mm256_cvtepi16_epi64(_mm_loadl_epi64(ptr));
+            case 8: return _mm256_cvtepu32_epi64(_mm_loadu_si128(ptr));
+            default: return _mm256_cvtepi32_epi64(_mm_loadu_si128(ptr));
+        }
+    }
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Store(type_* dst, reg value) noexcept -> void {
+        // gathers the lower 32 bit of all lanes and then the lowest byte(s) of them (truncation)
+        const __m128i dwords = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(value, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+        if (sizeof(type_) == 1) {
+            const int32_t bytes = _mm_cvtsi128_si32(_mm_shuffle_epi8(dwords, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                                                            -1, -1, -1)));
+            std::memcpy(dst, &bytes, sizeof(bytes));
+        } else if (sizeof(type_) == 2) {
+            const __m128i words = _mm_shuffle_epi8(dwords, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), words); // NOLINT
+        } else {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), dwords); // NOLINT
+        }
+    }
+    static HVX_FORCE_INLINE auto Set1(int64_t value) noexcept -> reg { return _mm256_set1_epi64x(value); }
+    static HVX_FORCE_INLINE auto Add(reg a, reg b) noexcept -> reg { return _mm256_add_epi64(a, b); }
+    static HVX_FORCE_INLINE auto Sub(reg a, reg b) noexcept -> reg { return _mm256_sub_epi64(a, b); }
+    static HVX_FORCE_INLINE auto Mul(reg a, reg b) noexcept -> reg { return _mm256_mul_epi32(a, b); } // operands fit into 32 bit
+    static HVX_FORCE_INLINE auto Min(reg a, reg b) noexcept -> reg { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    static HVX_FORCE_INLINE auto Max(reg a, reg b) noexcept -> reg { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    static HVX_FORCE_INLINE auto Abs(reg a) noexcept -> reg {
+        const __m256i zero = _mm256_setzero_si256();
+        return _mm256_blendv_epi8(a, _mm256_sub_epi64(zero, a), _mm256_cmpgt_epi64(zero, a));
+    }
+    static HVX_FORCE_INLINE auto And(reg a, reg b) noexcept -> reg { return _mm256_and_si256(a, b); }
+    static HVX_FORCE_INLINE auto Lt(reg a, reg b) noexcept -> mask { return _mm256_cmpgt_epi64(b, a); }
+    static HVX_FORCE_INLINE auto Ne(reg a, reg b) noexcept -> mask {
+        return _mm256_xor_si256(_mm256_cmpeq_epi64(a, b), _mm256_set1_epi64x(-1));
+    }
+    static HVX_FORCE_INLINE auto Select(mask cond, reg a, reg b) noexcept -> reg { return _mm256_blendv_epi8(a, b, cond); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Slli(reg a) noexcept -> reg { return _mm256_slli_epi64(a, static_cast<int>(shift_)); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Srai(reg a) noexcept -> reg {
+        if (shift_ == 0)
+            return a;
+        const __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+        return _mm256_or_si256(_mm256_srli_epi64(a, static_cast<int>(shift_)), _mm256_slli_epi64(sign, static_cast<int>(64 - shift_)));
+    }
+};
+
+#elif defined(__SSE4_1__)
+/*!
+ * @brief SIMD registers of 32 bit lanes (SSE4.1)
+ */
+template<>
+struct EwLanes<32> {
+    using reg                     = __m128i;
+    using mask                    = __m128i;
+    static constexpr int64_t size = 4;
+
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Load(const type_* src) noexcept -> reg {
+        const auto* ptr = reinterpret_cast<const __m128i*>(src); // NOLINT
+        int32_t bytes   = 0;
+        switch (sizeof(type_) * 2 + std::is_signed<type_>::value) {
+            case 2: std::memcpy(&bytes, src, sizeof(bytes)); return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes));
+            case 3: std::memcpy(&bytes, src, sizeof(bytes)); return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(bytes));
+            case 4: return _mm_cvtepu16_epi32(_mm_loadl_epi64(ptr));
+            case 5: return _mm_cvtepi16_epi32(_mm_loadl_epi64(ptr));
+            default: return _mm_loadu_si128(ptr);
+        }
+    }
+    template<typename type_>
+    static HVX_FORCE_INLINE auto Store(type_* dst, reg value) noexcept -> void {
+        // gathers the lowest byte(s) of all lanes in the lowest 32/64 bit (truncation)
+        if (sizeof(type_) == 1) {
+            const int32_t bytes =
+                _mm_cvtsi128_si32(_mm_shuffle_epi8(value, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)));
+            std::memcpy(dst, &bytes, sizeof(bytes));
+        } else if (sizeof(type_) == 2) {
+            const __m128i words = _mm_shuffle_epi8(value, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), words); // NOLINT
+        } else {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value); // NOLINT
+        }
+    }
+    static HVX_FORCE_INLINE auto Set1(int64_t value) noexcept -> reg { return _mm_set1_epi32(static_cast<int32_t>(value)); }
+    static HVX_FORCE_INLINE auto Add(reg a, reg b) noexcept -> reg { return _mm_add_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Sub(reg a, reg b) noexcept -> reg { return _mm_sub_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Mul(reg a, reg b) noexcept -> reg { return _mm_mullo_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Min(reg a, reg b) noexcept -> reg { return _mm_min_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Max(reg a, reg b) noexcept -> reg { return _mm_max_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Abs(reg a) noexcept -> reg { return _mm_abs_epi32(a); }
+    static HVX_FORCE_INLINE auto And(reg a, reg b) noexcept -> reg { return _mm_and_si128(a, b); }
+    static HVX_FORCE_INLINE auto Lt(reg a, reg b) noexcept -> mask { return _mm_cmplt_epi32(a, b); }
+    static HVX_FORCE_INLINE auto Ne(reg a, reg b) noexcept -> mask { return _mm_xor_si128(_mm_cmpeq_epi32(a, b), _mm_set1_epi32(-1)); }
+    static HVX_FORCE_INLINE auto Select(mask cond, reg a, reg b) noexcept -> reg { return _mm_blendv_epi8(a, b, cond); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Slli(reg a) noexcept -> reg { return _mm_slli_epi32(a, static_cast<int>(shift_)); }
+    template<int64_t shift_>
+    static HVX_FORCE_INLINE auto Srai(reg a) noexcept -> reg { return _mm_srai_epi32(a, static_cast<int>(shift_)); }
+};
+#endif
+
+/*!
+ * @brief name of the instruction set the SIMD fast path was compiled for ("none" if only the scalar implementation is available)
+ */
+constexpr auto
+EwSimdIsa() noexcept -> const char* {
+#if defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSE4_1__)
+    return "SSE4.1";
+#else
+    return "none";
+#endif
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Compile time parameters of the SIMD elementwise operations (value ranges decide between 32 and 64 bit lanes)
+ */
+template<typename param_>
+struct EwSimdParam {
+    using src1_data = typename param_::src1_type::data_type;
+    using src2_data = typename param_::src2_type::data_type;
+    using arg_data  = typename param_::arg_type::data_type;
+    using dst_data  = typename param_::dst_type::data_type;
+
+    // supported data types and operations
+    static constexpr auto op      = param_::op_type;
+    static constexpr bool is_int  = param_::src1_type::is_int && param_::src2_type::is_int && param_::dst_type::is_int &&
+                                   param_::arg_type::is_int;
+    static constexpr bool is_bin  = (op == hvx::util::elmwise_e::Add) || (op == hvx::util::elmwise_e::Max) ||
+                                   (op == hvx::util::elmwise_e::Min) || (op == hvx::util::elmwise_e::Mul) ||
+                                   (op == hvx::util::elmwise_e::Sub);
+    static constexpr bool is_cst  = (op == hvx::util::elmwise_e::AddConst) || (op == hvx::util::elmwise_e::MaxConst) ||
+                                   (op == hvx::util::elmwise_e::MinConst) || (op == hvx::util::elmwise_e::MulConst) ||
+                                   (op == hvx::util::elmwise_e::Clip);
+    static constexpr bool is_abs  = (op == hvx::util::elmwise_e::Abs) && (sizeof(src1_data) < sizeof(int32_t)); // abs(INT32_MIN): UB
+    static constexpr bool is_op   = is_bin || is_cst || is_abs;
+    static constexpr bool is_mul  = (op == hvx::util::elmwise_e::Mul) || (op == hvx::util::elmwise_e::MulConst);
+    static constexpr bool is_add  = (op == hvx::util::elmwise_e::Add) || (op == hvx::util::elmwise_e::AddConst) ||
+                                   (op == hvx::util::elmwise_e::Sub);
+
+    // largest absolute value of the operands
+    template<typename type_>
+    static constexpr auto AbsMax() noexcept -> int64_t {
+        return hvx::util::Max(static_cast<int64_t>(std::numeric_limits<type_>::max()),
+                              -static_cast<int64_t>(std::numeric_limits<type_>::lowest()));
+    }
+    static constexpr int64_t src1_max = is_int ? AbsMax<src1_data>() : 0;
+    static constexpr int64_t opb_max  = is_int ? (is_bin ? AbsMax<src2_data>() : AbsMax<arg_data>()) : 0;
+
+    // shifts to align the fraction bits of both operands (Cast2FixedToBigger) and to the dst fraction bits (IntApplyPolicies)
+    static constexpr int64_t src1_frac   = param_::src1_type::frac_bits;
+    static constexpr int64_t opb_frac    = is_bin ? param_::src2_type::frac_bits : param_::arg_type::frac_bits;
+    static constexpr int64_t src1_shift  = (is_mul || !(is_bin || is_cst) || (src1_frac > opb_frac)) ? 0 : (opb_frac - src1_frac);
+    static constexpr int64_t opb_shift   = (is_mul || !(is_bin || is_cst) || (src1_frac <= opb_frac)) ? 0 : (src1_frac - opb_frac);
+    static constexpr int64_t op_frac     = hvx::ew::impl::OpFracBits<param_>();
+    static constexpr int64_t dst_shift   = hvx::util::Abs(op_frac - param_::dst_type::frac_bits);
+    static constexpr bool shift_right    = (op_frac > param_::dst_type::frac_bits);
+    static constexpr int64_t round       = static_cast<int64_t>(1) << (hvx::util::Max(dst_shift, static_cast<int64_t>(1)) - 1);
+    static constexpr bool shift_in_range = (src1_shift <= 30) && (opb_shift <= 30) && (dst_shift <= 30);
+
+    // largest absolute value of the result before it is converted to the dst type
+    static constexpr int64_t opa_max = shift_in_range ? (src1_max << src1_shift) : 0;
+    static constexpr int64_t opc_max = shift_in_range ? (opb_max << opb_shift) : 0;
+    static constexpr int64_t op_max  = is_mul ? (src1_max * opb_max) : (is_add ? (opa_max + opc_max) : hvx::util::Max(opa_max, opc_max));
+    static constexpr int64_t res_max = shift_in_range ? (shift_right ? (op_max + round) : (op_max << dst_shift)) : 0;
+
+    // number of bits of a lane (0 if the scalar implementation is used), the multiplication of 64 bit lanes only uses the lower 32 bit
+    // of the (signed) operands
+    static constexpr bool mul_in_range = !is_mul || ((src1_max <= std::numeric_limits<int32_t>::max()) &&
+                                                     (opb_max <= std::numeric_limits<int32_t>::max()));
+    static constexpr bool supported    = is_int && is_op && shift_in_range && mul_in_range;
+    static constexpr int64_t bits   = !supported                                                      ? 0
+                                      : (res_max <= std::numeric_limits<int32_t>::max())              ? 32
+                                      : (res_max <= (std::numeric_limits<int64_t>::max() >> 1))       ? 64
+                                                                                                      : 0;
+    static constexpr int64_t lanes  = (bits == 0) ? 0 : hvx::ew::impl::EwLanes<(bits == 0) ? 32 : bits>::size;
+};
+
+/*!
+ * @brief applies the operation and the underflow/overflow policies on a register (like ElementwiseComp and IntApplyPolicies)
+ */
+template<typename param_, typename simd_, typename lanes_, typename reg_ = typename lanes_::reg>
+HVX_FORCE_INLINE auto
+ElementwiseSimdComp(reg_ src1, reg_ src2, reg_ arg1, reg_ arg2) noexcept -> reg_ {
+    constexpr int64_t bits   = simd_::bits;
+    constexpr int64_t width  = std::numeric_limits<typename simd_::src1_data>::digits + std::is_signed<typename simd_::src1_data>::value;
+    constexpr int64_t ext    = (std::is_signed<typename simd_::src1_data>::value && (width < bits)) ? (bits - width) : 0;
+    constexpr auto dst_max   = static_cast<int64_t>(std::numeric_limits<typename simd_::dst_data>::max());
+    constexpr auto dst_min   = static_cast<int64_t>(std::numeric_limits<typename simd_::dst_data>::lowest());
+    constexpr int64_t dst_sh = simd_::dst_shift;
+    const reg_ opa           = lanes_::template Slli<simd_::src1_shift>(src1);
+    const reg_ opb           = lanes_::template Slli<simd_::opb_shift>(src2);
+    const reg_ opc           = lanes_::template Slli<simd_::opb_shift>(arg1);
+    const reg_ opd           = lanes_::template Slli<simd_::opb_shift>(arg2);
+
+    // operation
+    reg_ value{};
+    switch (param_::op_type) {
+        case hvx::util::elmwise_e::Abs: // the absolute value keeps the src type (e.g. abs(-128) = -128 for int8)
+            value = lanes_::template Srai<ext>(lanes_::template Slli<ext>(lanes_::Abs(src1)));
+            break;
+        case hvx::util::elmwise_e::Add:
+            value = lanes_::Add(opa, opb);
+            break;
+        case hvx::util::elmwise_e::AddConst:
+            value = lanes_::Add(opa, opc);
+            break;
+        case hvx::util::elmwise_e::Clip:
+            value = lanes_::Select(lanes_::Lt(opa, opc), lanes_::Min(opa, opd), opc);
+            break;
+        case hvx::util::elmwise_e::Max:
+            value = lanes_::Max(opa, opb);
+            break;
+        case hvx::util::elmwise_e::MaxConst:
+            value = lanes_::Max(opa, opc);
+            break;
+        case hvx::util::elmwise_e::Min:
+            value = lanes_::Min(opa, opb);
+            break;
+        case hvx::util::elmwise_e::MinConst:
+            value = lanes_::Min(opa, opc);
+            break;
+        case hvx::util::elmwise_e::Mul:
+            value = lanes_::Mul(src1, src2);
+            break;
+        case hvx::util::elmwise_e::MulConst:
+            value = lanes_::Mul(src1, arg1);
+            break;
+        case hvx::util::elmwise_e::Sub:
+            value = lanes_::Sub(opa, opb);
+            break;
+        default:
+            break;
+    }
+
+    // shift to the dst fraction bits and apply the underflow policy (FixedUnderflow)
+    if (simd_::shift_right) {
+        const reg_ one = lanes_::Set1(1);
+        switch (param_::underflow_type) {
+            case hvx::util::underflow_e::kTrunc: {
+                const reg_ res = lanes_::template Srai<dst_sh>(value);
+                value          = lanes_::Select(lanes_::Lt(value, lanes_::Set1(0)), res, lanes_::Add(res, one));
+                break;
+            }
+            case hvx::util::underflow_e::kCeil: {
+                const reg_ res = lanes_::template Srai<dst_sh>(value);
+                const reg_ rem = lanes_::And(value, lanes_::Set1(static_cast<int64_t>((1 << dst_sh) - 1)));
+                value          = lanes_::Select(lanes_::Ne(rem, lanes_::Set1(0)), res, lanes_::Add(res, one));
+                break;
+            }
+            case hvx::util::underflow_e::kFloor:
+                value = lanes_::template Srai<dst_sh>(value);
+                break;
+            case hvx::util::underflow_e::kRound:
+                value = lanes_::template Srai<dst_sh>(lanes_::Add(value, lanes_::Set1(simd_::round)));
+                break;
+            default:
+                value = lanes_::Set1(0);
+                break;
+        }
+    } else {
+        value = lanes_::template Slli<dst_sh>(value);
+    }
+
+    // overflow policy (the conversion to the dst type truncates)
+    if (param_::overflow_type == hvx::util::overflow_e::kSaturate) {
+        value = lanes_::Min(value, lanes_::Set1(dst_max));
+        value = lanes_::Max(value, lanes_::Set1(dst_min));
+    }
+    return value;
+}
+
+/*!
+ * @brief applies the operation on "elms" elements with SIMD registers of "bits_" bit lanes and on the remaining elements with
+ * ElementwiseComp (the tensors are read and written as arrays of the data types)
+ */
+template<typename param_,
+         int64_t bits_,
+         int64_t elms_,
+         typename simd_                      = hvx::ew::impl::EwSimdParam<param_>,
+         std::enable_if_t<(bits_ > 0), bool> = true>
+auto
+ElementwiseSimdLoop(const typename simd_::src1_data* src1,
+                    const typename simd_::src2_data* src2,
+                    typename simd_::dst_data* dst,
+                    const typename param_::arg_type arg1,
+                    const typename param_::arg_type arg2) noexcept -> void {
+    using lanes = hvx::ew::impl::EwLanes<bits_>;
+    using reg   = typename lanes::reg;
+
+    // number of elements computed with SIMD registers
+    constexpr int64_t simd_elms = (elms_ / lanes::size) * lanes::size;
+
+    // constant operands (widened from their data type, so unsigned constants keep their value)
+    const reg arg1_reg = lanes::Set1(static_cast<int64_t>(arg1.data));
+    const reg arg2_reg = lanes::Set1(static_cast<int64_t>(arg2.data));
+
+    // SIMD part
+    for (int64_t i = 0; i < simd_elms; i += lanes::size) {
+        const reg src1_reg = lanes::Load(src1 + i);
+        const reg src2_reg = param_::src2_cond ? lanes::Load(src2 + i) : arg1_reg;
+        lanes::Store(dst + i, hvx::ew::impl::ElementwiseSimdComp<param_, simd_, lanes>(src1_reg, src2_reg, arg1_reg, arg2_reg));
+    }
+
+    // scalar remainder
+    for (int64_t i = simd_elms; i < elms_; ++i) {
+        typename param_::src1_type src1_elm{};
+        typename param_::src2_type src2_elm{};
+        typename param_::dst_type dst_elm{};
+        src1_elm.data = src1[i]; // NOLINT
+        if (param_::src2_cond)
+            src2_elm.data = src2[i]; // NOLINT
+        hvx::ew::impl::ElementwiseComp<param_>(src1_elm, src2_elm, arg1, arg2, dst_elm);
+        dst[i] = dst_elm.data; // NOLINT
+    }
+}
+
+/*!
+ * @brief no SIMD implementation available
+ */
+template<typename param_,
+         int64_t bits_,
+         int64_t elms_,
+         typename simd_                       = hvx::ew::impl::EwSimdParam<param_>,
+         std::enable_if_t<(bits_ == 0), bool> = true>
+auto
+ElementwiseSimdLoop(const typename simd_::src1_data* /*src1*/,
+                    const typename simd_::src2_data* /*src2*/,
+                    typename simd_::dst_data* /*dst*/,
+                    const typename param_::arg_type /*arg1*/,
+                    const typename param_::arg_type /*arg2*/) noexcept -> void {}
+
+/*!
+ * @brief SIMD elementwise operation on tensors in memory, returns false if it is not available (the caller uses ElementwiseComp)
+ */
+template<typename param_>
+auto
+ElementwiseSimd(const typename param_::src1_port* src1,
+                const typename param_::src2_port* src2,
+                typename param_::dst_port* dst,
+                const typename param_::arg_type arg1,
+                const typename param_::arg_type arg2) noexcept -> bool {
+    using simd                = hvx::ew::impl::EwSimdParam<param_>;
+    constexpr int64_t bits    = (simd::lanes > 0) ? simd::bits : 0;
+    constexpr bool contiguous = (sizeof(typename param_::src1_port) == param_::vec_size * sizeof(typename simd::src1_data)) &&
+                                (sizeof(typename param_::src2_port) == param_::vec_size * sizeof(typename simd::src2_data)) &&
+                                (sizeof(typename param_::dst_port) == param_::vec_size * sizeof(typename simd::dst_data));
+    if ((simd::lanes == 0) || !contiguous)
+        return false;
+
+    // streams between layers are computed element by element
+    if ((hvx::sim::ChannelFromPort(src1) != nullptr) || (param_::src2_cond && (hvx::sim::ChannelFromPort(src2) != nullptr)) ||
+        (hvx::sim::ChannelFromPort(dst) != nullptr))
+        return false;
+
+    // the vectors of a tensor are stored without gaps, so the whole tensor is read and written as one array of the data type
+    constexpr int64_t elms = param_::vec_elms * param_::vec_size;
+    const auto* src1_ptr   = reinterpret_cast<const typename simd::src1_data*>(src1); // NOLINT
+    const auto* src2_ptr   = reinterpret_cast<const typename simd::src2_data*>(src2); // NOLINT
+    auto* dst_ptr          = reinterpret_cast<typename simd::dst_data*>(dst);         // NOLINT
+    hvx::ew::impl::ElementwiseSimdLoop<param_, bits, elms>(src1_ptr, src2_ptr, dst_ptr, arg1, arg2);
+    return true;
+}
+
+/******************************************************************************************************************************************/
+} // namespace impl
+} // namespace ew
+} // namespace hvx
+
+#if (defined(__SSE4_1__) || defined(__AVX2__) || defined(__AVX512F__)) && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif // !HVX_SYNTHESIS_ACTIVE
+#endif // HVX_EW_SIMD_H_
@@ -0,0 +1,100 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sim_dataflow.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Emulates the task level parallelism (HVX_TLP) of a dataflow region during C-simulation. Every stage (usually one top function) runs in
+ *  its own thread and the stages are connected by hvx::sim::Channel. Not available during synthesis.
+ */
+
+#ifndef HVX_SIM_DATAFLOW_H_
+#define HVX_SIM_DATAFLOW_H_
+
+#include "hvx_sim_stream.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <functional>
+
+namespace hvx {
+namespace sim {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief A dataflow region: a set of stages that are executed concurrently and communicate through channels
+ */
+class Dataflow {
+public:
+    /*!
+     * @brief adds a stage (e.g. a lambda that calls a top function with channel ports)
+     */
+    auto Add(std::function<void()> stage) -> Dataflow& {
+        stages_.emplace_back(std::move(stage));
+        return *this;
+    }
+
+    /*!
+     * @brief adds a stage that streams "elms" vectors from memory into a channel
+     */
+    template<typename type_>
+    auto AddSource(hvx::sim::Channel<type_>& channel, const type_* src, int64_t elms) -> Dataflow& {
+        return Add([&channel, src, elms]() {
+            for (int64_t i = 0; i < elms; ++i)
+                channel.Write(src[i]); // NOLINT
+        });
+    }
+
+    /*!
+     * @brief adds a stage that streams "elms" vectors from a channel into memory
+     */
+    template<typename type_>
+    auto AddSink(hvx::sim::Channel<type_>& channel, type_* dst, int64_t elms) -> Dataflow& {
+        return Add([&channel, dst, elms]() {
+            for (int64_t i = 0; i < elms; ++i)
+                channel.Read(dst[i]); // NOLINT
+        });
+    }
+
+    /*!
+     * @brief number of stages
+     */
+    auto Size() const noexcept -> int64_t {
+        return static_cast<int64_t>(stages_.size());
+    }
+
+    /*!
+     * @brief runs all stages concurrently (one thread each) and returns when all of them have finished
+     */
+    auto Run() -> void {
+        std::vector<std::thread> threads;
+        threads.reserve(stages_.size());
+        for (auto& stage : stages_)
+            threads.emplace_back(stage);
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+private:
+    std::vector<std::function<void()>> stages_;
+};
+
+/******************************************************************************************************************************************/
+} // namespace sim
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE
+#endif // HVX_SIM_DATAFLOW_H_
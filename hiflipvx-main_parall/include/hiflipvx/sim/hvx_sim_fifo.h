@@ -0,0 +1,319 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sim_fifo.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  FIFO depth profiler for chains of top functions (enabled with HVX_SIM_PROFILE). The chain is executed once layer by layer in the
+ *  C-simulation to capture the read/write condition of every iteration of the top loops. Afterwards the DATAFLOW execution is simulated
+ *  cycle by cycle (one iteration per cycle, a layer stalls on an empty input or a full output FIFO) to find the minimal stall-free depth
+ *  of every connection (the value for HVX_BUFFER/StreamFifo) and the cycles lost with smaller depths. Not available during synthesis.
+ */
+
+#ifndef HVX_SIM_FIFO_H_
+#define HVX_SIM_FIFO_H_
+
+#include "hvx_sim_profile.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE) && defined(HVX_SIM_PROFILE)
+#include <deque>
+#include <limits>
+
+namespace hvx {
+namespace sim {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Cycles of the whole chain if one FIFO has a smaller depth than its minimal stall-free depth
+ */
+struct FifoDepthPoint {
+    int64_t depth  = 0; // NOLINT
+    int64_t cycles = 0; // NOLINT -1 if the chain deadlocks
+    double loss    = 0; // NOLINT lost throughput compared to the stall-free depth (0.25 = 25% more cycles)
+};
+
+/*!
+ * @brief Result of one connection between two consecutive layers of a chain
+ */
+struct FifoConnection {
+    std::string producer;                       // NOLINT
+    std::string consumer;                       // NOLINT
+    int64_t beats         = 0;                  // NOLINT vectors written by the producer
+    int64_t consumed      = 0;                  // NOLINT vectors read by the consumer
+    int64_t max_occupancy = 0;                  // NOLINT occupancy with an unbounded FIFO
+    int64_t depth         = 0;                  // NOLINT minimal stall-free depth
+    std::vector<hvx::sim::FifoDepthPoint> less; // NOLINT depths 1, 2, 4, ... and depth - 1
+    std::string error;                          // NOLINT empty if producer and consumer transfer the same number of vectors
+};
+
+/*!
+ * @brief Captures the stream schedules of a chain of layers and computes the FIFO depths of a DATAFLOW region
+ */
+class FifoProfiler {
+public:
+    /*!
+     * @brief executes the chain (e.g. a lambda that calls the top functions layer by layer on tensors in memory) and captures the read
+     * and write conditions of every layer. The dst port of a layer is connected to the src port of the next layer.
+     */
+    template<typename func_>
+    auto Run(func_&& func) -> void {
+        traces_.clear();
+        auto* prev                        = hvx::sim::ProfileScope::Capture();
+        hvx::sim::ProfileScope::Capture() = &traces_;
+        func();
+        hvx::sim::ProfileScope::Capture() = prev;
+        pipeline_.assign(traces_.size(), 0);
+    }
+
+    /*!
+     * @brief sets the number of cycles between an iteration of a layer and its write being visible to the next layer (default 0, e.g.
+     * hvx::perf_model<param>::depth)
+     */
+    auto SetPipelineDepth(size_t layer, int64_t depth) -> void {
+        pipeline_.at(layer) = depth;
+    }
+
+    /*!
+     * @brief the captured layers (in the order they finished)
+     */
+    auto Layers() const noexcept -> const std::vector<hvx::sim::ProfileTrace>& {
+        return traces_;
+    }
+
+    /*!
+     * @brief simulates the DATAFLOW execution with the given FIFO depths and returns the cycles (-1 on deadlock)
+     */
+    auto Cycles(const std::vector<int64_t>& depths) const -> int64_t {
+        std::vector<int64_t> occupancy;
+        return Simulate(Stages(), depths, occupancy);
+    }
+
+    /*!
+     * @brief cycles of the chain with unbounded FIFOs (available after Analyze)
+     */
+    auto IdealCycles() const noexcept -> int64_t {
+        return ideal_cycles_;
+    }
+
+    /*!
+     * @brief computes the minimal stall-free depth of every connection and the throughput lost with smaller depths (the error of a
+     * connection is set if its producer and consumer transfer a different number of vectors)
+     */
+    auto Analyze() -> std::vector<hvx::sim::FifoConnection> {
+        const auto stages = Stages();
+        const auto fifos  = (stages.size() > 1) ? (stages.size() - 1) : 0;
+
+        // an unbounded FIFO never stalls, its maximum occupancy is a stall-free depth
+        std::vector<int64_t> occupancy;
+        std::vector<int64_t> depths(fifos, std::numeric_limits<int64_t>::max());
+        ideal_cycles_ = Simulate(stages, depths, occupancy);
+        for (size_t i = 0; i < fifos; ++i)
+            depths[i] = std::max<int64_t>(occupancy[i], 1);
+        const auto max_occupancy = occupancy;
+
+        // shrink the FIFOs one after another (binary search for the smallest depth that keeps the ideal cycles)
+        for (size_t i = 0; i < fifos; ++i) {
+            int64_t low = 1, high = depths[i];
+            while (low < high) {
+                const int64_t mid = low + (high - low) / 2;
+                depths[i]         = mid;
+                if (Simulate(stages, depths, occupancy) == ideal_cycles_)
+                    high = mid;
+                else
+                    low = mid + 1;
+            }
+            depths[i] = high;
+        }
+
+        // cycles with smaller depths (all other FIFOs at their minimal depth)
+        connections_.clear();
+        for (size_t i = 0; i < fifos; ++i) {
+            hvx::sim::FifoConnection con;
+            con.producer      = traces_.at(i).name;
+            con.consumer      = traces_.at(i + 1).name;
+            con.beats         = std::count(stages[i].out.begin(), stages[i].out.end(), true);
+            con.consumed      = std::count(stages[i + 1].in.begin(), stages[i + 1].in.end(), true);
+            if (con.beats != con.consumed) {
+                con.error = "producer writes " + std::to_string(con.beats) + " vectors, consumer reads " + std::to_string(con.consumed) +
+                            " vectors (the depths are not valid)";
+            }
+            con.max_occupancy = max_occupancy[i];
+            con.depth         = depths[i];
+            std::vector<int64_t> less;
+            for (int64_t depth = 1; depth < (con.depth - 1); depth *= 2)
+                less.push_back(depth);
+            if (con.depth > 1)
+                less.push_back(con.depth - 1);
+            for (const auto depth : less) {
+                depths[i]         = depth;
+                const auto cycles = Simulate(stages, depths, occupancy);
+                con.less.push_back({depth, cycles, (cycles < 0) ? -1.0 : (static_cast<double>(cycles) / ideal_cycles_ - 1.0)});
+            }
+            depths[i] = con.depth;
+            connections_.push_back(con);
+        }
+        return connections_;
+    }
+
+    /*!
+     * @brief prints one row per connection (call Analyze first)
+     */
+    auto Report(std::ostream& out = std::cout) const -> void {
+        out << "  ideal: " << ideal_cycles_ << " cycles\n";
+        out << "  " << std::left << std::setw(6) << "fifo" << std::setw(34) << "producer -> consumer" << std::right << std::setw(10) << "beats"
+            << std::setw(10) << "max_occ" << std::setw(8) << "depth" << "  loss with smaller depths\n";
+        for (size_t i = 0; i < connections_.size(); ++i) {
+            const auto& con = connections_.at(i);
+            out << "  " << std::left << std::setw(6) << i << std::setw(34) << (con.producer + " -> " + con.consumer) << std::right
+                << std::setw(10) << con.beats << std::setw(10) << con.max_occupancy << std::setw(8) << con.depth << " ";
+            for (const auto& point : con.less) {
+                out << " " << point.depth << ":";
+                if (point.cycles < 0)
+                    out << "deadlock";
+                else
+                    out << std::fixed << std::setprecision(1) << 100.0 * point.loss << "%";
+            }
+            out << "\n";
+            if (!con.error.empty())
+                out << "  " << std::left << std::setw(6) << "" << "ERROR: " << con.error << std::right << "\n";
+        }
+    }
+
+    /*!
+     * @brief writes the connections as JSON (call Analyze first)
+     */
+    auto WriteJson(const std::string& path) const -> bool {
+        std::ofstream file(path);
+        if (!file.is_open())
+            return false;
+        file << "{\"ideal_cycles\": " << ideal_cycles_ << ", \"fifos\": [" << std::setprecision(10);
+        for (size_t i = 0; i < connections_.size(); ++i) {
+            const auto& con = connections_.at(i);
+            file << ((i == 0) ? "\n" : ",\n") << "  {\"producer\": \"" << ProfileJsonEscape(con.producer) << "\", \"consumer\": \""
+                 << ProfileJsonEscape(con.consumer) << "\", \"beats\": " << con.beats << ", \"max_occupancy\": " << con.max_occupancy
+                 << ", \"depth\": " << con.depth << ", \"consumed\": " << con.consumed << ", \"error\": \"" << ProfileJsonEscape(con.error)
+                 << "\", \"less\": [";
+            for (size_t j = 0; j < con.less.size(); ++j) {
+                const auto& point = con.less.at(j);
+                file << ((j == 0) ? "" : ", ") << "{\"depth\": " << point.depth << ", \"cycles\": " << point.cycles
+                     << ", \"loss\": " << point.loss << "}";
+            }
+            file << "]}";
+        }
+        file << (connections_.empty() ? "]}\n" : "\n]}\n");
+        return true;
+    }
+
+private:
+    /*!
+     * @brief schedule of one layer: condition of its src (of the previous FIFO) and dst port (of the next FIFO) per iteration
+     */
+    struct Stage {
+        std::vector<bool> in;
+        std::vector<bool> out;
+        int64_t iters    = 0;
+        int64_t pipeline = 0;
+    };
+
+    /*!
+     * @brief the conditions of the first read and the first write port of every layer
+     */
+    auto Stages() const -> std::vector<Stage> {
+        std::vector<Stage> stages(traces_.size());
+        for (size_t i = 0; i < traces_.size(); ++i) {
+            const auto& trace = traces_.at(i);
+            auto& stage       = stages.at(i);
+            stage.pipeline    = pipeline_.at(i);
+            for (size_t j = trace.ports.size(); j > 0; --j) { // backwards, so the first read/write port is taken
+                auto& conds = trace.ports.at(j - 1).is_read ? stage.in : stage.out;
+                conds       = trace.conds.at(j - 1);
+            }
+            stage.iters = static_cast<int64_t>(std::max(stage.in.size(), stage.out.size()));
+        }
+        return stages;
+    }
+
+    /*!
+     * @brief cycle by cycle simulation of the chain (the first layer never waits for input, the last layer never waits for output)
+     */
+    static auto Simulate(const std::vector<Stage>& stages, const std::vector<int64_t>& depths, std::vector<int64_t>& occupancy)
+        -> int64_t {
+        const auto num = stages.size();
+        std::vector<int64_t> iter(num, 0);
+        std::vector<bool> fire(num, false);
+        std::vector<std::deque<int64_t>> fifos((num > 1) ? (num - 1) : 0); // cycle from which on a vector is visible to the consumer
+        occupancy.assign(fifos.size(), 0);
+
+        for (int64_t cycle = 0;; ++cycle) {
+            // all layers decide on the state at the beginning of the cycle
+            bool done = true;
+            for (size_t i = 0; i < num; ++i) {
+                const auto& stage = stages[i];
+                const auto it     = static_cast<size_t>(iter[i]);
+                fire[i]           = false;
+                if (iter[i] >= stage.iters)
+                    continue;
+                done                = false;
+                const bool need_in  = (i > 0) && (it < stage.in.size()) && stage.in[it];
+                const bool need_out = ((i + 1) < num) && (it < stage.out.size()) && stage.out[it];
+                const bool ok_in    = !need_in || (!fifos[i - 1].empty() && (fifos[i - 1].front() <= cycle));
+                const bool ok_out   = !need_out || (static_cast<int64_t>(fifos[i].size()) < depths[i]);
+                fire[i]             = ok_in && ok_out;
+            }
+            if (done)
+                return cycle;
+
+            // execute one iteration of every layer that is not stalled
+            bool any = false;
+            for (size_t i = 0; i < num; ++i) {
+                if (!fire[i])
+                    continue;
+                const auto& stage = stages[i];
+                const auto it     = static_cast<size_t>(iter[i]);
+                if ((i > 0) && (it < stage.in.size()) && stage.in[it])
+                    fifos[i - 1].pop_front();
+                if (((i + 1) < num) && (it < stage.out.size()) && stage.out[it]) {
+                    fifos[i].push_back(cycle + 1 + stage.pipeline);
+                    occupancy[i] = std::max<int64_t>(occupancy[i], static_cast<int64_t>(fifos[i].size()));
+                }
+                ++iter[i];
+                any = true;
+            }
+
+            // nothing was executed and nothing is in flight
+            if (!any) {
+                bool pending = false;
+                for (const auto& fifo : fifos)
+                    pending |= (!fifo.empty() && (fifo.front() > cycle));
+                if (!pending)
+                    return -1;
+            }
+        }
+    }
+
+    std::vector<hvx::sim::ProfileTrace> traces_;
+    std::vector<int64_t> pipeline_;
+    std::vector<hvx::sim::FifoConnection> connections_;
+    int64_t ideal_cycles_ = 0;
+};
+
+/******************************************************************************************************************************************/
+} // namespace sim
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE && HVX_SIM_PROFILE
+#endif // HVX_SIM_FIFO_H_
@@ -0,0 +1,141 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sim_parallel.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Batch and row band parallel C-simulation of the conv and dense layers. Every sample (or band of dst rows of a sample) is computed by
+ *  the unmodified top function with its own layer state, so the results are bit exact with the serial execution. Not available during
+ *  synthesis.
+ */
+
+#ifndef HVX_SIM_PARALLEL_H_
+#define HVX_SIM_PARALLEL_H_
+
+#include "../nn/hvx_nn_conv.h"
+#include "../nn/hvx_nn_dense.h"
+#include "hvx_sim_thread_pool.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <vector>
+
+namespace hvx {
+namespace sim {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Convolution layer, computed in parallel over the batch and over "row_bands_" bands of dst rows per sample
+ */
+template<typename param_, bool with_bias_ = false, int64_t row_bands_ = 1>
+auto
+ParallelConv(typename param_::src_port* src,
+             typename param_::wgts_vec* wgts,
+             typename param_::bias_vec* bias,
+             typename param_::dst_port* dst,
+             hvx::sim::ThreadPool& pool = hvx::sim::ThreadPool::Global()) -> void {
+    static_assert(row_bands_ >= 1, "At least one row band is needed!");
+    static_assert((param_::dst_rows % row_bands_) == 0, "The dst rows need to be divisible by the number of row bands!");
+    static_assert((row_bands_ == 1) || ((param_::src_row_vec_size == 1) && (param_::src_col_vec_size == 1)),
+                  "Row bands need a row/col vector size of 1!");
+
+    // vectors of a sample and of a row of a sample
+    constexpr int64_t src_row_elms    = param_::src_cols * param_::chnl_vec_elms;
+    constexpr int64_t dst_row_elms    = param_::dst_cols * param_::fm_vec_elms;
+    constexpr int64_t src_sample_elms = param_::src_dim::vec_elms / param_::batch;
+    constexpr int64_t dst_sample_elms = param_::dst_dim::vec_elms / param_::batch;
+
+    // a whole sample is computed directly on the input tensor
+    if (row_bands_ == 1) {
+        using sample = typename param_::sample_param;
+        pool.ParallelFor(param_::batch, [&](int64_t b) {
+            hvx::nn::ConvState<sample> state;
+            hvx::nn::ConvTop<sample, with_bias_>(state, src + b * src_sample_elms, wgts, bias, dst + b * dst_sample_elms);
+        });
+        return;
+    }
+
+    // a band is computed on a copy of its src rows including halo and padding rows (padded with the src zero point, like in ConvTop)
+    constexpr int64_t band_dst_rows = param_::dst_rows / row_bands_;
+    using band                      = typename param_::template band_param<band_dst_rows>;
+    typename param_::src_port src_pad{};
+    for (int64_t i = 0; i < param_::src_dim::vec_size; ++i)
+        src_pad.data[i].data = static_cast<typename param_::src_type::data_type>(param_::src_zero); // NOLINT
+    pool.ParallelFor(param_::batch * row_bands_, [&](int64_t task) {
+        const int64_t b        = task / row_bands_;
+        const int64_t band_idx = task % row_bands_;
+        const int64_t row_beg  = band_idx * band_dst_rows * param_::str_rows - param_::pad_rows;
+
+        // copy the src rows of the band
+        std::vector<typename param_::src_port> band_src(static_cast<std::size_t>(band::src_rows * src_row_elms), src_pad);
+        for (int64_t row = 0; row < band::src_rows; ++row) {
+            const int64_t src_row = row_beg + row;
+            if ((src_row < 0) || (src_row >= param_::src_rows))
+                continue;
+            const auto* row_ptr = src + b * src_sample_elms + src_row * src_row_elms;
+            std::copy(row_ptr, row_ptr + src_row_elms, band_src.begin() + row * src_row_elms);
+        }
+
+        // compute the band
+        hvx::nn::ConvState<band> state;
+        auto* band_dst = dst + b * dst_sample_elms + band_idx * band_dst_rows * dst_row_elms;
+        hvx::nn::ConvTop<band, with_bias_>(state, band_src.data(), wgts, bias, band_dst);
+    });
+}
+
+/*!
+ * @brief Convolution layer (without bias), computed in parallel over the batch and over "row_bands_" bands of dst rows per sample
+ */
+template<typename param_, int64_t row_bands_ = 1>
+auto
+ParallelConv(typename param_::src_port* src,
+             typename param_::wgts_vec* wgts,
+             typename param_::dst_port* dst,
+             hvx::sim::ThreadPool& pool = hvx::sim::ThreadPool::Global()) -> void {
+    hvx::sim::ParallelConv<param_, false, row_bands_>(src, wgts, nullptr, dst, pool);
+}
+
+/*!
+ * @brief Dense layer, computed in parallel over the batch
+ */
+template<typename param_>
+auto
+ParallelDense(typename param_::src_port* src,
+              typename param_::wgts_vec* wgts,
+              typename param_::bias_vec* bias,
+              typename param_::dst_port* dst,
+              hvx::sim::ThreadPool& pool = hvx::sim::ThreadPool::Global()) -> void {
+    hvx::sim::ParallelConv<typename param_::conv_param, true>(src, wgts, bias, dst, pool);
+}
+
+/*!
+ * @brief Dense layer (without bias), computed in parallel over the batch
+ */
+template<typename param_>
+auto
+ParallelDense(typename param_::src_port* src,
+              typename param_::wgts_vec* wgts,
+              typename param_::dst_port* dst,
+              hvx::sim::ThreadPool& pool = hvx::sim::ThreadPool::Global()) -> void {
+    hvx::sim::ParallelConv<typename param_::conv_param, false>(src, wgts, nullptr, dst, pool);
+}
+
+/******************************************************************************************************************************************/
+} // namespace sim
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE
+#endif // HVX_SIM_PARALLEL_H_
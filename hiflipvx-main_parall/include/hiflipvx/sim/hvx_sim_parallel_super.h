@@ -0,0 +1,67 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sim_parallel_super.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Batch parallel C-simulation of the super layer (nn/hvx_nn_super.h). Every batch vector is computed by the unmodified top function with
+ *  its own layer state, so the results are bit exact with the serial execution. Not available during synthesis.
+ */
+
+#ifndef HVX_SIM_PARALLEL_SUPER_H_
+#define HVX_SIM_PARALLEL_SUPER_H_
+
+#include "../nn/hvx_nn_super.h"
+#include "hvx_sim_thread_pool.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+
+namespace hvx {
+namespace sim {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Super layer, computed in parallel over the batch vectors
+ */
+template<typename param_, bool with_bias_, hvx::util::pooling_e pool_type_, hvx::util::layer_e layer_type_>
+auto
+ParallelSuper(typename param_::src_port* src1,
+              typename param_::src2_port* src2,
+              typename param_::wgts_vec* wgts,
+              typename param_::bias_vec* bias,
+              typename param_::dst_port* dst1,
+              typename param_::dst2_port* dst2,
+              hvx::sim::ThreadPool& pool = hvx::sim::ThreadPool::Global()) -> void {
+    using sample = typename param_::sample_param;
+
+    // elements of a batch vector
+    constexpr int64_t src_sample_elms = param_::src_dim::vec_elms / param_::batch_vec_elms;
+    constexpr int64_t dst_sample_elms = param_::dst_dim::vec_elms / param_::batch_vec_elms;
+
+    pool.ParallelFor(param_::batch_vec_elms, [&](int64_t b) {
+        hvx::nn::SuperState<sample> state;
+        hvx::nn::SuperTop<sample, with_bias_, pool_type_, layer_type_>(state, src1 + b * src_sample_elms, src2 + b * src_sample_elms, wgts,
+                                                                       bias, dst1 + b * dst_sample_elms, dst2 + b * dst_sample_elms);
+    });
+}
+
+/******************************************************************************************************************************************/
+} // namespace sim
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE
+#endif // HVX_SIM_PARALLEL_SUPER_H_
@@ -0,0 +1,375 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sim_profile.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Stream instrumentation of the C-simulation (enabled with HVX_SIM_PROFILE). Every top function opens a profile scope with
+ *  HVX_SIM_PROFILE_TOP(), every StreamReadData/StreamWriteData call is recorded as one iteration of its port (beat if the condition is
+ *  met, idle otherwise) and the time a channel blocks is recorded as stall. The results are accumulated per layer and can be printed or
+ *  exported as JSON. Not available during synthesis.
+ */
+
+#ifndef HVX_SIM_PROFILE_H_
+#define HVX_SIM_PROFILE_H_
+
+#include "../util/hvx_util_macro.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE) && defined(HVX_SIM_PROFILE)
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace hvx {
+namespace sim {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Statistics of one stream port of a layer (iterations are the StreamReadData/StreamWriteData calls of that port)
+ */
+struct ProfilePort {
+    bool is_read     = true;    // NOLINT
+    int64_t calls    = 0;       // NOLINT iterations in which the port was visited
+    int64_t beats    = 0;       // NOLINT iterations in which a vector was transferred
+    int64_t first    = -1;      // NOLINT first iteration with a transfer
+    int64_t last     = -1;      // NOLINT last iteration with a transfer
+    double stall_ns  = 0;       // NOLINT time blocked on a full/empty channel
+    const void* port = nullptr; // NOLINT
+
+    /*!
+     * @brief iterations without a transfer
+     */
+    auto Idle() const noexcept -> int64_t {
+        return calls - beats;
+    }
+
+    /*!
+     * @brief accumulates the statistics of the same port of another call of the layer
+     */
+    auto Merge(const ProfilePort& other) noexcept -> void {
+        if (other.first >= 0)
+            first = (first < 0) ? other.first : std::min(first, other.first);
+        last = std::max(last, other.last);
+        calls += other.calls;
+        beats += other.beats;
+        stall_ns += other.stall_ns;
+    }
+};
+
+/*!
+ * @brief Accumulated statistics of all calls of one layer
+ */
+struct ProfileLayer {
+    std::string name;                         // NOLINT path of the layer (nested scopes are separated by "/")
+    std::string signature;                    // NOLINT
+    int64_t calls   = 0;                      // NOLINT
+    double total_ns = 0;                      // NOLINT
+    double min_ns   = 0;                      // NOLINT
+    double max_ns   = 0;                      // NOLINT
+    std::vector<hvx::sim::ProfilePort> ports; // NOLINT in order of the first access (reads and writes interleaved)
+};
+
+/*!
+ * @brief Condition of every iteration of every port of one call of a layer (captured by the FIFO profiler)
+ */
+struct ProfileTrace {
+    std::string name;                         // NOLINT
+    std::string signature;                    // NOLINT
+    std::vector<hvx::sim::ProfilePort> ports; // NOLINT
+    std::vector<std::vector<bool>> conds;     // NOLINT one entry per port and iteration
+};
+
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Collects the layers of all threads
+ */
+class ProfileRegistry {
+public:
+    static auto Global() -> ProfileRegistry& {
+        static ProfileRegistry registry;
+        return registry;
+    }
+
+    auto Add(const std::string& name, const std::string& signature, double time_ns, const std::vector<hvx::sim::ProfilePort>& ports)
+        -> void {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(name + "\n" + signature);
+        if (it == index_.end()) {
+            it = index_.emplace(name + "\n" + signature, layers_.size()).first;
+            hvx::sim::ProfileLayer layer;
+            layer.name      = name;
+            layer.signature = signature;
+            layer.min_ns    = time_ns;
+            layers_.push_back(layer);
+        }
+        auto& layer = layers_.at(it->second);
+        layer.calls += 1;
+        layer.total_ns += time_ns;
+        layer.min_ns = std::min(layer.min_ns, time_ns);
+        layer.max_ns = std::max(layer.max_ns, time_ns);
+        for (size_t i = 0; i < ports.size(); ++i) {
+            if (i < layer.ports.size())
+                layer.ports.at(i).Merge(ports.at(i));
+            else
+                layer.ports.push_back(ports.at(i));
+        }
+    }
+
+    auto Layers() -> std::vector<hvx::sim::ProfileLayer> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return layers_;
+    }
+
+    auto Reset() -> void {
+        std::lock_guard<std::mutex> lock(mutex_);
+        layers_.clear();
+        index_.clear();
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<hvx::sim::ProfileLayer> layers_;
+    std::map<std::string, size_t> index_;
+};
+
+/******************************************************************************************************************************************/
+} // namespace impl
+
+/*!
+ * @brief RAII profile scope of one call of a layer. Scopes nest per thread, stream accesses are recorded in the innermost scope.
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name, const char* signature = "")
+        : parent_(Current()), signature_(signature), start_(std::chrono::steady_clock::now()) {
+        name_     = (parent_ != nullptr) ? (parent_->name_ + "/" + name) : std::string(name);
+        Current() = this;
+    }
+
+    ProfileScope(const ProfileScope&)                    = delete;
+    auto operator=(const ProfileScope&) -> ProfileScope& = delete;
+
+    ~ProfileScope() {
+        const auto stop = std::chrono::steady_clock::now();
+        Current()       = parent_;
+        hvx::sim::impl::ProfileRegistry::Global().Add(name_, signature_,
+                                                      std::chrono::duration<double, std::nano>(stop - start_).count(), ports_);
+        if ((Capture() != nullptr) && !ports_.empty())
+            Capture()->push_back({name_, signature_, ports_, conds_});
+    }
+
+    /*!
+     * @brief the innermost scope of the calling thread (nullptr outside of a top function)
+     */
+    static auto Current() noexcept -> ProfileScope*& {
+        thread_local ProfileScope* scope = nullptr;
+        return scope;
+    }
+
+    /*!
+     * @brief if set, the conditions of all iterations are captured and every scope with stream ports appends its trace
+     */
+    static auto Capture() noexcept -> std::vector<hvx::sim::ProfileTrace>*& {
+        thread_local std::vector<hvx::sim::ProfileTrace>* traces = nullptr;
+        return traces;
+    }
+
+    /*!
+     * @brief records one iteration of a port, identified by the address of its read/write pointer
+     */
+    auto Record(const void* key, const void* port, bool is_read, bool cond) -> void {
+        const auto idx = Port(key, port, is_read);
+        auto& stats    = ports_[idx];
+        if (Capture() != nullptr)
+            conds_[idx].push_back(cond);
+        if (cond) {
+            if (stats.first < 0)
+                stats.first = stats.calls;
+            stats.last = stats.calls;
+            ++stats.beats;
+        }
+        ++stats.calls;
+    }
+
+    /*!
+     * @brief records the time a channel blocked (the port is identified by the channel address)
+     */
+    auto Stall(const void* port, bool is_read, double time_ns) -> void {
+        for (auto& stats : ports_) {
+            if ((stats.port == port) && (stats.is_read == is_read)) {
+                stats.stall_ns += time_ns;
+                return;
+            }
+        }
+    }
+
+private:
+    auto Port(const void* key, const void* port, bool is_read) -> size_t {
+        if ((last_ < keys_.size()) && (keys_[last_] == key))
+            return last_;
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            if (keys_[i] == key) {
+                last_ = i;
+                return i;
+            }
+        }
+        hvx::sim::ProfilePort stats;
+        stats.is_read = is_read;
+        stats.port    = port;
+        keys_.push_back(key);
+        ports_.push_back(stats);
+        conds_.emplace_back();
+        last_ = ports_.size() - 1;
+        return last_;
+    }
+
+    ProfileScope* parent_;
+    std::string name_;
+    std::string signature_;
+    std::chrono::steady_clock::time_point start_;
+    std::vector<const void*> keys_;
+    std::vector<hvx::sim::ProfilePort> ports_;
+    std::vector<std::vector<bool>> conds_;
+    size_t last_ = 0;
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief records one StreamReadData/StreamWriteData call (ignored outside of a profile scope)
+ */
+HVX_FORCE_INLINE auto
+ProfileStream(const void* key, const void* port, bool is_read, bool cond) -> void {
+    auto* scope = hvx::sim::ProfileScope::Current();
+    if (scope != nullptr)
+        scope->Record(key, port, is_read, cond);
+}
+
+/*!
+ * @brief records the time a channel read/write was blocked (ignored outside of a profile scope)
+ */
+HVX_FORCE_INLINE auto
+ProfileStall(const void* port, bool is_read, std::chrono::steady_clock::time_point start) -> void {
+    auto* scope = hvx::sim::ProfileScope::Current();
+    if (scope != nullptr)
+        scope->Stall(port, is_read, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+}
+
+/*!
+ * @brief returns the accumulated statistics of all layers (in order of their first call)
+ */
+inline auto
+ProfileLayers() -> std::vector<hvx::sim::ProfileLayer> {
+    return hvx::sim::impl::ProfileRegistry::Global().Layers();
+}
+
+/*!
+ * @brief clears all accumulated statistics
+ */
+inline auto
+ProfileReset() -> void {
+    hvx::sim::impl::ProfileRegistry::Global().Reset();
+}
+
+/*!
+ * @brief prints a table with one row per port of each layer
+ */
+inline auto
+ProfileReport(std::ostream& out = std::cout) -> void {
+    out << std::left << std::setw(40) << "layer" << std::setw(6) << "port" << std::right << std::setw(8) << "calls" << std::setw(12)
+        << "time(us)" << std::setw(12) << "iters" << std::setw(12) << "beats" << std::setw(12) << "idle" << std::setw(10) << "first"
+        << std::setw(12) << "last" << std::setw(12) << "stall(us)" << "\n";
+    for (const auto& layer : ProfileLayers()) {
+        int64_t src = 0, dst = 0;
+        for (const auto& port : layer.ports) {
+            const auto port_name = port.is_read ? ("src" + std::to_string(src++)) : ("dst" + std::to_string(dst++));
+            out << std::left << std::setw(40) << layer.name << std::setw(6) << port_name << std::right << std::setw(8) << layer.calls
+                << std::fixed << std::setprecision(2) << std::setw(12) << layer.total_ns * 1e-3 << std::setw(12) << port.calls
+                << std::setw(12) << port.beats << std::setw(12) << port.Idle() << std::setw(10) << port.first << std::setw(12)
+                << port.last << std::setw(12) << port.stall_ns * 1e-3 << "\n";
+        }
+    }
+}
+
+/*!
+ * @brief escapes the characters of a string that are not allowed in a JSON string (quotes, backslashes and control characters)
+ */
+inline auto
+ProfileJsonEscape(const std::string& str) -> std::string {
+    std::ostringstream res;
+    for (const auto c : str) {
+        if ((c == '"') || (c == '\\'))
+            res << '\\' << c;
+        else if (c == '\n')
+            res << "\\n";
+        else if (c == '\r')
+            res << "\\r";
+        else if (c == '\t')
+            res << "\\t";
+        else if (static_cast<unsigned char>(c) < 0x20)
+            res << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+        else
+            res << c;
+    }
+    return res.str();
+}
+
+/*!
+ * @brief writes the statistics as JSON (array with one object per layer)
+ */
+inline auto
+ProfileWriteJson(const std::string& path) -> bool {
+    std::ofstream file(path);
+    if (!file.is_open())
+        return false;
+    const auto layers = ProfileLayers();
+    file << "[\n" << std::setprecision(10);
+    for (size_t i = 0; i < layers.size(); ++i) {
+        const auto& layer = layers.at(i);
+        file << "  {\"layer\": \"" << ProfileJsonEscape(layer.name) << "\", \"signature\": \"" << ProfileJsonEscape(layer.signature)
+             << "\", \"calls\": " << layer.calls << ", \"total_ns\": " << layer.total_ns << ", \"min_ns\": " << layer.min_ns
+             << ", \"max_ns\": " << layer.max_ns << ", \"ports\": [";
+        int64_t src = 0, dst = 0;
+        for (size_t j = 0; j < layer.ports.size(); ++j) {
+            const auto& port = layer.ports.at(j);
+            file << ((j == 0) ? "\n" : ",\n") << "    {\"port\": \""
+                 << (port.is_read ? ("src" + std::to_string(src++)) : ("dst" + std::to_string(dst++))) << "\", \"iters\": " << port.calls
+                 << ", \"beats\": " << port.beats << ", \"idle\": " << port.Idle() << ", \"first\": " << port.first
+                 << ", \"last\": " << port.last << ", \"stall_ns\": " << port.stall_ns << "}";
+        }
+        file << (layer.ports.empty() ? "]}" : "\n  ]}") << ((i + 1 < layers.size()) ? ",\n" : "\n");
+    }
+    file << "]\n";
+    return true;
+}
+
+/******************************************************************************************************************************************/
+} // namespace sim
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE && HVX_SIM_PROFILE
+#endif // HVX_SIM_PROFILE_H_
@@ -0,0 +1,358 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sim_stream.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Bounded single-producer/single-consumer stream channels for the C-simulation. A channel provides a port address that can be passed to
+ *  any top function instead of a tensor. StreamReadData/StreamWriteData detect the address and block on the channel instead of indexing
+ *  memory. The ports are resolved once per top function call (HVX_SIM_STREAM_TOP). Not available during synthesis.
+ */
+
+#ifndef HVX_SIM_STREAM_H_
+#define HVX_SIM_STREAM_H_
+
+#include "hvx_sim_profile.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// cache line size used to separate the producer and consumer indices of a channel
+#ifndef HVX_SIM_CACHE_LINE
+#define HVX_SIM_CACHE_LINE 64
+#endif
+
+// number of polls of an empty/full channel before the waiting thread yields its time slice
+#ifndef HVX_SIM_SPIN_COUNT
+#define HVX_SIM_SPIN_COUNT 64
+#endif
+
+namespace hvx {
+namespace sim {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Type erased base of all channels, used to find the channel that belongs to a port address
+ */
+class ChannelBase {
+public:
+    ChannelBase() noexcept                             = default;
+    ChannelBase(const ChannelBase&)                    = delete;
+    auto operator=(const ChannelBase&) -> ChannelBase& = delete;
+    virtual ~ChannelBase() noexcept                    = default;
+};
+
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Maps port addresses to channels. Lookups are cached per thread and invalidated whenever a channel is (un)registered.
+ */
+class ChannelRegistry {
+public:
+    /*!
+     * @brief the registry shared by all channels
+     */
+    static auto Global() noexcept -> ChannelRegistry& {
+        static ChannelRegistry registry;
+        return registry;
+    }
+
+    /*!
+     * @brief true if at least one channel exists (keeps the lookup out of the path when no channel is used)
+     */
+    HVX_FORCE_INLINE auto Active() const noexcept -> bool {
+        return active_.load(std::memory_order_relaxed) != 0;
+    }
+
+    auto Register(const void* port, ChannelBase* channel) -> void {
+        std::lock_guard<std::mutex> lock(mutex_);
+        map_[port] = channel;
+        active_.fetch_add(1, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+
+    auto Unregister(const void* port) noexcept -> void {
+        std::lock_guard<std::mutex> lock(mutex_);
+        map_.erase(port);
+        active_.fetch_sub(1, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+
+    /*!
+     * @brief returns the channel registered for a port address or nullptr
+     */
+    auto Lookup(const void* port) -> ChannelBase* {
+        struct Cache {
+            uint64_t generation = 0;
+            std::vector<std::pair<const void*, ChannelBase*>> entries;
+        };
+        thread_local Cache cache;
+
+        // a (un)registration happened since the last lookup of this thread
+        const uint64_t generation = generation_.load(std::memory_order_acquire);
+        if (cache.generation != generation) {
+            cache.entries.clear();
+            cache.generation = generation;
+        }
+        for (const auto& entry : cache.entries) {
+            if (entry.first == port)
+                return entry.second;
+        }
+
+        // slow path (also caches addresses that are no channel)
+        ChannelBase* channel = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = map_.find(port);
+            if (it != map_.end())
+                channel = it->second;
+        }
+        if (cache.entries.size() >= cache_size)
+            cache.entries.clear();
+        cache.entries.emplace_back(port, channel);
+        return channel;
+    }
+
+private:
+    static constexpr std::size_t cache_size = 16;
+
+    std::mutex mutex_;
+    std::unordered_map<const void*, ChannelBase*> map_;
+    std::atomic<int64_t> active_{0};
+    std::atomic<uint64_t> generation_{1};
+};
+
+/******************************************************************************************************************************************/
+} // namespace impl
+
+/*!
+ * @brief Bounded lock-free single-producer/single-consumer FIFO with blocking read and write (emulates an HLS stream)
+ */
+template<typename type_>
+class Channel : public ChannelBase {
+public:
+    /*!
+     * @brief creates a channel that holds up to "depth" elements
+     */
+    explicit Channel(int64_t depth = 2)
+        : depth_(depth < 1 ? 1 : static_cast<std::size_t>(depth)), buf_(depth_ + 1) {
+        hvx::sim::impl::ChannelRegistry::Global().Register(Port(), this);
+    }
+
+    ~Channel() noexcept override {
+        hvx::sim::impl::ChannelRegistry::Global().Unregister(Port());
+    }
+
+    /*!
+     * @brief the address to pass to a top function instead of a tensor (never dereferenced)
+     */
+    HVX_FORCE_INLINE auto Port() noexcept -> type_* {
+        return &port_;
+    }
+
+    /*!
+     * @brief the maximum number of elements the channel holds
+     */
+    HVX_FORCE_INLINE auto Depth() const noexcept -> int64_t {
+        return static_cast<int64_t>(depth_);
+    }
+
+    /*!
+     * @brief number of elements currently in the channel (exact only if producer and consumer are idle)
+     */
+    HVX_FORCE_INLINE auto Size() const noexcept -> int64_t {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        return static_cast<int64_t>((tail + buf_.size() - head) % buf_.size());
+    }
+
+    /*!
+     * @brief tries to write an element, returns false if the channel is full
+     */
+    HVX_FORCE_INLINE auto TryWrite(const type_& data) -> bool {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t next = Next(tail);
+        if (next == head_.load(std::memory_order_acquire))
+            return false;
+        buf_[tail] = data;
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * @brief tries to read an element, returns false if the channel is empty
+     */
+    HVX_FORCE_INLINE auto TryRead(type_& data) -> bool {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+            return false;
+        data = buf_[head];
+        head_.store(Next(head), std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * @brief writes an element, blocks while the channel is full
+     */
+    auto Write(const type_& data) -> void {
+#if defined(HVX_SIM_PROFILE)
+        if (TryWrite(data))
+            return;
+        const auto start = std::chrono::steady_clock::now();
+#endif
+        for (int64_t spin = 0; !TryWrite(data); ++spin) {
+            if (spin >= HVX_SIM_SPIN_COUNT)
+                std::this_thread::yield();
+        }
+#if defined(HVX_SIM_PROFILE)
+        hvx::sim::ProfileStall(Port(), false, start);
+#endif
+    }
+
+    /*!
+     * @brief reads an element, blocks while the channel is empty
+     */
+    auto Read(type_& data) -> void {
+#if defined(HVX_SIM_PROFILE)
+        if (TryRead(data))
+            return;
+        const auto start = std::chrono::steady_clock::now();
+#endif
+        for (int64_t spin = 0; !TryRead(data); ++spin) {
+            if (spin >= HVX_SIM_SPIN_COUNT)
+                std::this_thread::yield();
+        }
+#if defined(HVX_SIM_PROFILE)
+        hvx::sim::ProfileStall(Port(), true, start);
+#endif
+    }
+
+private:
+    HVX_FORCE_INLINE auto Next(std::size_t ptr) const noexcept -> std::size_t {
+        return (ptr + 1 == buf_.size()) ? 0 : ptr + 1;
+    }
+
+    // one slot stays empty to distinguish a full from an empty ring
+    const std::size_t depth_;
+    std::vector<type_> buf_;
+    type_ port_{};
+
+    // consumer and producer indices on separate cache lines
+    alignas(HVX_SIM_CACHE_LINE) std::atomic<std::size_t> head_{0};
+    alignas(HVX_SIM_CACHE_LINE) std::atomic<std::size_t> tail_{0};
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Resolves the ports of a top function once when it is called. Nested scopes of the same thread form a chain. Inside a scope a
+ * port address that is not listed is a buffer in memory, so StreamReadData/StreamWriteData never touch the registry per element.
+ */
+class StreamScope {
+public:
+    template<typename... type_>
+    explicit StreamScope(const type_*... ports) : parent_(Current()) {
+        static_assert(sizeof...(type_) <= port_max, "Too many ports for a stream scope!");
+        auto& registry     = hvx::sim::impl::ChannelRegistry::Global();
+        const bool active  = registry.Active(); // a channel is constructed before its port is passed to a top function
+        const void* list[] = {nullptr, static_cast<const void*>(ports)...};
+        for (std::size_t i = 1; i < sizeof(list) / sizeof(list[0]); ++i) {
+            ports_[num_]      = list[i];
+            channels_[num_++] = active ? registry.Lookup(list[i]) : nullptr;
+        }
+        Current() = this;
+    }
+
+    StreamScope(const StreamScope&)                    = delete;
+    auto operator=(const StreamScope&) -> StreamScope& = delete;
+
+    ~StreamScope() noexcept {
+        Current() = parent_;
+    }
+
+    /*!
+     * @brief the innermost scope of the calling thread or nullptr outside of all top functions
+     */
+    static auto Current() noexcept -> StreamScope*& {
+        thread_local StreamScope* scope = nullptr;
+        return scope;
+    }
+
+    /*!
+     * @brief finds the channel of a port in this or an enclosing scope, returns false if no scope lists the port
+     */
+    HVX_FORCE_INLINE auto Find(const void* port, ChannelBase*& channel) const noexcept -> bool {
+        for (const StreamScope* scope = this; scope != nullptr; scope = scope->parent_) {
+            for (std::size_t i = 0; i < scope->num_; ++i) {
+                if (scope->ports_[i] == port) {
+                    channel = scope->channels_[i];
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    static constexpr std::size_t port_max = 17;
+
+    StreamScope* const parent_;
+    std::size_t num_ = 0;
+    const void* ports_[port_max]{};
+    ChannelBase* channels_[port_max]{};
+};
+
+/*!
+ * @brief Returns the channel behind a port address or nullptr if the port is a tensor in memory
+ */
+template<typename type_>
+HVX_FORCE_INLINE auto
+ChannelFromPort(const type_* port) -> hvx::sim::Channel<type_>* {
+    ChannelBase* channel = nullptr;
+    const auto* scope    = hvx::sim::StreamScope::Current();
+    if (scope != nullptr) {
+        // ports of a top function (and its local buffers) resolved when the top function was called
+        if (!scope->Find(port, channel))
+            return nullptr;
+    } else {
+        // called outside of all top functions
+        auto& registry = hvx::sim::impl::ChannelRegistry::Global();
+        if (!registry.Active())
+            return nullptr;
+        channel = registry.Lookup(port);
+    }
+    if (channel == nullptr)
+        return nullptr;
+    assert(dynamic_cast<hvx::sim::Channel<type_>*>(channel) != nullptr && "Channel type does not match the port type!");
+    return static_cast<hvx::sim::Channel<type_>*>(channel);
+}
+
+/******************************************************************************************************************************************/
+} // namespace sim
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE
+#endif // HVX_SIM_STREAM_H_
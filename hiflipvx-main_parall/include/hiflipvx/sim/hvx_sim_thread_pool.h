@@ -0,0 +1,181 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sim_thread_pool.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  A fixed size thread pool for the parallel C-simulation of layers. Not available during synthesis.
+ */
+
+#ifndef HVX_SIM_THREAD_POOL_H_
+#define HVX_SIM_THREAD_POOL_H_
+
+#include "../util/hvx_util_macro.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hvx {
+namespace sim {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Executes the iterations of a parallel loop on a fixed number of threads (the calling thread participates)
+ */
+class ThreadPool {
+public:
+    /*!
+     * @brief creates a pool with "threads" threads in total (including the calling thread)
+     */
+    explicit ThreadPool(int64_t threads = DefaultThreads()) {
+        const int64_t workers = (threads < 1 ? 1 : threads) - 1;
+        workers_.reserve(static_cast<std::size_t>(workers));
+        for (int64_t i = 0; i < workers; ++i)
+            workers_.emplace_back(&ThreadPool::Worker, this);
+    }
+
+    ThreadPool(const ThreadPool&)                    = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+    ~ThreadPool() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        job_cv_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+    /*!
+     * @brief number of threads that execute a parallel loop
+     */
+    auto Threads() const noexcept -> int64_t {
+        return static_cast<int64_t>(workers_.size()) + 1;
+    }
+
+    /*!
+     * @brief calls "func(i)" for all i in [0, tasks) and returns when all calls have finished (serial if called from inside the pool)
+     */
+    auto ParallelFor(int64_t tasks, const std::function<void(int64_t)>& func) -> void {
+        if (workers_.empty() || tasks <= 1 || InWorker()) {
+            for (int64_t i = 0; i < tasks; ++i)
+                func(i);
+            return;
+        }
+
+        // publish the loop
+        std::lock_guard<std::mutex> call_lock(call_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            func_  = &func;
+            tasks_ = tasks;
+            next_.store(0, std::memory_order_relaxed);
+            ++job_;
+        }
+        job_cv_.notify_all();
+
+        // the calling thread works on the loop too and then waits for the workers
+        InWorker() = true;
+        RunTasks(func, tasks);
+        InWorker() = false;
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return busy_ == 0; });
+        func_ = nullptr;
+    }
+
+    /*!
+     * @brief number of threads used by default (HVX_SIM_THREADS environment variable or the number of hardware threads)
+     */
+    static auto DefaultThreads() noexcept -> int64_t {
+        const char* env = std::getenv("HVX_SIM_THREADS"); // NOLINT
+        if (env != nullptr && std::atoll(env) > 0)
+            return std::atoll(env);
+        const auto hw = static_cast<int64_t>(std::thread::hardware_concurrency());
+        return (hw > 0) ? hw : 1;
+    }
+
+    /*!
+     * @brief the pool that is used if no pool is given
+     */
+    static auto Global() -> ThreadPool& {
+        static ThreadPool pool;
+        return pool;
+    }
+
+private:
+    auto RunTasks(const std::function<void(int64_t)>& func, int64_t tasks) -> void {
+        for (int64_t i = next_.fetch_add(1); i < tasks; i = next_.fetch_add(1))
+            func(i);
+    }
+
+    auto Worker() -> void {
+        InWorker()    = true;
+        uint64_t seen = 0;
+        for (;;) {
+            const std::function<void(int64_t)>* func = nullptr;
+            int64_t tasks                            = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                job_cv_.wait(lock, [&]() { return stop_ || (job_ != seen && func_ != nullptr); });
+                if (stop_)
+                    return;
+                seen  = job_;
+                func  = func_;
+                tasks = tasks_;
+                ++busy_;
+            }
+            RunTasks(*func, tasks);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --busy_;
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    static auto InWorker() noexcept -> bool& {
+        thread_local bool in_worker = false;
+        return in_worker;
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex call_mutex_;
+    std::mutex mutex_;
+    std::condition_variable job_cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(int64_t)>* func_ = nullptr;
+    int64_t tasks_                            = 0;
+    int64_t busy_                             = 0;
+    uint64_t job_                             = 0;
+    bool stop_                                = false;
+    std::atomic<int64_t> next_{0};
+};
+
+/******************************************************************************************************************************************/
+} // namespace sim
+} // namespace hvx
+
+#endif // !HVX_SYNTHESIS_ACTIVE
+#endif // HVX_SIM_THREAD_POOL_H_
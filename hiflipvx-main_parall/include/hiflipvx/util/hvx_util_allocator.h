@@ -0,0 +1,406 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_util_allocator.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Storage policies and the per-layer arena for the C-simulation of the array types. Not used during synthesis, where arrays are plain
+ *  on-chip memories.
+ */
+
+#ifndef HVX_UTIL_ALLOCATOR_H_
+#define HVX_UTIL_ALLOCATOR_H_
+
+#include "hvx_util_macro.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#endif
+
+// alignment of all C-simulation buffers (cache line and AVX-512 register width)
+#ifndef HVX_ALLOC_ALIGNMENT
+#define HVX_ALLOC_ALIGNMENT 64
+#endif
+
+// the storage policy used by the array types if none is given (can be overwritten by the user)
+#ifndef HVX_DEFAULT_ALLOCATOR
+#define HVX_DEFAULT_ALLOCATOR hvx::util::arena_allocator
+#endif
+
+namespace hvx {
+namespace util {
+/******************************************************************************************************************************************/
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+
+/*!
+ * @brief One contiguous, aligned block that holds all arrays of a layer instance. Every array block is preceded by a header that points to
+ * the arena it was taken from (or nullptr if it was taken from the heap). The block is freed when the owning layer and all arrays are gone.
+ */
+class MemoryArena {
+public:
+    static constexpr std::size_t alignment = HVX_ALLOC_ALIGNMENT;
+    static_assert((alignment & (alignment - 1)) == 0, "Alignment needs to be a power of 2!");
+    static_assert(alignment <= 128, "Alignment offset needs to fit into a single byte!");
+    static_assert(alignment >= sizeof(MemoryArena*), "The block header needs to fit into the alignment!");
+
+    MemoryArena(const MemoryArena&)                    = delete;
+    auto operator=(const MemoryArena&) -> MemoryArena& = delete;
+
+    /*!
+     * @brief creates an arena of "bytes" size, it is referenced by the caller until Release is called
+     */
+    static auto Create(std::size_t bytes) -> MemoryArena* {
+        return new MemoryArena(bytes); // NOLINT
+    }
+
+    /*!
+     * @brief size of an array block including its header
+     */
+    static constexpr auto BlockSize(std::size_t bytes) noexcept -> std::size_t {
+        return ((bytes + alignment - 1) / alignment) * alignment + alignment;
+    }
+
+    /*!
+     * @brief returns an aligned array block of at least "bytes" size (from the heap if the arena is exhausted)
+     */
+    auto Allocate(std::size_t bytes) -> void* {
+        const std::size_t size = BlockSize(bytes);
+        if (size > capacity_ - offset_)
+            return AllocateHeap(bytes);
+        std::uint8_t* block = base_ + offset_; // NOLINT
+        offset_ += size;
+        refs_.fetch_add(1, std::memory_order_relaxed);
+        return SetOwner(block, this);
+    }
+
+    /*!
+     * @brief returns an aligned array block of at least "bytes" size from the heap
+     */
+    static auto AllocateHeap(std::size_t bytes) -> void* {
+        return SetOwner(static_cast<std::uint8_t*>(AllocateAligned(BlockSize(bytes))), nullptr);
+    }
+
+    /*!
+     * @brief gives an array block back to its owner (the arena is freed together with its last block)
+     */
+    static auto Deallocate(void* ptr) noexcept -> void {
+        if (ptr == nullptr)
+            return;
+        std::uint8_t* block = static_cast<std::uint8_t*>(ptr) - alignment; // NOLINT
+        MemoryArena*  owner = *reinterpret_cast<MemoryArena**>(block);   // NOLINT
+        if (owner == nullptr)
+            FreeAligned(block);
+        else
+            owner->Release();
+    }
+
+    /*!
+     * @brief drops one reference (the owning layer or an array block)
+     */
+    auto Release() noexcept -> void {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this; // NOLINT
+    }
+
+    /*!
+     * @brief bytes that are reserved from the operating system
+     */
+    auto BytesReserved() const noexcept -> std::size_t {
+        return capacity_;
+    }
+
+    /*!
+     * @brief bytes that are handed out to arrays (including the block headers)
+     */
+    auto BytesUsed() const noexcept -> std::size_t {
+        return offset_;
+    }
+
+    /*!
+     * @brief allocates a block that starts at the alignment boundary (the offset to the original pointer is stored in front of it)
+     */
+    static auto AllocateAligned(std::size_t bytes) -> void* {
+        void* raw = std::malloc(bytes + alignment); // NOLINT
+        if (raw == nullptr)
+            throw std::bad_alloc();
+        const auto addr    = reinterpret_cast<std::uintptr_t>(raw); // NOLINT
+        const auto aligned = (addr + alignment) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        reinterpret_cast<std::uint8_t*>(aligned)[-1] = static_cast<std::uint8_t>(aligned - addr); // NOLINT
+        return reinterpret_cast<void*>(aligned);                                                  // NOLINT
+    }
+
+    /*!
+     * @brief frees a block allocated by AllocateAligned
+     */
+    static auto FreeAligned(void* ptr) noexcept -> void {
+        if (ptr == nullptr)
+            return;
+        auto* aligned = static_cast<std::uint8_t*>(ptr);
+        std::free(aligned - aligned[-1]); // NOLINT
+    }
+
+private:
+    explicit MemoryArena(std::size_t bytes)
+        : base_(bytes > 0 ? static_cast<std::uint8_t*>(AllocateAligned(bytes)) : nullptr)
+        , capacity_(bytes) {}
+    ~MemoryArena() noexcept {
+        FreeAligned(base_);
+    }
+
+    static auto SetOwner(std::uint8_t* block, MemoryArena* owner) noexcept -> void* {
+        *reinterpret_cast<MemoryArena**>(block) = owner; // NOLINT
+        return block + alignment;                        // NOLINT
+    }
+
+    std::uint8_t*            base_;
+    std::size_t              capacity_;
+    std::size_t              offset_ = 0;
+    std::atomic<std::size_t> refs_{1};
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief The arena that the next array allocations of this thread are taken from. It is set by a LayerArena for the construction of its
+ * layer state and cleared by the ArenaSeal at the end of it. A state that is constructed while the arena of another state is open (a
+ * nested state) takes its arrays from that arena, since they have been measured as a part of it. In the measure mode only the sizes are
+ * accumulated.
+ */
+struct ArenaScope {
+    MemoryArena* arena   = nullptr;
+    bool         measure = false;
+    std::size_t  bytes   = 0;
+    std::size_t  blocks  = 0;
+    std::size_t  depth   = 0;
+
+    static auto Current() noexcept -> ArenaScope& {
+        static thread_local ArenaScope scope;
+        return scope;
+    }
+};
+
+/*!
+ * @brief Storage policy: aligned blocks from the arena of the layer state that is being constructed, or from the heap for arrays that are
+ * not part of a layer state. All blocks are freed when the array (heap) or the layer state and all its arrays (arena) are destroyed.
+ */
+struct arena_allocator {
+    template<typename type_>
+    static auto Allocate(std::size_t elms) -> type_* {
+        ArenaScope&       scope = ArenaScope::Current();
+        const std::size_t bytes = elms * sizeof(type_);
+        if (scope.measure) {
+            scope.bytes += MemoryArena::BlockSize(bytes);
+            ++scope.blocks;
+            return nullptr;
+        }
+        if (scope.arena == nullptr)
+            return static_cast<type_*>(MemoryArena::AllocateHeap(bytes));
+        assert((scope.blocks > 0) && "More arrays are constructed than the layer state has been measured with!");
+        --scope.blocks;
+        return static_cast<type_*>(scope.arena->Allocate(bytes));
+    }
+    template<typename type_>
+    static auto Deallocate(type_* ptr, std::size_t /*elms*/) noexcept -> void {
+        MemoryArena::Deallocate(ptr);
+    }
+};
+
+/*!
+ * @brief Storage policy: aligned blocks directly from the heap, freed when an array is destroyed
+ */
+struct heap_allocator {
+    template<typename type_>
+    static auto Allocate(std::size_t elms) -> type_* {
+        return static_cast<type_*>(hvx::util::MemoryArena::AllocateAligned(elms * sizeof(type_)));
+    }
+    template<typename type_>
+    static auto Deallocate(type_* ptr, std::size_t /*elms*/) noexcept -> void {
+        hvx::util::MemoryArena::FreeAligned(ptr);
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief The last member of a layer state: closes the arena of the state after all its arrays have been constructed, and verifies that
+ * exactly the measured number of arrays has been taken from it (the arena of a nested state is closed by the outermost state)
+ */
+class ArenaSeal {
+public:
+    ArenaSeal() noexcept {
+        Close();
+    }
+    ArenaSeal(const ArenaSeal& /*other*/) noexcept {
+        Close();
+    }
+    ArenaSeal(ArenaSeal&& /*other*/) noexcept {}
+    auto operator=(const ArenaSeal& /*other*/) noexcept -> ArenaSeal& = default;
+    auto operator=(ArenaSeal&& /*other*/) noexcept -> ArenaSeal&      = default;
+    ~ArenaSeal() noexcept                                              = default;
+
+private:
+    static auto Close() noexcept -> void {
+        ArenaScope& scope = ArenaScope::Current();
+        if (scope.measure || (scope.depth == 0) || (--scope.depth > 0))
+            return;
+        assert((scope.blocks == 0) && "Less arrays are constructed than the layer state has been measured with!");
+        scope = ArenaScope{};
+    }
+};
+
+/*!
+ * @brief Base class of the layer states: all arrays of a state that use the arena_allocator are placed in one contiguous block. The size of
+ * the block is measured once per state type by constructing the state without storage. The state needs an ArenaSeal as its last member.
+ */
+template<typename state_>
+class LayerArena {
+public:
+    LayerArena() {
+        Open();
+    }
+    LayerArena(const LayerArena& /*other*/) {
+        Open();
+    }
+    LayerArena(LayerArena&& other) noexcept
+        : arena_(other.arena_) {
+        other.arena_ = nullptr;
+    }
+    auto operator=(const LayerArena& /*other*/) noexcept -> LayerArena& {
+        return *this;
+    }
+    auto operator=(LayerArena&& other) noexcept -> LayerArena& {
+        std::swap(arena_, other.arena_);
+        return *this;
+    }
+    ~LayerArena() noexcept {
+        ArenaScope& scope = ArenaScope::Current();
+        if (arena_ != nullptr && scope.arena == arena_)
+            scope = ArenaScope{};
+        if (arena_ != nullptr)
+            arena_->Release();
+    }
+
+    /*!
+     * @brief the arena of this layer state (nullptr if the state has no arena arrays)
+     */
+    auto Arena() const noexcept -> const MemoryArena* {
+        return arena_;
+    }
+
+private:
+    auto Open() -> void {
+        ArenaScope& scope = ArenaScope::Current();
+        if (scope.measure)
+            return;
+        if (scope.arena != nullptr) {
+            ++scope.depth;
+            return;
+        }
+        static const ArenaScope layout = Measure();
+        if (layout.blocks == 0)
+            return;
+        arena_ = MemoryArena::Create(layout.bytes);
+        scope  = ArenaScope{arena_, false, 0, layout.blocks, 1};
+    }
+
+    static auto Measure() -> ArenaScope {
+        ArenaScope& scope = ArenaScope::Current();
+        ArenaScope  prev  = scope;
+        scope             = ArenaScope{nullptr, true, 0, 0, 0};
+        alignas(state_) unsigned char raw[sizeof(state_)]; // NOLINT
+        (new (raw) state_)->~state_();
+        ArenaScope layout = scope;
+        scope             = prev;
+        return layout;
+    }
+
+    MemoryArena* arena_ = nullptr;
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Allocates and value initializes "elms" elements using the storage policy (nothing if the policy only measures). Like the static
+ * arrays of the stateless top functions, the buffers of a layer state start zeroed.
+ */
+template<typename alloc_, typename type_>
+HVX_FORCE_INLINE auto
+ArrayAllocate(std::size_t elms) -> type_* {
+    type_* ptr = alloc_::template Allocate<type_>(elms);
+    if (ptr == nullptr)
+        return nullptr;
+    for (std::size_t i = 0; i < elms; ++i)
+        new (ptr + i) type_(); // NOLINT
+    return ptr;
+}
+
+/*!
+ * @brief Allocates "elms" elements using the storage policy and copies them from "src"
+ */
+template<typename alloc_, typename type_>
+HVX_FORCE_INLINE auto
+ArrayAllocateCopy(const type_* src, std::size_t elms) -> type_* {
+    type_* ptr = alloc_::template Allocate<type_>(elms);
+    if (ptr == nullptr || src == nullptr)
+        return ptr;
+    for (std::size_t i = 0; i < elms; ++i)
+        new (ptr + i) type_(src[i]); // NOLINT
+    return ptr;
+}
+
+/*!
+ * @brief Destroys "elms" elements and gives the memory back to the storage policy
+ */
+template<typename alloc_, typename type_>
+HVX_FORCE_INLINE auto
+ArrayDeallocate(type_* ptr, std::size_t elms) noexcept -> void {
+    if (ptr == nullptr)
+        return;
+    for (std::size_t i = 0; i < elms; ++i)
+        ptr[i].~type_(); // NOLINT
+    alloc_::template Deallocate<type_>(ptr, elms);
+}
+
+#else
+
+/*!
+ * @brief During synthesis the storage policies are only tags and the layer arena is empty, since arrays are plain memories
+ */
+struct arena_allocator {};
+struct heap_allocator {};
+class ArenaSeal {};
+template<typename state_>
+class LayerArena {};
+
+#endif
+
+/*!
+ * @brief The storage policy used by default
+ */
+using def_allocator = HVX_DEFAULT_ALLOCATOR;
+
+/******************************************************************************************************************************************/
+} // namespace util
+} // namespace hvx
+
+#endif // HVX_UTIL_ALLOCATOR_H_
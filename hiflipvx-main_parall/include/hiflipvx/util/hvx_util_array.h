@@ -25,24 +25,56 @@
 #ifndef HVX_UTIL_ARRAY_H_
 #define HVX_UTIL_ARRAY_H_
 
+#include "hvx_util_allocator.h"
 #include "hvx_util_vector.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include <algorithm>
+#include <utility>
+#endif
 
 namespace hvx {
 namespace util {
 /******************************************************************************************************************************************/
 
 /*!
- * @brief a simple array data type
+ * @brief a simple array data type (during C-simulation the storage is 64-byte aligned and provided by the "alloc_" policy)
  */
-template<typename type_, int64_t cols_>
+template<typename type_, int64_t cols_, typename alloc_ = hvx::util::def_allocator>
 struct array1d {
     // stores the values
 #ifdef HVX_SYNTHESIS_ACTIVE
     type_ data[cols_]; // NOLINT
 #else
-    type_* data = new type_[cols_];
+    type_* data = hvx::util::ArrayAllocate<alloc_, type_>(cols_);
 #endif
     using data_type = type_;
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+    using alloc_type = alloc_;
+
+    // the storage is owned by the array and copied by value (like the array during synthesis)
+    array1d() = default;
+    array1d(const array1d& other)
+        : data(hvx::util::ArrayAllocateCopy<alloc_, type_>(other.data, cols_)) {}
+    array1d(array1d&& other) noexcept
+        : data(other.data) {
+        other.data = nullptr;
+    }
+    auto operator=(const array1d& other) -> array1d& {
+        if (this == &other)
+            return *this;
+        if (data == nullptr)
+            data = hvx::util::ArrayAllocate<alloc_, type_>(cols_);
+        std::copy(other.data, other.data + cols_, data);
+        return *this;
+    }
+    auto operator=(array1d&& other) noexcept -> array1d& {
+        std::swap(data, other.data);
+        return *this;
+    }
+    ~array1d() noexcept {
+        hvx::util::ArrayDeallocate<alloc_, type_>(data, cols_);
+    }
+#endif
 
     /*!
      * @brief gets an element (call by reference)
@@ -70,17 +102,44 @@ struct array1d {
 /******************************************************************************************************************************************/
 
 /*!
- * @brief a simple array data type
+ * @brief a simple array data type (during C-simulation the storage is 64-byte aligned and provided by the "alloc_" policy)
  */
-template<typename type_, int64_t cols_, int64_t rows_>
+template<typename type_, int64_t cols_, int64_t rows_, typename alloc_ = hvx::util::def_allocator>
 struct array2d {
     // stores the values
 #ifdef HVX_SYNTHESIS_ACTIVE
     type_ data[rows_][cols_]; // NOLINT
 #else
-    type_* data = new type_[cols_ * rows_];
+    type_* data = hvx::util::ArrayAllocate<alloc_, type_>(cols_ * rows_);
 #endif
     using data_type = type_;
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+    using alloc_type = alloc_;
+
+    // the storage is owned by the array and copied by value (like the array during synthesis)
+    array2d() = default;
+    array2d(const array2d& other)
+        : data(hvx::util::ArrayAllocateCopy<alloc_, type_>(other.data, cols_ * rows_)) {}
+    array2d(array2d&& other) noexcept
+        : data(other.data) {
+        other.data = nullptr;
+    }
+    auto operator=(const array2d& other) -> array2d& {
+        if (this == &other)
+            return *this;
+        if (data == nullptr)
+            data = hvx::util::ArrayAllocate<alloc_, type_>(cols_ * rows_);
+        std::copy(other.data, other.data + cols_ * rows_, data);
+        return *this;
+    }
+    auto operator=(array2d&& other) noexcept -> array2d& {
+        std::swap(data, other.data);
+        return *this;
+    }
+    ~array2d() noexcept {
+        hvx::util::ArrayDeallocate<alloc_, type_>(data, cols_ * rows_);
+    }
+#endif
 
     /*!
      * @brief gets an element (call by reference)
@@ -118,17 +177,44 @@ struct array2d {
 /******************************************************************************************************************************************/
 
 /*!
- * @brief a simple array data type
+ * @brief a simple array data type (during C-simulation the storage is 64-byte aligned and provided by the "alloc_" policy)
  */
-template<typename type_, int64_t bats_,int64_t cols_, int64_t rows_>
+template<typename type_, int64_t bats_, int64_t cols_, int64_t rows_, typename alloc_ = hvx::util::def_allocator>
 struct array3d {
     // stores the values
 #ifdef HVX_SYNTHESIS_ACTIVE
     type_ data[bats_][rows_][cols_]; // NOLINT
 #else
-    type_* data = new type_[bats_ * cols_ * rows_];
+    type_* data = hvx::util::ArrayAllocate<alloc_, type_>(bats_ * cols_ * rows_);
 #endif
     using data_type = type_;
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+    using alloc_type = alloc_;
+
+    // the storage is owned by the array and copied by value (like the array during synthesis)
+    array3d() = default;
+    array3d(const array3d& other)
+        : data(hvx::util::ArrayAllocateCopy<alloc_, type_>(other.data, bats_ * cols_ * rows_)) {}
+    array3d(array3d&& other) noexcept
+        : data(other.data) {
+        other.data = nullptr;
+    }
+    auto operator=(const array3d& other) -> array3d& {
+        if (this == &other)
+            return *this;
+        if (data == nullptr)
+            data = hvx::util::ArrayAllocate<alloc_, type_>(bats_ * cols_ * rows_);
+        std::copy(other.data, other.data + bats_ * cols_ * rows_, data);
+        return *this;
+    }
+    auto operator=(array3d&& other) noexcept -> array3d& {
+        std::swap(data, other.data);
+        return *this;
+    }
+    ~array3d() noexcept {
+        hvx::util::ArrayDeallocate<alloc_, type_>(data, bats_ * cols_ * rows_);
+    }
+#endif
 
     /*!
      * @brief gets an element (call by reference)
@@ -125,6 +125,96 @@ struct is_dfixed: details_is_dfixed::is_dfixed<std::remove_volatile_t<std::remov
 template<typename type_>
 static constexpr auto is_dfixed_v = static_cast<bool>(is_dfixed<type_>::value);
 
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief bias of a per-channel quantized conv/dense layer (like TFLite/ONNX QLinearConv). The int32 accumulator of an output channel plus
+ * its bias "data" is multiplied by the fixed-point multiplier "mult" (31 fraction bits) and shifted right by "31 + shift" bits, which
+ * requantizes it from the scale "src_scale * wgts_scale" to the scale of the dst. It is read through the bias port and buffered like the
+ * bias. The src zero point "src_zero_" is the code of a real 0 in the src, the layer pads its src with it.
+ */
+template<typename type_ = int32_t, int64_t src_zero_ = 0>
+struct dqbias {
+    // compile time elements (type traits, the bias is an integer in the scale of the accumulator)
+    static constexpr bool is_signed = std::is_signed<type_>::value;
+    static constexpr bool is_int    = std::is_integral<type_>::value;
+    static constexpr bool is_flt    = std::is_floating_point<type_>::value;
+    static constexpr int64_t digits = std::numeric_limits<type_>::digits;
+    static constexpr auto frac_bits = 0;
+    static constexpr auto src_zero  = src_zero_;
+    using data_type                 = type_;
+
+    // stores the bias and the requantization of the output channel
+    type_ data;
+    int32_t mult;
+    int8_t shift;
+
+    /*!
+     * @brief
+     */
+    constexpr dqbias() noexcept = default;
+
+    /*!
+     * @brief
+     */
+    static constexpr auto lowest() noexcept -> type_ {
+        return std::numeric_limits<type_>::lowest();
+    }
+
+    /*!
+     * @brief
+     */
+    static constexpr auto max() noexcept -> type_ {
+        return std::numeric_limits<type_>::max();
+    }
+};
+
+/*!
+ * @brief
+ */
+namespace details_is_dqbias {
+template<typename>
+struct is_dqbias: std::false_type {};
+
+/*!
+ * @brief
+ */
+template<typename type_, int64_t src_zero_>
+struct is_dqbias<dqbias<type_, src_zero_>>: std::true_type {};
+} // namespace details_is_dqbias
+
+/*!
+ * @brief
+ */
+template<typename type_>
+struct is_dqbias: details_is_dqbias::is_dqbias<std::remove_volatile_t<std::remove_const_t<type_>>> {};
+
+/*!
+ * @brief
+ */
+template<typename type_>
+static constexpr auto is_dqbias_v = static_cast<bool>(is_dqbias<type_>::value);
+
+/*!
+ * @brief the src zero point of a layer with a dqbias
+ */
+template<typename type_, std::enable_if_t<is_dqbias_v<type_>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+DqbiasSrcZero() noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    return type_::src_zero;
+}
+
+/*!
+ * @brief the src zero point of a layer without a dqbias (the src is padded with 0)
+ */
+template<typename type_, std::enable_if_t<!is_dqbias_v<type_>, bool> = true>
+HVX_FORCE_INLINE constexpr auto
+DqbiasSrcZero() noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    return 0;
+}
+
 /******************************************************************************************************************************************/
 } // namespace util
 } // namespace hvx
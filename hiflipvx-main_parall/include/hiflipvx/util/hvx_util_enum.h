@@ -168,7 +168,59 @@ enum class underflow_e : int8_t {
  */
 enum class pooling_e : int8_t {
     kAvg,
-    kMax
+    kMax,
+    kSum
+};
+
+/*!
+ * @brief for the convolution algorithm (the value is the number of dst rows/cols computed from one window)
+ */
+enum class conv_e : int8_t {
+    kDirect    = 1,
+    kWinograd2 = 2, // F(2x2,3x3)
+    kWinograd4 = 4, // F(4x4,3x3)
+};
+
+/*!
+ * @brief for the implementation of a layer during C-simulation (synthesis always uses the hardware implementation)
+ */
+enum class sim_e : int8_t {
+    kHw,   // the streaming hardware implementation
+    kGemm, // im2col + blocked GEMM on the CPU for tensors in memory (conv/dense, falls back to kHw if not available)
+};
+
+/*!
+ * @brief for the type of normalization
+ */
+enum class norm_e : int8_t {
+    kAffine, // src * wgts + bias (no statistics)
+    kLayer,  // (src - mean) / sqrt(var + eps) * wgts + bias
+    kRms,    // src / sqrt(mean(src^2) + eps) * wgts + bias
+};
+
+/*!
+ * @brief for the axes the statistics of a normalization are computed over
+ */
+enum class norm_axes_e : int8_t {
+    kChnls,         // per pixel (e.g. the hidden dimension of a token)
+    kColsChnls,     // per row
+    kRowsColsChnls, // per sample
+};
+
+/*!
+ * @brief for the computation scheme of the softmax
+ */
+enum class softmax_e : int8_t {
+    kTwoPass, // reads and sums up exp(src) of a pixel, then normalizes it (2 * chnl_vec_elms iterations per pixel)
+    kOnline,  // running max and rescaled sum, normalizes the previous pixel while reading the next (chnl_vec_elms iterations per pixel)
+};
+
+/*!
+ * @brief for the cell of a recurrent layer
+ */
+enum class rnn_e : int8_t {
+    kLstm, // gates (input, forget, cell, output), keeps a hidden and a cell state
+    kGru,  // gates (update, reset, new), the reset gate is applied after the recurrent matmul (like PyTorch and Keras "reset_after")
 };
 
 /*!
@@ -231,6 +283,8 @@ enum_name(const hvx::util::pooling_e e) noexcept -> const char* {
             return "PoolingMax";
         case hvx::util::pooling_e::kAvg:
             return "PoolingAvg";
+        case hvx::util::pooling_e::kSum:
+            return "PoolingSum";
     } // Do not declare default case to get warning by static analyzer if a case is missing
     return "";
 }
@@ -26,6 +26,9 @@
 #define HVX_UTIL_INTERFACE_H_
 
 #include "hvx_util_tensor.h"
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#include "../sim/hvx_sim_stream.h"
+#endif
 
 namespace hvx {
 namespace util {
@@ -74,24 +77,46 @@ StreamSignalVerify(int64_t ptr_src, int64_t ptr_dst) noexcept -> void {
 }
 
 /*!
- * @brief Reads a vector from the input if a condition is met
+ * @brief Reads a vector from the input if a condition is met (blocks on the channel, if the input is a C-simulation channel)
  */
 template<typename src_port, typename src_vec>
 HVX_FORCE_INLINE constexpr auto
 StreamReadData(src_port* src, src_vec& src_data, int64_t& ptr_src, bool cond) noexcept -> void {
+#if !defined(HVX_SYNTHESIS_ACTIVE) && defined(HVX_SIM_PROFILE)
+    hvx::sim::ProfileStream(&ptr_src, src, true, cond);
+#endif
     if (cond == true) {
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+        if (auto* channel = hvx::sim::ChannelFromPort(src)) {
+            src_port data{};
+            channel->Read(data);
+            src_data = data;
+            ++ptr_src;
+            return;
+        }
+#endif
         src_data = src[ptr_src]; // NOLINT
         ++ptr_src;
     }
 }
 
 /*!
- * @brief Writes a vector ta the input if a condition is met
+ * @brief Writes a vector ta the input if a condition is met (blocks on the channel, if the output is a C-simulation channel)
  */
 template<typename dst_port, typename dst_vec>
 HVX_FORCE_INLINE constexpr auto
 StreamWriteData(dst_port* dst, dst_vec& dst_data, int64_t& ptr_dst, bool cond) noexcept -> void {
+#if !defined(HVX_SYNTHESIS_ACTIVE) && defined(HVX_SIM_PROFILE)
+    hvx::sim::ProfileStream(&ptr_dst, dst, false, cond);
+#endif
     if (cond == true) {
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+        if (auto* channel = hvx::sim::ChannelFromPort(dst)) {
+            channel->Write(dst_data);
+            ++ptr_dst;
+            return;
+        }
+#endif
         dst[ptr_dst] = dst_data; // NOLINT
         ++ptr_dst;
     }
@@ -45,6 +45,29 @@
 #define HVX_PRAGMA(STR)
 #endif
 
+// opens a stream profile scope for the calling top function, called at the top of every Hw* function (C-simulation with
+// HVX_SIM_PROFILE only)
+#if !defined(HVX_SYNTHESIS_ACTIVE) && defined(HVX_SIM_PROFILE)
+#if defined(__GNUC__) || defined(__clang__)
+#define HVX_SIM_PROFILE_TOP() hvx::sim::ProfileScope hvx_sim_profile_scope(__func__, __PRETTY_FUNCTION__)
+#elif defined(_MSC_VER)
+#define HVX_SIM_PROFILE_TOP() hvx::sim::ProfileScope hvx_sim_profile_scope(__func__, __FUNCSIG__)
+#else
+#define HVX_SIM_PROFILE_TOP() hvx::sim::ProfileScope hvx_sim_profile_scope(__func__)
+#endif
+#else
+#define HVX_SIM_PROFILE_TOP()
+#endif
+
+// resolves the stream channels behind the ports of the calling top function once, called at the top of every Hw* function (C-simulation
+// only)
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+#define HVX_SIM_STREAM_TOP(...) const hvx::sim::StreamScope hvx_sim_stream_scope(__VA_ARGS__)
+#else
+#define HVX_SIM_STREAM_TOP(...)
+#endif
+
+// selects the macro by the number of arguments (the callers append an empty argument after the macro names, so "..." is never empty)
 #define HVX_GET_MACRO17(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, NAME, ...) NAME
 #define HVX_GET_MACRO8(_1, _2, _3, _4, _5, _6, _7, _8, NAME, ...)                                              NAME
 
@@ -202,13 +225,13 @@
 #define HVX_DATAPACK(...)                                                                                                        \
     HVX_GET_MACRO17(__VA_ARGS__, HVX_DATAPACK17, HVX_DATAPACK16, HVX_DATAPACK15, HVX_DATAPACK14, HVX_DATAPACK13, HVX_DATAPACK12, \
                     HVX_DATAPACK11, HVX_DATAPACK10, HVX_DATAPACK9, HVX_DATAPACK8, HVX_DATAPACK7, HVX_DATAPACK6, HVX_DATAPACK5,   \
-                    HVX_DATAPACK4, HVX_DATAPACK3, HVX_DATAPACK2, HVX_DATAPACK1)                                                  \
+                    HVX_DATAPACK4, HVX_DATAPACK3, HVX_DATAPACK2, HVX_DATAPACK1, )                                                \
     (__VA_ARGS__)
 #define HVX_DATAPACK_TOP(...)                                                                                                    \
     HVX_PRAGMA(HLS INLINE)                                                                                                       \
     HVX_GET_MACRO17(__VA_ARGS__, HVX_DATAPACK17, HVX_DATAPACK16, HVX_DATAPACK15, HVX_DATAPACK14, HVX_DATAPACK13, HVX_DATAPACK12, \
                     HVX_DATAPACK11, HVX_DATAPACK10, HVX_DATAPACK9, HVX_DATAPACK8, HVX_DATAPACK7, HVX_DATAPACK6, HVX_DATAPACK5,   \
-                    HVX_DATAPACK4, HVX_DATAPACK3, HVX_DATAPACK2, HVX_DATAPACK1)                                                  \
+                    HVX_DATAPACK4, HVX_DATAPACK3, HVX_DATAPACK2, HVX_DATAPACK1, )                                                \
     (__VA_ARGS__)
 
 //
@@ -238,24 +261,24 @@
 //
 #define HVX_INTERFACE_STREAM(...)                                                                                           \
     HVX_GET_MACRO8(__VA_ARGS__, HVX_INTERFACE_STREAM8, HVX_INTERFACE_STREAM7, HVX_INTERFACE_STREAM6, HVX_INTERFACE_STREAM5, \
-                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1)              \
+                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1, )            \
     (__VA_ARGS__)
 #define HVX_INTERFACE_STREAM_TLP(...)                                                                                       \
     HVX_PRAGMA(HLS DATAFLOW)                                                                                                \
     HVX_GET_MACRO8(__VA_ARGS__, HVX_INTERFACE_STREAM8, HVX_INTERFACE_STREAM7, HVX_INTERFACE_STREAM6, HVX_INTERFACE_STREAM5, \
-                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1)              \
+                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1, )            \
     (__VA_ARGS__)
 
 #define HVX_INTERFACE_STREAM_NO_CTRL(...)                                                                                   \
     HVX_PRAGMA(HLS INTERFACE ap_ctrl_none port = return)                                                                    \
     HVX_GET_MACRO8(__VA_ARGS__, HVX_INTERFACE_STREAM8, HVX_INTERFACE_STREAM7, HVX_INTERFACE_STREAM6, HVX_INTERFACE_STREAM5, \
-                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1)              \
+                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1, )            \
     (__VA_ARGS__)
 #define HVX_INTERFACE_STREAM_NO_CTRL_TLP(...)                                                                               \
     HVX_PRAGMA(HLS INTERFACE ap_ctrl_none port = return)                                                                    \
     HVX_PRAGMA(HLS DATAFLOW)                                                                                                \
     HVX_GET_MACRO8(__VA_ARGS__, HVX_INTERFACE_STREAM8, HVX_INTERFACE_STREAM7, HVX_INTERFACE_STREAM6, HVX_INTERFACE_STREAM5, \
-                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1)              \
+                   HVX_INTERFACE_STREAM4, HVX_INTERFACE_STREAM3, HVX_INTERFACE_STREAM2, HVX_INTERFACE_STREAM1, )            \
     (__VA_ARGS__)
 
 // INLINE
@@ -266,6 +289,9 @@
 #define HVX_PIPELINE_ON(INTERVAL, STYLE)  HVX_PRAGMA(HLS pipeline II = INTERVAL style = STYLE)
 #define HVX_PIPELINE_OFF(INTERVAL, STYLE) HVX_PRAGMA(HLS pipeline off)
 
+// LOOP TRIPCOUNT (loops with a bound that is only known at runtime)
+#define HVX_LOOP_TRIPCOUNT(MIN, MAX) HVX_PRAGMA(HLS loop_tripcount min = MIN max = MAX)
+
 // UNROLL
 #define HVX_UNROLL() HVX_PRAGMA(HLS UNROLL)
 
@@ -197,6 +197,53 @@ FixedUnderflow(const int64_t input) noexcept -> int64_t {
     return result;
 }
 
+/*!
+ * @brief Fixed-point sigmoid function with "frac_bits_" fraction bits (linear interpolation of a lookup table with a step size of 1/8
+ * over [0, 8], sigmoid(-x) = 1 - sigmoid(x), the absolute error is below 4e-4)
+ */
+template<int64_t frac_bits_, hvx::util::underflow_e underflow_>
+HVX_FORCE_INLINE auto
+DfixedSigmoid(const int64_t src) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+
+    // sigmoid(i / 8) with 16 fraction bits
+    static constexpr int32_t lut[65] = {32768, 34813, 36843, 38841, 40793, 42687, 44511, 46254, 47911, 49474, 50941,
+                                         52310, 53581, 54754, 55834, 56822, 57724, 58544, 59287, 59959, 60565, 61109,
+                                         61598, 62036, 62428, 62778, 63090, 63368, 63615, 63835, 64030, 64203, 64357,
+                                         64494, 64614, 64721, 64816, 64900, 64974, 65039, 65097, 65149, 65194, 65234,
+                                         65269, 65300, 65328, 65352, 65374, 65393, 65410, 65425, 65438, 65449, 65459,
+                                         65468, 65476, 65483, 65489, 65495, 65500, 65504, 65508, 65511, 65514};
+
+    // lookup table parameters (the index and the interpolation weight are taken from the absolute value with 16 fraction bits)
+    constexpr int64_t lut_frac_bits = 16;
+    constexpr int64_t step_bits     = 13;
+    constexpr int64_t step_mask     = (static_cast<int64_t>(1) << step_bits) - 1;
+    constexpr int64_t lut_last      = 64;
+
+    // interpolate between two table entries (saturates for |x| >= 8)
+    const int64_t abs_data = hvx::util::Min(hvx::util::CastFixedToFixed<frac_bits_, lut_frac_bits, underflow_>(hvx::util::Abs(src)),
+                                            lut_last << step_bits);
+    const int64_t ptr      = abs_data >> step_bits;
+    const int64_t low      = lut[ptr];
+    const int64_t high     = lut[hvx::util::Min(ptr + 1, lut_last)];
+    const int64_t res      = low + (((high - low) * (abs_data & step_mask)) >> step_bits);
+
+    // mirror negative values and convert to the fraction size of the result
+    const int64_t res_signed = (src < 0) ? ((static_cast<int64_t>(1) << lut_frac_bits) - res) : (res);
+    return hvx::util::CastFixedToFixed<lut_frac_bits, frac_bits_, underflow_>(res_signed);
+}
+
+/*!
+ * @brief Fixed-point tanh function with "frac_bits_" fraction bits: tanh(x) = 2 * sigmoid(2 * x) - 1
+ */
+template<int64_t frac_bits_, hvx::util::underflow_e underflow_>
+HVX_FORCE_INLINE auto
+DfixedTanh(const int64_t src) noexcept -> int64_t {
+    HVX_INLINE_TOP();
+    const int64_t res = hvx::util::DfixedSigmoid<frac_bits_, underflow_>(src * 2);
+    return res * 2 - (static_cast<int64_t>(1) << frac_bits_);
+}
+
 /******************************************************************************************************************************************/
 } // namespace util
 } // namespace hvx
@@ -102,6 +102,23 @@ Log2Ceil(int64_t n) noexcept -> int64_t {
     return (n <= 1) ? 0 : Log2Floor(n - 1) + 1;
 }
 
+/*!
+ * @brief reduces an array with a balanced tree of binary operations (log2(size) levels instead of a chain of size-1 operations)
+ */
+template<int64_t size_, typename type_, typename op_>
+HVX_FORCE_INLINE constexpr auto
+TreeReduce(type_ (&data)[size_], op_ op) noexcept -> type_ { // NOLINT
+    HVX_INLINE_TOP();
+    for (int64_t stride = 1; stride < size_; stride *= 2) {
+        HVX_UNROLL();
+        for (int64_t i = 0; (i + stride) < size_; i += (2 * stride)) {
+            HVX_UNROLL();
+            data[i] = op(data[i], data[i + stride]); // NOLINT
+        }
+    }
+    return data[0];
+}
+
 /******************************************************************************************************************************************/
 
 /*!
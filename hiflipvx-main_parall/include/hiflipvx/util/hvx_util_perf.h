@@ -0,0 +1,379 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_util_perf.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Analytic performance model (cycles, initiation interval, pipeline fill/drain, frames/s) derived from the param structs.
+ */
+
+#ifndef HVX_UTIL_PERF_H_
+#define HVX_UTIL_PERF_H_
+
+#include "hvx_util_math_utils.h"
+
+namespace hvx {
+namespace util {
+namespace impl {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief priority tag to select the first matching overload (higher rank is tried first)
+ */
+template<int64_t rank_>
+struct PerfRank: PerfRank<rank_ - 1> {};
+template<>
+struct PerfRank<0> {};
+
+/*!
+ * @brief number of iterations of the pipelined top loop (nn layers with a "lat" parameter)
+ */
+template<typename param_>
+constexpr auto
+PerfIterations(PerfRank<6> /*rank*/) noexcept -> decltype(void(param_::lat), int64_t{}) {
+    return param_::lat;
+}
+
+/*!
+ * @brief number of iterations of the pipelined top loop (layers mapped to a convolution, e.g. dense)
+ */
+template<typename param_>
+constexpr auto
+PerfIterations(PerfRank<5> /*rank*/) noexcept -> decltype(void(param_::conv_param::lat), int64_t{}) {
+    return param_::conv_param::lat;
+}
+
+/*!
+ * @brief number of iterations of the pipelined top loop (transpose: writes the buffer, then reads it)
+ */
+template<typename param_>
+constexpr auto
+PerfIterations(PerfRank<4> /*rank*/) noexcept -> decltype(void(sizeof(typename param_::perm)), int64_t{}) {
+    return param_::src_dim::vec_elms + param_::dst_dim::vec_elms;
+}
+
+/*!
+ * @brief number of iterations of the pipelined top loop (reduce: one element per cycle)
+ */
+template<typename param_>
+constexpr auto
+PerfIterations(PerfRank<3> /*rank*/) noexcept -> decltype(void(sizeof(typename param_::reduce)), int64_t{}) {
+    return param_::src_dim::elms;
+}
+
+/*!
+ * @brief number of iterations of the pipelined top loop (elementwise: one vector per cycle)
+ */
+template<typename param_>
+constexpr auto
+PerfIterations(PerfRank<2> /*rank*/) noexcept -> decltype(void(param_::op_type), void(param_::vec_elms), int64_t{}) {
+    return param_::vec_elms;
+}
+
+/*!
+ * @brief number of iterations of the pipelined top loop (reshape/reorder: limited by the side with more vectors)
+ */
+template<typename param_>
+constexpr auto
+PerfIterations(PerfRank<1> /*rank*/) noexcept -> decltype(void(param_::src_dim::vec_elms), void(param_::dst_dim::vec_elms), int64_t{}) {
+    return hvx::util::Max(param_::src_dim::vec_elms, param_::dst_dim::vec_elms);
+}
+
+/*!
+ * @brief number of iterations of the pipelined top loop (multicast/split/concat: one vector per cycle)
+ */
+template<typename param_>
+constexpr auto
+PerfIterations(PerfRank<0> /*rank*/) noexcept -> decltype(void(param_::dim::vec_elms), int64_t{}) {
+    return param_::dim::vec_elms;
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief number of input elements of a layer
+ */
+template<typename param_>
+constexpr auto
+PerfSrcElms(PerfRank<2> /*rank*/) noexcept -> decltype(void(param_::src_dim::elms), int64_t{}) {
+    return param_::src_dim::elms;
+}
+template<typename param_>
+constexpr auto
+PerfSrcElms(PerfRank<1> /*rank*/) noexcept -> decltype(void(param_::src1_dim::elms), int64_t{}) {
+    return param_::src1_dim::elms;
+}
+template<typename param_>
+constexpr auto
+PerfSrcElms(PerfRank<0> /*rank*/) noexcept -> decltype(void(param_::dim::elms), int64_t{}) {
+    return param_::dim::elms;
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief number of products that are summed up in one cycle (sum_elms for conv/dense, kernel elements for depthwise/pool, else 1)
+ */
+template<typename param_>
+constexpr auto
+PerfSumElms(PerfRank<3> /*rank*/) noexcept -> decltype(void(param_::sum_elms), int64_t{}) {
+    return param_::sum_elms;
+}
+template<typename param_>
+constexpr auto
+PerfSumElms(PerfRank<2> /*rank*/) noexcept -> decltype(void(param_::conv_param::sum_elms), int64_t{}) {
+    return param_::conv_param::sum_elms;
+}
+template<typename param_>
+constexpr auto
+PerfSumElms(PerfRank<1> /*rank*/) noexcept -> decltype(void(param_::knl_elms), int64_t{}) {
+    return param_::knl_elms;
+}
+template<typename param_>
+constexpr auto
+PerfSumElms(PerfRank<0> /*rank*/) noexcept -> int64_t {
+    return 1;
+}
+
+/*!
+ * @brief multipliers of the datapath of a layer (conv/dense, 0 if the layer does not report them)
+ */
+template<typename param_>
+constexpr auto
+PerfMults(PerfRank<2> /*rank*/) noexcept -> decltype(void(param_::mults), int64_t{}) {
+    return param_::mults;
+}
+template<typename param_>
+constexpr auto
+PerfMults(PerfRank<1> /*rank*/) noexcept -> decltype(void(param_::conv_param::mults), int64_t{}) {
+    return param_::conv_param::mults;
+}
+template<typename param_>
+constexpr auto
+PerfMults(PerfRank<0> /*rank*/) noexcept -> int64_t {
+    return 0;
+}
+
+/*!
+ * @brief feature map iterations per pixel that produces no output (iteration-skipping layers only iterate over the src chnls there,
+ * 1 for layers without feature maps)
+ */
+template<typename param_>
+constexpr auto
+PerfLatFms(PerfRank<2> /*rank*/) noexcept -> decltype(void(param_::lat_wait_fms), int64_t{}) {
+    return param_::lat_wait_fms;
+}
+template<typename param_>
+constexpr auto
+PerfLatFms(PerfRank<1> /*rank*/) noexcept -> decltype(void(param_::lat_fms), int64_t{}) {
+    return param_::lat_fms;
+}
+template<typename param_>
+constexpr auto
+PerfLatFms(PerfRank<0> /*rank*/) noexcept -> int64_t {
+    return 1;
+}
+
+/*!
+ * @brief iterations until a layer emits its first output (layers that buffer an operand before they compute, e.g. matmul)
+ */
+template<typename param_>
+constexpr auto
+PerfDelay(PerfRank<2> /*rank*/) noexcept -> decltype(void(param_::lat_delay), int64_t{}) {
+    return param_::lat_delay;
+}
+
+/*!
+ * @brief iterations until a sliding window layer emits its first output (rows that need to be buffered before the first window)
+ */
+template<typename param_>
+constexpr auto
+PerfDelay(PerfRank<1> /*rank*/) noexcept
+    -> decltype(void(param_::knl_dil_rows), void(param_::pad_rows_up), void(param_::lat_cols), void(param_::lat_chnls), int64_t{}) {
+    constexpr auto rows = hvx::util::Max(param_::knl_dil_rows - 1 - param_::pad_rows_up, static_cast<int64_t>(0));
+    constexpr auto row_iters = param_::lat_cols * param_::lat_chnls * PerfLatFms<param_>(PerfRank<2>{});
+    return ((rows + param_::src_row_vec_size - 1) / param_::src_row_vec_size) * row_iters;
+}
+template<typename param_>
+constexpr auto
+PerfDelay(PerfRank<0> /*rank*/) noexcept -> int64_t {
+    return 0;
+}
+
+/*!
+ * @brief sum of all values
+ */
+constexpr auto
+PerfSum() noexcept -> int64_t {
+    return 0;
+}
+template<typename... vals_>
+constexpr auto
+PerfSum(int64_t val, vals_... vals) noexcept -> int64_t {
+    return val + PerfSum(vals...);
+}
+
+/*!
+ * @brief maximum of all values
+ */
+constexpr auto
+PerfMax(int64_t val) noexcept -> int64_t {
+    return val;
+}
+template<typename... vals_>
+constexpr auto
+PerfMax(int64_t val, vals_... vals) noexcept -> int64_t {
+    return hvx::util::Max(val, PerfMax(vals...));
+}
+
+/*!
+ * @brief index of the first maximum of all values
+ */
+constexpr auto
+PerfArgMax(int64_t /*idx*/, int64_t max_idx, int64_t /*max*/) noexcept -> int64_t {
+    return max_idx;
+}
+template<typename... vals_>
+constexpr auto
+PerfArgMax(int64_t idx, int64_t max_idx, int64_t max, int64_t val, vals_... vals) noexcept -> int64_t {
+    return (val > max) ? PerfArgMax(idx + 1, idx, val, vals...) : PerfArgMax(idx + 1, max_idx, max, vals...);
+}
+
+/******************************************************************************************************************************************/
+} // namespace impl
+
+/*!
+ * @brief Pipeline depth (fill/drain) of a layer in cycles. This is a first-order estimate: 2 cycles to read/write the ports, 3 cycles
+ * for the multiplication and the rounding/saturation policies, and an adder tree over all products summed up in one cycle. It can be
+ * specialized for a param struct to calibrate the model with the depth reported by synthesis.
+ */
+template<typename param_>
+struct PerfDepth {
+    static constexpr int64_t value = 2 + 3 + hvx::util::Log2Ceil(hvx::util::impl::PerfSumElms<param_>(hvx::util::impl::PerfRank<3>{}));
+};
+
+/*!
+ * @brief Analytic performance model of a single layer (all top loops are pipelined with an initiation interval of 1)
+ */
+template<typename param_>
+struct PerfModel {
+    // cycles between two frames (back-to-back calls)
+    static constexpr int64_t iterations = hvx::util::impl::PerfIterations<param_>(hvx::util::impl::PerfRank<6>{});
+    static constexpr int64_t ii         = 1;
+    static constexpr int64_t interval   = iterations * ii;
+
+    // pipeline fill/drain, iterations until the first output and latency of one frame
+    static constexpr int64_t depth  = PerfDepth<param_>::value;
+    static constexpr int64_t delay  = hvx::util::impl::PerfDelay<param_>(hvx::util::impl::PerfRank<2>{});
+    static constexpr int64_t cycles = interval + depth;
+
+    // number of input elements
+    static constexpr int64_t src_elms = hvx::util::impl::PerfSrcElms<param_>(hvx::util::impl::PerfRank<2>{});
+
+    // multipliers (DSPs) of the datapath, a partially vectorized kernel trades them against the interval
+    static constexpr int64_t mults = hvx::util::impl::PerfMults<param_>(hvx::util::impl::PerfRank<2>{});
+
+    /*!
+     * @brief input elements consumed per cycle
+     */
+    static constexpr auto ElmsPerCycle() noexcept -> double {
+        return static_cast<double>(src_elms) / static_cast<double>(interval);
+    }
+
+    /*!
+     * @brief achievable frames per second at a given clock (back-to-back frames)
+     */
+    static constexpr auto FramesPerSec(const double clock_mhz) noexcept -> double {
+        return (clock_mhz * 1e6) / static_cast<double>(interval);
+    }
+
+    /*!
+     * @brief latency of one frame in microseconds at a given clock
+     */
+    static constexpr auto LatencyUs(const double clock_mhz) noexcept -> double {
+        return static_cast<double>(cycles) / clock_mhz;
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Analytic performance model of a chain of layers connected by streams in a dataflow region. The slowest layer (bottleneck)
+ * determines the interval of the chain. The latency is the interval of the bottleneck plus the fill/drain and the window delay of
+ * every layer. The sequential latency assumes that the layers are executed one after another.
+ */
+template<typename... params_>
+struct PerfChain {
+    static constexpr int64_t layers = sizeof...(params_);
+    static_assert(layers > 0, "A chain needs at least one layer!");
+
+    static constexpr int64_t bottleneck  = hvx::util::impl::PerfArgMax(0, 0, -1, PerfModel<params_>::interval...);
+    static constexpr int64_t interval    = hvx::util::impl::PerfMax(PerfModel<params_>::interval...);
+    static constexpr int64_t latency     = interval + hvx::util::impl::PerfSum((PerfModel<params_>::depth + PerfModel<params_>::delay)...);
+    static constexpr int64_t latency_seq = hvx::util::impl::PerfSum(PerfModel<params_>::cycles...);
+
+    /*!
+     * @brief achievable frames per second of the dataflow chain at a given clock
+     */
+    static constexpr auto FramesPerSec(const double clock_mhz) noexcept -> double {
+        return (clock_mhz * 1e6) / static_cast<double>(interval);
+    }
+
+    /*!
+     * @brief latency of one frame through the dataflow chain in microseconds at a given clock
+     */
+    static constexpr auto LatencyUs(const double clock_mhz) noexcept -> double {
+        return static_cast<double>(latency) / clock_mhz;
+    }
+
+#if !defined(HVX_SYNTHESIS_ACTIVE)
+    /*!
+     * @brief creates a table with the model of every layer and of the whole chain (names are optional)
+     */
+    static auto Report(const double clock_mhz, const std::vector<std::string>& names = {}) -> std::string {
+        const std::array<int64_t, layers> ints = {{PerfModel<params_>::interval...}};
+        const std::array<int64_t, layers> cycs = {{PerfModel<params_>::cycles...}};
+        const std::array<double, layers> fps   = {{PerfModel<params_>::FramesPerSec(clock_mhz)...}};
+        const std::array<double, layers> elms  = {{PerfModel<params_>::ElmsPerCycle()...}};
+        const std::array<int64_t, layers> dpth = {{PerfModel<params_>::depth...}};
+        const std::array<int64_t, layers> dlay = {{PerfModel<params_>::delay...}};
+        const std::array<int64_t, layers> mult = {{PerfModel<params_>::mults...}};
+        std::ostringstream str;
+        str << std::fixed << std::setprecision(2);
+        str << "  " << std::left << std::setw(16) << "layer" << std::right << std::setw(12) << "interval" << std::setw(8) << "depth"
+            << std::setw(10) << "delay" << std::setw(12) << "cycles" << std::setw(10) << "elm/cyc" << std::setw(14) << "frames/s"
+            << std::setw(8) << "mults" << "\n";
+        for (int64_t i = 0; i < layers; ++i) {
+            const auto id   = static_cast<size_t>(i);
+            const auto name = (id < names.size()) ? names.at(id) : ("layer" + std::to_string(i));
+            str << "  " << std::left << std::setw(16) << name << std::right << std::setw(12) << ints.at(id) << std::setw(8)
+                << dpth.at(id) << std::setw(10) << dlay.at(id) << std::setw(12) << cycs.at(id) << std::setw(10) << elms.at(id)
+                << std::setw(14) << fps.at(id) << std::setw(8) << mult.at(id) << ((i == bottleneck) ? "  <- bottleneck" : "") << "\n";
+        }
+        str << "  chain @ " << clock_mhz << " MHz: interval " << interval << " cycles, latency " << latency << " cycles ("
+            << LatencyUs(clock_mhz) << " us), sequential " << latency_seq << " cycles, " << FramesPerSec(clock_mhz) << " frames/s\n";
+        return str.str();
+    }
+#endif
+};
+
+/******************************************************************************************************************************************/
+} // namespace util
+} // namespace hvx
+
+#endif // HVX_UTIL_PERF_H_
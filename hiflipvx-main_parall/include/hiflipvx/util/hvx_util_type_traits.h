@@ -90,6 +90,42 @@ struct ClipParam {
     static constexpr auto min = min_;
 };
 
+/*!
+ * @brief A rational compile time constant (num_ / den_), e.g. for the epsilon of a normalization
+ */
+template<int64_t num_, int64_t den_>
+struct RatioParam {
+    static constexpr auto num = num_;
+    static constexpr auto den = den_;
+    static_assert(den_ != 0, "Denominator cannot be 0!");
+};
+
+/*!
+ * @brief Epilogue of a conv/dense layer that is applied on the result after the bias was added: "act(result * scale + shift)". The
+ * activation uses the constant arguments "arg1_"/"arg2_" like the elementwise operation (e.g. MaxConst with arg1 = 0 for a ReLU or Clip
+ * for a ReLU6). The overflow/underflow policies of the layer are used for the requantization.
+ */
+template<hvx::util::elmwise_e act_ = hvx::util::elmwise_e::None, // None, Abs, Clip, MaxConst, MinConst, Sigmoid or Tanh
+         typename scale_           = hvx::util::RatioParam<1, 1>,
+         typename shift_           = hvx::util::RatioParam<0, 1>,
+         typename arg1_            = hvx::util::RatioParam<0, 1>,
+         typename arg2_            = hvx::util::RatioParam<0, 1>>
+struct EpilogueParam {
+    static constexpr auto act        = act_;
+    static constexpr auto is_scaled  = (scale_::num != scale_::den);
+    static constexpr auto is_shifted = (shift_::num != 0);
+    static constexpr auto is_active  = (act_ != hvx::util::elmwise_e::None);
+    static constexpr auto is_fused   = (is_scaled || is_shifted || is_active);
+    using scale                      = scale_;
+    using shift                      = shift_;
+    using arg1                       = arg1_;
+    using arg2                       = arg2_;
+    static_assert((act_ == hvx::util::elmwise_e::None) || (act_ == hvx::util::elmwise_e::Abs) || (act_ == hvx::util::elmwise_e::Clip) ||
+                      (act_ == hvx::util::elmwise_e::MaxConst) || (act_ == hvx::util::elmwise_e::MinConst) ||
+                      (act_ == hvx::util::elmwise_e::Sigmoid) || (act_ == hvx::util::elmwise_e::Tanh),
+                  "Activation is not supported by the epilogue!");
+};
+
 /*!
  * @brief Compile time parameters and checks of a vector
  */
@@ -152,14 +188,16 @@ struct TensorParam {
  */
 template<typename dst_dim_, int64_t dim_id_, int64_t elms_>
 struct ConcatSplitTensorParam {
-    using dim = hvx::util::TensorParam<
+    // unused ports (0 elements) keep the full dimension, so that their vector types stay valid
+    static constexpr int64_t elms = (elms_ > 0) ? (elms_) : (dst_dim_::dims[dim_id_]);
+    using dim                     = hvx::util::TensorParam<
         dst_dim_::dim_num,
-        std::conditional_t<dim_id_ == 0, hvx::util::VectorParam<elms_, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim0>,
-        std::conditional_t<dim_id_ == 1, hvx::util::VectorParam<elms_, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim1>,
-        std::conditional_t<dim_id_ == 2, hvx::util::VectorParam<elms_, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim2>,
-        std::conditional_t<dim_id_ == 3, hvx::util::VectorParam<elms_, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim3>,
-        std::conditional_t<dim_id_ == 4, hvx::util::VectorParam<elms_, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim4>,
-        std::conditional_t<dim_id_ == 5, hvx::util::VectorParam<elms_, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim5>>;
+        std::conditional_t<dim_id_ == 0, hvx::util::VectorParam<elms, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim0>,
+        std::conditional_t<dim_id_ == 1, hvx::util::VectorParam<elms, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim1>,
+        std::conditional_t<dim_id_ == 2, hvx::util::VectorParam<elms, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim2>,
+        std::conditional_t<dim_id_ == 3, hvx::util::VectorParam<elms, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim3>,
+        std::conditional_t<dim_id_ == 4, hvx::util::VectorParam<elms, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim4>,
+        std::conditional_t<dim_id_ == 5, hvx::util::VectorParam<elms, dst_dim_::vecs[dim_id_]>, typename dst_dim_::dim5>>;
 };
 
 /******************************************************************************************************************************************/
@@ -0,0 +1,349 @@
+﻿/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_util_weights_prep.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Load-time preprocessing of the weights and bias (host only): folds a BatchNorm into the preceding layer and packs floating-point
+ *  tensors into the vectorized port layout of a layer (the layout read by WeightsUpdate/BiasUpdate), requantized to the target type.
+ *  Quantizes the weights of a conv/dense layer per output feature map and computes the requantization of its dqbias. The kernel of a
+ *  Winograd conv is folded and packed like the kernel of the direct conv and transformed afterwards.
+ */
+
+#ifndef HVX_UTIL_WEIGHTS_PREP_H_
+#define HVX_UTIL_WEIGHTS_PREP_H_
+
+#include "../nn/hvx_nn_conv.h"
+#include "hvx_util_tensor.h"
+
+namespace hvx {
+namespace util {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief the error of requantizing a floating-point tensor to the target type
+ */
+struct WeightsPrepError {
+    float max_err     = 0.0f; // maximum absolute error
+    float sum_sqr_err = 0.0f; // sum of the squared errors
+    int64_t saturated = 0;    // number of values that were out of range of the target type
+    int64_t elms      = 0;    // number of values
+
+    /*!
+     * @brief root mean square error
+     */
+    auto RmsErr() const noexcept -> float {
+        return (elms > 0) ? (std::sqrt(sum_sqr_err / static_cast<float>(elms))) : (0.0f);
+    }
+};
+
+/*!
+ * @brief the error of the folded weights and bias
+ */
+struct WeightsFoldReport {
+    WeightsPrepError wgts;
+    WeightsPrepError bias;
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief requantizes a floating-point value to an integer fixed-point type (rounded to nearest, saturated) and updates the error
+ */
+template<typename type_, std::enable_if_t<hvx::util::is_dfixed_v<type_> && type_::is_int, bool> = true>
+auto
+WeightsQuantize(float src, hvx::util::WeightsPrepError& err) noexcept -> type_ {
+    constexpr auto shift  = static_cast<float>(static_cast<int64_t>(1) << type_::frac_bits);
+    constexpr auto lowest = static_cast<float>(std::numeric_limits<typename type_::data_type>::lowest());
+    constexpr auto max    = static_cast<float>(std::numeric_limits<typename type_::data_type>::max());
+
+    // round to nearest and saturate
+    const float data = std::round(src * shift);
+    err.saturated += ((data < lowest) || (data > max)) ? (1) : (0);
+
+    // convert and measure the error
+    type_ dst{};
+    dst.data        = static_cast<typename type_::data_type>(hvx::util::Clamp(data, lowest, max));
+    const float res = static_cast<float>(dst.data) / shift;
+    err.max_err     = hvx::util::Max(err.max_err, std::abs(res - src));
+    err.sum_sqr_err += (res - src) * (res - src);
+    ++err.elms;
+    return dst;
+}
+
+/*!
+ * @brief converts a floating-point value to a floating-point type and updates the error
+ */
+template<typename type_, std::enable_if_t<!hvx::util::is_dfixed_v<type_> || type_::is_flt, bool> = true>
+auto
+WeightsQuantize(float src, hvx::util::WeightsPrepError& err) noexcept -> type_ {
+    const auto dst  = static_cast<type_>(src);
+    const float res = static_cast<float>(dst);
+    err.max_err     = hvx::util::Max(err.max_err, std::abs(res - src));
+    err.sum_sqr_err += (res - src) * (res - src);
+    ++err.elms;
+    return dst;
+}
+
+/*!
+ * @brief packs a floating-point tensor (dim0 is the fastest dimension) into the vectors of a port (vectors over multiple dimensions are
+ * packed like the hardware reads them) and requantizes it to the type of the port
+ */
+template<typename dim_, typename type_, int64_t vec_size_>
+auto
+WeightsPack(const float* src, hvx::util::vector<type_, vec_size_>* dst) noexcept -> hvx::util::WeightsPrepError {
+    static_assert(dim_::vec_size == vec_size_, "The vector size of the port and the tensor do not match!");
+    hvx::util::WeightsPrepError err{};
+    hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{}, ptr_elms_v{}, ptr_elms_p{};
+    for (int64_t i = 0; i < dim_::elms; ++i) {
+        hvx::util::TensorDimVecElmsIter<dim_>(ptr_elms, ptr_elms_v, ptr_elms_p, i);
+        auto data = hvx::util::WeightsQuantize<type_>(src[hvx::util::TensorPtrElms<dim_>(ptr_elms)], err);       // NOLINT
+        dst[hvx::util::TensorPtrElmsV<dim_>(ptr_elms_v)].Set(data, hvx::util::TensorPtrElmsP<dim_>(ptr_elms_p)); // NOLINT
+    }
+    return err;
+}
+
+/*!
+ * @brief the kernel of a layer: the weights tensor, or the kernel of the direct conv for a Winograd conv (its weights are transformed)
+ */
+template<typename param_, typename = void>
+struct WeightsKernel {
+    static constexpr bool is_winograd = false;
+    using dim                         = typename param_::wgts_dim;
+};
+template<typename param_>
+struct WeightsKernel<param_, std::enable_if_t<(param_::tile > 1)>> {
+    static constexpr bool is_winograd = true;
+    using dim                         = typename param_::knl_dim;
+};
+
+/*!
+ * @brief packs a floating-point kernel (in the layout of WeightsKernel) into the weights port of a layer and requantizes it
+ */
+template<typename param_, std::enable_if_t<!hvx::util::WeightsKernel<param_>::is_winograd, bool> = true>
+auto
+WeightsPackKernel(const float* src, typename param_::wgts_port* dst) noexcept -> hvx::util::WeightsPrepError {
+    return hvx::util::WeightsPack<typename param_::wgts_dim>(src, dst);
+}
+
+/*!
+ * @brief packs a floating-point kernel into the layout of the direct conv, requantizes it and transforms it for the Winograd mode (the
+ * error is the one of the kernel, the transform rounds once more)
+ */
+template<typename param_, std::enable_if_t<hvx::util::WeightsKernel<param_>::is_winograd, bool> = true>
+auto
+WeightsPackKernel(const float* src, typename param_::wgts_port* dst) noexcept -> hvx::util::WeightsPrepError {
+    using knl_dim = typename param_::knl_dim;
+    std::vector<typename param_::knl_vec> knl(knl_dim::vec_elms);
+    const auto err = hvx::util::WeightsPack<knl_dim>(src, knl.data());
+    hvx::nn::ConvWinogradWeights<param_>(knl.data(), dst);
+    return err;
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief folds a BatchNorm into the weights and bias of the preceding layer (floating-point). The output feature maps are the last
+ * dimension of the weights (conv, dense, depthwise, transposed conv) and the only dimension of the bias. A missing bias is zero.
+ *  scale    = gamma / sqrt(var + eps)
+ *  wgts_dst = wgts * scale
+ *  bias_dst = (bias - mean) * scale + beta
+ */
+template<typename wgts_dim_, typename bias_dim_>
+auto
+WeightsFoldBatchNorm(const float* wgts,
+                     const float* bias,
+                     const float* gamma,
+                     const float* beta,
+                     const float* mean,
+                     const float* var,
+                     float eps,
+                     float* wgts_dst,
+                     float* bias_dst) noexcept -> void {
+    constexpr int64_t fm_dim = wgts_dim_::dim_num - 1;
+    constexpr int64_t fms    = hvx::util::TensorGetDimElms<wgts_dim_, fm_dim>();
+    static_assert((bias_dim_::dim_num == 1) && (bias_dim_::elms == fms), "The bias needs one value per output feature map!");
+
+    // bias
+    for (int64_t fm = 0; fm < fms; ++fm) {
+        const float scale = gamma[fm] / std::sqrt(var[fm] + eps);    // NOLINT
+        const float data  = (bias != nullptr) ? (bias[fm]) : (0.0f); // NOLINT
+        bias_dst[fm]      = (data - mean[fm]) * scale + beta[fm];    // NOLINT
+    }
+
+    // weights
+    hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{};
+    for (int64_t i = 0; i < wgts_dim_::elms; ++i) {
+        hvx::util::TensorDimElmsIter<wgts_dim_>(ptr_elms, i);
+        const int64_t fm  = ptr_elms.Get(fm_dim);
+        const float scale = gamma[fm] / std::sqrt(var[fm] + eps); // NOLINT
+        wgts_dst[i]       = wgts[i] * scale;                      // NOLINT
+    }
+}
+
+/*!
+ * @brief folds a BatchNorm into the weights and bias of a layer and packs them into its ports (requantized to the weights and bias type).
+ * The weights of a Winograd conv are the kernel of the direct conv, they are transformed after the fold. Returns the requantization error
+ * of the folded weights and bias.
+ */
+template<typename param_>
+auto
+WeightsFoldBatchNorm(const float* wgts,
+                     const float* bias,
+                     const float* gamma,
+                     const float* beta,
+                     const float* mean,
+                     const float* var,
+                     float eps,
+                     typename param_::wgts_port* wgts_port,
+                     typename param_::bias_port* bias_port) noexcept -> hvx::util::WeightsFoldReport {
+    using wgts_dim = typename hvx::util::WeightsKernel<param_>::dim;
+    using bias_dim = typename param_::bias_dim;
+
+    // fold in floating-point, then requantize
+    std::vector<float> wgts_fold(wgts_dim::elms), bias_fold(bias_dim::elms);
+    hvx::util::WeightsFoldBatchNorm<wgts_dim, bias_dim>(wgts, bias, gamma, beta, mean, var, eps, wgts_fold.data(), bias_fold.data());
+    hvx::util::WeightsFoldReport report{};
+    report.wgts = hvx::util::WeightsPackKernel<param_>(wgts_fold.data(), wgts_port);
+    report.bias = hvx::util::WeightsPack<bias_dim>(bias_fold.data(), bias_port);
+    return report;
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief converts the real requantization scale "src_scale * wgts_scale / dst_scale" of a dst chnl into the multiplier (31 fraction
+ * bits, in [2^30, 2^31)) and the right shift of its dqbias: scale = mult * 2^-(31 + shift)
+ */
+template<typename bias_type_>
+auto
+WeightsRequantScale(double scale, bias_type_& bias) noexcept -> void {
+    constexpr int64_t one = 1;
+    if (scale <= 0.0) {
+        bias.mult  = 0;
+        bias.shift = 0;
+        return;
+    }
+
+    // scale = frac * 2^exp with frac in [0.5, 1)
+    int32_t exp   = 0;
+    auto mult     = static_cast<int64_t>(std::round(std::frexp(scale, &exp) * static_cast<double>(one << 31)));
+    int32_t shift = -exp;
+    if (mult == (one << 31)) {
+        mult /= 2;
+        --shift;
+    }
+
+    // very small scales lose precision in the multiplier, very large ones are saturated ("31 + shift" has to be in [1, 62])
+    if (shift > 31) {
+        mult >>= hvx::util::Min(shift - 31, 31);
+        shift = 31;
+    }
+    if (shift < -30) {
+        mult  = (one << 31) - 1;
+        shift = -30;
+    }
+    bias.mult  = static_cast<int32_t>(mult);
+    bias.shift = static_cast<int8_t>(shift);
+}
+
+/*!
+ * @brief quantizes the weights and bias of a conv/dense layer per dst feature map (like TFLite/ONNX QLinearConv) and packs them into its
+ * ports. The weights are symmetric integer codes, the largest absolute weight of a feature map is mapped to the largest code. The bias is
+ * quantized to int32 with the scale "src_scale * wgts_scale" and the src zero point of the dqbias is folded into it (the layer pads its
+ * src with the zero point). The dst zero point is the shift of the epilogue. Writes the weights scales (one per feature map) and returns
+ * the quantization error of the weights and bias (in the real scale).
+ */
+template<typename param_>
+auto
+WeightsQuantizePerChannel(const float* wgts,
+                          const float* bias,
+                          float src_scale,
+                          float dst_scale,
+                          typename param_::wgts_port* wgts_port,
+                          typename param_::bias_port* bias_port,
+                          float* wgts_scale) noexcept -> hvx::util::WeightsFoldReport {
+    using wgts_dim             = typename param_::wgts_dim;
+    using bias_dim             = typename param_::bias_dim;
+    using bias_type            = typename param_::bias_type;
+    constexpr int64_t fm_dim   = wgts_dim::dim_num - 1;
+    constexpr int64_t fms      = hvx::util::TensorGetDimElms<wgts_dim, fm_dim>();
+    constexpr auto wgts_max    = static_cast<float>(std::numeric_limits<typename param_::wgts_type::data_type>::max());
+    constexpr auto bias_lowest = static_cast<float>(std::numeric_limits<typename bias_type::data_type>::lowest());
+    constexpr auto bias_max    = static_cast<float>(std::numeric_limits<typename bias_type::data_type>::max());
+    static_assert(hvx::util::is_dqbias_v<bias_type>, "The bias of a per-channel quantized layer is a dqbias!");
+    static_assert(!hvx::util::WeightsKernel<param_>::is_winograd, "The transformed weights of a Winograd conv are no integer codes!");
+    static_assert((bias_dim::dim_num == 1) && (bias_dim::elms == fms), "The bias needs one value per output feature map!");
+
+    // weights scale of each feature map
+    std::vector<float> wgts_abs(fms, 0.0f);
+    hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{};
+    for (int64_t i = 0; i < wgts_dim::elms; ++i) {
+        hvx::util::TensorDimElmsIter<wgts_dim>(ptr_elms, i);
+        auto& data = wgts_abs[static_cast<std::size_t>(ptr_elms.Get(fm_dim))];
+        data       = hvx::util::Max(data, std::abs(wgts[i])); // NOLINT
+    }
+    for (int64_t fm = 0; fm < fms; ++fm) {
+        const float data = wgts_abs[static_cast<std::size_t>(fm)];
+        wgts_scale[fm]   = (data > 0.0f) ? (data / wgts_max) : (1.0f); // NOLINT
+    }
+
+    // quantize the weights (symmetric) and sum up their codes for the src zero point
+    hvx::util::WeightsFoldReport report{};
+    std::vector<float> wgts_code(wgts_dim::elms);
+    std::vector<int64_t> wgts_sum(fms, 0);
+    for (int64_t i = 0; i < wgts_dim::elms; ++i) {
+        hvx::util::TensorDimElmsIter<wgts_dim>(ptr_elms, i);
+        const int64_t fm    = ptr_elms.Get(fm_dim);
+        const float code    = hvx::util::Clamp(std::round(wgts[i] / wgts_scale[fm]), -wgts_max, wgts_max); // NOLINT
+        const float error   = std::abs(code * wgts_scale[fm] - wgts[i]);                                     // NOLINT
+        report.wgts.max_err = hvx::util::Max(report.wgts.max_err, error);
+        report.wgts.sum_sqr_err += error * error;
+        ++report.wgts.elms;
+        wgts_code[static_cast<std::size_t>(i)] = code;
+        wgts_sum[static_cast<std::size_t>(fm)] += static_cast<int64_t>(code);
+    }
+    hvx::util::WeightsPack<wgts_dim>(wgts_code.data(), wgts_port);
+
+    // quantize the bias (int32), fold the src zero point into it and compute the requantization
+    for (int64_t fm = 0; fm < fms; ++fm) {
+        const float bias_scale = src_scale * wgts_scale[fm];                 // NOLINT
+        const float data       = (bias != nullptr) ? (bias[fm]) : (0.0f); // NOLINT
+        const float code       = std::round(data / bias_scale);
+        const float error      = std::abs(hvx::util::Clamp(code, bias_lowest, bias_max) * bias_scale - data);
+        report.bias.max_err    = hvx::util::Max(report.bias.max_err, error);
+        report.bias.saturated += ((code < bias_lowest) || (code > bias_max)) ? (1) : (0);
+        report.bias.sum_sqr_err += error * error;
+        ++report.bias.elms;
+
+        // the dst chnls of a vector are packed like the bias
+        bias_type dst{};
+        const auto zero = static_cast<double>(bias_type::src_zero) * static_cast<double>(wgts_sum[static_cast<std::size_t>(fm)]);
+        dst.data        = static_cast<typename bias_type::data_type>(
+            hvx::util::Clamp(static_cast<double>(code) - zero, static_cast<double>(bias_lowest), static_cast<double>(bias_max)));
+        hvx::util::WeightsRequantScale(static_cast<double>(bias_scale) / static_cast<double>(dst_scale), dst);
+        bias_port[fm / bias_dim::vec_size].Set(dst, fm % bias_dim::vec_size); // NOLINT
+    }
+    return report;
+}
+
+/******************************************************************************************************************************************/
+} // namespace util
+} // namespace hvx
+
+#endif // HVX_UTIL_WEIGHTS_PREP_H_
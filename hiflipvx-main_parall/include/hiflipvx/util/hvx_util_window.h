@@ -135,7 +135,8 @@ WinUpdateElms(
     hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, row_buf_cols_, row_buf_rows_>& row_buf,
     hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, src_chnl_vec_elms_, 1>& src_buf,
     hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, src_chnl_vec_elms_, win_buf_cols_*(knl_win_rows_ / src_rows_vec_size_)>& win_buf,
-    hvx::util::array1d<hvx::util::vector<src_type_, src_chnl_vec_size_>, knl_win_rows_ * knl_win_cols_>& win_dil) noexcept -> void {
+    hvx::util::array1d<hvx::util::vector<src_type_, src_chnl_vec_size_>, knl_win_rows_ * knl_win_cols_>& win_dil,
+    src_type_ pad = src_type_{}) noexcept -> void {
     HVX_INLINE_TOP();
 
     // constants
@@ -146,8 +147,10 @@ WinUpdateElms(
     // Read data and write it into window
     for (int64_t knl_dil_row = 0; knl_dil_row < (knl_win_rows_ / src_rows_vec_size_); ++knl_dil_row) {
         for (int64_t knl_dil_col = 0; knl_dil_col < (knl_win_cols_ / src_cols_vec_size_); ++knl_dil_col) {
-            // Used for zero padding
+            // Used for padding (with 0 or the src zero point)
             hvx::util::vector<src_type_, in_vec_size_> data_mid{};
+            for (int64_t ptr = 0; ptr < in_vec_size_; ++ptr)
+                data_mid.Set(pad, ptr);
             hvx::util::array1d<hvx::util::vector<src_type_, src_chnl_vec_size_>, src_rows_vec_size_ * src_cols_vec_size_> data{};
             // Get input from (linebuffer and (src_buf or input))
             if (knl_dil_col == 0) {
@@ -224,20 +227,24 @@ WinUpdateBufs(const int64_t src_col,
               hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, row_buf_cols_, row_buf_rows_>& row_buf,
               hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, src_chnl_vec_elms_, 1>& src_buf,
               hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, src_chnl_vec_elms_, win_buf_cols_ * (knl_win_rows_ / src_rows_vec_size_)>&
-                  win_buf) noexcept -> void {
+                  win_buf,
+              const bool dst_chnl_skip = false) noexcept -> void {
     HVX_INLINE_TOP();
 
     // constants
     constexpr int64_t src_cols  = hvx::util::TensorGetDimElms<src_dim_, 1>();
     constexpr int64_t src_chnls = hvx::util::TensorGetDimElms<src_dim_, 0>();
 
+    // the buffers are updated after the last dst chnl vector (or if the remaining dst chnl vectors are skipped)
+    const bool dst_chnl_last = (dst_chnl_v == (dst_chnl_vec_elms_ - 1)) || dst_chnl_skip;
+
     // Store data from window into (win_buf and (linebuffer or src_buf)
     for (int64_t knl_dil_row = 0; knl_dil_row < (knl_win_rows_ / src_rows_vec_size_); ++knl_dil_row) {
         for (int64_t knl_dil_col = 0; knl_dil_col < (knl_win_cols_ / src_cols_vec_size_); ++knl_dil_col) {
             hvx::util::vector<src_type_, in_vec_size_> data_mid{};
             // Store data into (linebuffer or src_buf)
             if (knl_dil_col == 0) {
-                if (dst_chnl_v == (dst_chnl_vec_elms_ - 1)) {
+                if (dst_chnl_last) {
                     if ((knl_dil_row > 0) && (src_col < src_cols)) {
                         hvx::util::CombineVector<src_type_, src_dim_, knl_dil_rows_, knl_dil_cols_, knl_win_cols_, knl_win_rows_>(
                             knl_dil_row, knl_dil_col, win_dil, data_mid);                     
@@ -255,7 +262,7 @@ WinUpdateBufs(const int64_t src_col,
 
                 // Store data into (win_buf)
             } else {
-                if (dst_chnl_v == (dst_chnl_vec_elms_ - 1)){
+                if (dst_chnl_last){
                     hvx::util::CombineVector<src_type_, src_dim_, knl_dil_rows_, knl_dil_cols_, knl_win_cols_, knl_win_rows_>(
                         knl_dil_row, knl_dil_col, win_dil, data_mid);
                     win_buf.Set(data_mid, src_chnl_v, (knl_dil_row * win_buf_cols_) + (knl_dil_col - 1));
@@ -305,6 +312,28 @@ Over_size() noexcept -> int64_t {
  /*   return ((pad % src_vec_size_)*src_vec_size_);  */
 }
 
+/*!
+ * @brief computes the offset of the selected window in the (newest element first) window buffer: the newest src row/col of the first
+ * src vector that produces a dst minus the last src row/col needed by the last dst row/col of that dst vector
+ */
+template<int64_t knl_dil_size_, int64_t knl_win_size_, int64_t src_vec_size_, int64_t dst_vec_size_, int64_t str_, int64_t pad_>
+HVX_FORCE_INLINE constexpr auto
+WinSelOffset() noexcept -> int64_t {
+    return (((knl_win_size_ - pad_) / src_vec_size_) * src_vec_size_ - 1) - ((dst_vec_size_ - 1) * str_ - pad_ + knl_dil_size_ - 1);
+}
+
+/*!
+ * @brief computes the number of iterations (in src vectors) after the last src vector of a row/col until its last dst vector is computed
+ */
+template<int64_t knl_win_size_, int64_t src_vec_size_, int64_t src_vec_elms_, int64_t dst_vec_size_, int64_t dst_vec_elms_, int64_t str_,
+         int64_t pad_>
+HVX_FORCE_INLINE constexpr auto
+WinOhdLen() noexcept -> int64_t {
+    constexpr int64_t dst_beg = ((knl_win_size_ - pad_) / src_vec_size_) - 1;
+    constexpr int64_t dst_end = dst_beg + (dst_vec_elms_ - 1) * ((dst_vec_size_ * str_) / src_vec_size_) + 1;
+    return hvx::util::Max(dst_end - src_vec_elms_, static_cast<int64_t>(0));
+}
+
 /*!
  * @brief computes the dilated kernel size
  */
@@ -445,7 +474,8 @@ WinDilWinConv(hvx::util::array1d<hvx::util::vector<src_type_, src_chnl_vec_size_
 // }
 
 /*!
- * @brief Updates the window and its buffers
+ * @brief Updates the window and its buffers (dst_chnl_skip: no further dst chnl vectors are computed for this src position, pad: the
+ * value of a padded src element)
  */
 template<typename src_type_,
          typename src_dim_,
@@ -489,16 +519,18 @@ WinUpdate(const int64_t src_row,
           hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, src_chnl_vec_elms_, 1>& src_buf,
           hvx::util::array2d<hvx::util::vector<src_type_, in_vec_size_>, src_chnl_vec_elms_, win_buf_cols_*(knl_win_rows_ / src_rows_vec_size_)>& win_buf,
           hvx::util::array1d<hvx::util::vector<src_type_, src_chnl_vec_size_>, knl_win_cols_ * knl_win_rows_>& win_dil,
-          hvx::util::array1d<hvx::util::vector<src_type_, src_chnl_vec_size_>, knl_sel_cols_ * knl_sel_rows_>& win) noexcept -> void {
+          hvx::util::array1d<hvx::util::vector<src_type_, src_chnl_vec_size_>, knl_sel_cols_ * knl_sel_rows_>& win,
+          const bool dst_chnl_skip = false,
+          const src_type_ pad      = src_type_{}) noexcept -> void {
     HVX_INLINE_TOP();
 
     // Read data and write it into window
     hvx::util::WinUpdateElms<src_type_, src_dim_, ohd_cols, knl_rows_, knl_cols_, knl_dil_rows_, knl_dil_cols_, knl_win_cols_, knl_win_rows_>(
-        src_row, src_col, src_chnl_v, dst_chnl_v, src, row_buf, src_buf, win_buf, win_dil);
+        src_row, src_col, src_chnl_v, dst_chnl_v, src, row_buf, src_buf, win_buf, win_dil, pad);
 
     // Store data from window into (win_buf and (row_buf or src_buf)
     hvx::util::WinUpdateBufs<src_type_, src_dim_, ohd_cols,  knl_dil_rows_, knl_dil_cols_, knl_win_cols_, knl_win_rows_,
-                             dst_chnl_vec_elms_>(src_col, src_chnl_v, dst_chnl_v, win_dil, row_buf, src_buf, win_buf);
+                             dst_chnl_vec_elms_>(src_col, src_chnl_v, dst_chnl_v, win_dil, row_buf, src_buf, win_buf, dst_chnl_skip);
 
     // Convert window into default format
     hvx::util::WinDilWinConv<src_type_, src_dim_, knl_rows_, knl_cols_, dil_rows_, dil_cols_, str_rows_, str_cols_, knl_ovr_rows_,
@@ -551,8 +583,8 @@ WinCompCond(int64_t src_col, int64_t src_row) noexcept -> const WindowCond {
     constexpr int64_t dst_row_beg = ((knl_win_rows - pad_rows_up)/ src_rows_vec)  - 1; 
     //constexpr int64_t dst_col_beg = RoundUp< (knl_win_cols - pad_cols_left), src_cols_vec >() - 1;
     //constexpr int64_t dst_row_beg = RoundUp<(knl_win_rows - pad_rows_up), src_rows_vec>()  - 1; 
-    constexpr int64_t dst_col_end = dst_col_beg + (dst_cols_/ dst_col_vec) * str_cols;
-    constexpr int64_t dst_row_end = dst_row_beg + (dst_rows_/ dst_row_vec) * str_rows; 
+    constexpr int64_t dst_col_end = dst_col_beg + (dst_cols_ * str_cols) / src_cols_vec;
+    constexpr int64_t dst_row_end = dst_row_beg + (dst_rows_ * str_rows) / src_rows_vec;
 
 
     // calculate and return conditions
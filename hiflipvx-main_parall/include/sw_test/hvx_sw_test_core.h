@@ -25,6 +25,7 @@
 #ifndef HVX_SW_TEST_CORE_H_
 #define HVX_SW_TEST_CORE_H_
 
+#include "utils/hvx_sw_bench.h"
 #include "utils/hvx_sw_test_convert.h"
 #include "utils/hvx_sw_test_ew.h"
 #include "utils/hvx_sw_test_nn.h"
@@ -75,12 +76,42 @@ using conv_eval = hvx::sw::ConvEvaluate<param_, eval_>;
 template<typename param_, typename eval_>
 using depthwise_eval = hvx::sw::DepthwiseEvaluate<param_, eval_>;
 
+/*!
+ * @brief Wrapper classe to evaluate the fused depthwise-separable function
+ */
+template<typename param_, typename eval_>
+using separable_eval = hvx::sw::SeparableEvaluate<param_, eval_>;
+
+/*!
+ * @brief Wrapper classe to evaluate the transposed convolution function
+ */
+template<typename param_, typename eval_>
+using transposed_conv_eval = hvx::sw::TransposedConvEvaluate<param_, eval_>;
+
 /*!
  * @brief Wrapper classe to evaluate the dense function
  */
 template<typename param_, typename eval_>
 using dense_eval = hvx::sw::DenseEvaluate<param_, eval_>;
 
+/*!
+ * @brief Wrapper classe to evaluate the matmul function
+ */
+template<typename param_, typename eval_>
+using matmul_eval = hvx::sw::MatMulEvaluate<param_, eval_>;
+
+/*!
+ * @brief Wrapper classe to evaluate the attention function (over a sequence of "calls_" calls)
+ */
+template<typename param_, typename eval_, int64_t calls_>
+using attention_eval = hvx::sw::AttentionEvaluate<param_, eval_, calls_>;
+
+/*!
+ * @brief Wrapper classe to evaluate the recurrent layer (over a sequence of "calls_" calls)
+ */
+template<typename param_, typename eval_, int64_t calls_>
+using rnn_eval = hvx::sw::RnnEvaluate<param_, eval_, calls_>;
+
 /*!
  * @brief Wrapper classe to evaluate the avg pool function
  */
@@ -93,6 +124,24 @@ using pool_avg_eval = hvx::sw::PoolEvaluate<param_, eval_, hvx::util::pooling_e:
 template<typename param_, typename eval_>
 using pool_max_eval = hvx::sw::PoolEvaluate<param_, eval_, hvx::util::pooling_e::kMax>;
 
+/*!
+ * @brief Wrapper classe to evaluate the global avg pool function
+ */
+template<typename param_, typename eval_>
+using global_pool_avg_eval = hvx::sw::GlobalPoolEvaluate<param_, eval_, hvx::util::pooling_e::kAvg>;
+
+/*!
+ * @brief Wrapper classe to evaluate the global max pool function
+ */
+template<typename param_, typename eval_>
+using global_pool_max_eval = hvx::sw::GlobalPoolEvaluate<param_, eval_, hvx::util::pooling_e::kMax>;
+
+/*!
+ * @brief Wrapper classe to evaluate the global sum pool function
+ */
+template<typename param_, typename eval_>
+using global_pool_sum_eval = hvx::sw::GlobalPoolEvaluate<param_, eval_, hvx::util::pooling_e::kSum>;
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -0,0 +1,270 @@
+/**
+ *  Copyright <2024> <Lester Kalms>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the
+ * “Software”), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH
+ * THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * Additional restriction: The Software and its derivatives may not be used for, or in support of, any military purposes.
+ *
+ * @file    hvx_sw_bench.h
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Microbenchmark harness for the C-simulation of the Hw* entry points (warmup, repetitions, statistics, CSV/JSON export).
+ */
+
+#ifndef HVX_SW_BENCH_H_
+#define HVX_SW_BENCH_H_
+
+#include "hvx_sw_test_helper.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace hvx {
+namespace sw {
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief run-time settings of the benchmark suite
+ */
+struct BenchConfig {
+    int64_t warmup = 2;  // NOLINT
+    int64_t reps   = 10; // NOLINT
+    std::string filter;  // NOLINT only layers whose name contains this string are executed
+};
+
+/*!
+ * @brief timing statistics of one benchmark case (all times in nanoseconds)
+ */
+struct BenchResult {
+    std::string layer;       // NOLINT
+    std::string type;        // NOLINT
+    std::string shape;       // NOLINT
+    int64_t vec_size    = 0; // NOLINT
+    int64_t elms        = 0; // NOLINT number of input elements
+    int64_t macs        = 0; // NOLINT multiply-accumulates per call (0 for layers without MACs)
+    int64_t reps        = 0; // NOLINT
+    double min_ns       = 0; // NOLINT
+    double median_ns    = 0; // NOLINT
+    double mean_ns      = 0; // NOLINT
+    double stddev_ns    = 0; // NOLINT
+    double max_ns       = 0; // NOLINT
+    int64_t peak_rss_kb = 0; // NOLINT peak resident set size while the case runs (includes the data of the case)
+
+    /*!
+     * @brief processed elements per second (based on the median)
+     */
+    auto ElmsPerSec() const noexcept -> double {
+        return (median_ns > 0) ? (static_cast<double>(elms) * 1e9 / median_ns) : 0.0;
+    }
+
+    /*!
+     * @brief multiply-accumulates per second (based on the median), 0 for layers without MACs
+     */
+    auto MacsPerSec() const noexcept -> double {
+        return (median_ns > 0) ? (static_cast<double>(macs) * 1e9 / median_ns) : 0.0;
+    }
+
+    /*!
+     * @brief nanoseconds per processed element (based on the median)
+     */
+    auto NsPerElm() const noexcept -> double {
+        return (elms > 0) ? (median_ns / static_cast<double>(elms)) : 0.0;
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief resets the peak resident set size of the process to its current size (Linux only, returns false if it is not supported)
+ */
+auto
+BenchResetPeakRss() noexcept -> bool {
+#if defined(__linux__)
+    std::ofstream file("/proc/self/clear_refs");
+    file << "5";
+    file.flush();
+    return file.good();
+#else
+    return false;
+#endif
+}
+
+/*!
+ * @brief peak resident set size in KiB since the last BenchResetPeakRss (peak of the process if the reset is not supported, 0 if there is
+ * no peak on this platform)
+ */
+auto
+BenchPeakRssKb() noexcept -> int64_t {
+#if defined(__linux__)
+    // the high water mark of the status file is reset by BenchResetPeakRss, ru_maxrss is not
+    std::ifstream file("/proc/self/status");
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::strtoll(line.c_str() + 6, nullptr, 10);
+    }
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#if defined(__APPLE__)
+    return static_cast<int64_t>(usage.ru_maxrss) / 1024; // bytes on macOS
+#else
+    return static_cast<int64_t>(usage.ru_maxrss);
+#endif
+#else
+    return 0;
+#endif
+}
+
+/*!
+ * @brief checks if a benchmark case is selected by the name filter
+ */
+auto
+BenchSelected(const BenchConfig& cfg, const std::string& layer) noexcept -> bool {
+    return cfg.filter.empty() || (layer.find(cfg.filter) != std::string::npos);
+}
+
+/*!
+ * @brief executes a function warmup + reps times and computes the timing statistics of the reps runs
+ */
+template<typename func_>
+auto
+BenchRun(const BenchConfig& cfg,
+         const std::string& layer,
+         const std::string& type,
+         const std::string& shape,
+         int64_t vec_size,
+         int64_t elms,
+         int64_t macs,
+         func_&& func) -> BenchResult {
+    // the peak memory is measured from here on (the data of the case is already allocated)
+    BenchResetPeakRss();
+
+    // warmup (caches, page faults, thread pools)
+    for (int64_t i = 0; i < cfg.warmup; ++i)
+        func();
+
+    // measure every repetition separately
+    const auto reps = hvx::util::Max<int64_t>(cfg.reps, 1);
+    std::vector<double> times(static_cast<size_t>(reps));
+    for (auto& time : times) {
+        const auto t1 = std::chrono::steady_clock::now();
+        func();
+        const auto t2 = std::chrono::steady_clock::now();
+        time          = std::chrono::duration<double, std::nano>(t2 - t1).count();
+    }
+
+    // statistics
+    std::sort(times.begin(), times.end());
+    const auto num  = static_cast<double>(times.size());
+    const auto mean = std::accumulate(times.begin(), times.end(), 0.0) / num;
+    auto var        = 0.0;
+    for (const auto time : times)
+        var += (time - mean) * (time - mean);
+    const auto mid = times.size() / 2;
+
+    BenchResult res;
+    res.layer       = layer;
+    res.type        = type;
+    res.shape       = shape;
+    res.vec_size    = vec_size;
+    res.elms        = elms;
+    res.macs        = macs;
+    res.reps        = reps;
+    res.min_ns      = times.front();
+    res.max_ns      = times.back();
+    res.mean_ns     = mean;
+    res.median_ns   = ((times.size() % 2) == 0) ? (0.5 * (times.at(mid - 1) + times.at(mid))) : times.at(mid);
+    res.stddev_ns   = std::sqrt(var / num);
+    res.peak_rss_kb = BenchPeakRssKb();
+    return res;
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief prints the header of the console table
+ */
+auto
+BenchPrintHeader() noexcept -> void {
+    std::cout << std::left << std::setw(14) << "layer" << std::setw(10) << "type" << std::setw(30) << "shape" << std::right
+              << std::setw(4) << "vec" << std::setw(12) << "median(us)" << std::setw(10) << "sd(us)" << std::setw(10) << "ns/elm"
+              << std::setw(12) << "Melm/s" << std::setw(12) << "MMAC/s" << std::setw(12) << "rss(KiB)" << "\n";
+}
+
+/*!
+ * @brief prints one result as a row of the console table
+ */
+auto
+BenchPrint(const BenchResult& res) noexcept -> void {
+    std::cout << std::left << std::setw(14) << res.layer << std::setw(10) << res.type << std::setw(30) << res.shape << std::right
+              << std::setw(4) << res.vec_size << std::fixed << std::setprecision(2) << std::setw(12) << res.median_ns * 1e-3
+              << std::setw(10) << res.stddev_ns * 1e-3 << std::setw(10) << res.NsPerElm() << std::setw(12) << res.ElmsPerSec() * 1e-6
+              << std::setw(12) << res.MacsPerSec() * 1e-6 << std::setw(12) << res.peak_rss_kb << "\n";
+}
+
+/*!
+ * @brief writes all results into a CSV file (one row per case)
+ */
+auto
+BenchWriteCsv(const std::string& path, const std::vector<BenchResult>& results) -> bool {
+    std::ofstream file(path);
+    if (!file.is_open())
+        return false;
+    file << "layer,type,shape,vec_size,elms,macs,reps,min_ns,median_ns,mean_ns,stddev_ns,max_ns,ns_per_elm,elms_per_s,macs_per_s,"
+            "peak_rss_kb\n";
+    file << std::setprecision(10);
+    for (const auto& res : results) {
+        file << res.layer << "," << res.type << ",\"" << res.shape << "\"," << res.vec_size << "," << res.elms << "," << res.macs << ","
+             << res.reps << "," << res.min_ns << "," << res.median_ns << "," << res.mean_ns << "," << res.stddev_ns << "," << res.max_ns
+             << "," << res.NsPerElm() << "," << res.ElmsPerSec() << "," << res.MacsPerSec() << "," << res.peak_rss_kb << "\n";
+    }
+    return true;
+}
+
+/*!
+ * @brief writes all results into a JSON file (array of objects)
+ */
+auto
+BenchWriteJson(const std::string& path, const std::vector<BenchResult>& results) -> bool {
+    std::ofstream file(path);
+    if (!file.is_open())
+        return false;
+    file << "[\n" << std::setprecision(10);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& res = results.at(i);
+        file << "  {\"layer\": \"" << res.layer << "\", \"type\": \"" << res.type << "\", \"shape\": \"" << res.shape
+             << "\", \"vec_size\": " << res.vec_size << ", \"elms\": " << res.elms << ", \"macs\": " << res.macs
+             << ", \"reps\": " << res.reps << ", \"min_ns\": " << res.min_ns << ", \"median_ns\": " << res.median_ns
+             << ", \"mean_ns\": " << res.mean_ns << ", \"stddev_ns\": " << res.stddev_ns << ", \"max_ns\": " << res.max_ns
+             << ", \"ns_per_elm\": " << res.NsPerElm() << ", \"elms_per_s\": " << res.ElmsPerSec()
+             << ", \"macs_per_s\": " << res.MacsPerSec() << ", \"peak_rss_kb\": " << res.peak_rss_kb << "}"
+             << ((i + 1 < results.size()) ? ",\n" : "\n");
+    }
+    file << "]\n";
+    return true;
+}
+
+/******************************************************************************************************************************************/
+} // namespace sw
+} // namespace hvx
+
+#endif // HVX_SW_BENCH_H_
@@ -220,15 +220,17 @@ EvalCreateRndSrc(src_port_* src_hw_, float* src_sw_, const float upper = 1.f) no
 /******************************************************************************************************************************************/
 
 /*!
- * @brief Convert to floating point from an integer data type
+ * @brief Convert to floating point from an integer data type (vectors over multiple dimensions are unpacked like in EvalCreateRndSrc)
  */
 template<typename dst_type_, typename dim_, int64_t dst_flags>
 auto
 ConvertDstHwToFloat(hvx::util::vector<dst_type_, dim_::vec_size>& src, float* dst_hw_flt) noexcept -> void {
-    for (int64_t v = 0; v < dim_::vec_elms; ++v) {
-        for (int64_t p = 0; p < dim_::vec_size; ++p) {
-            dst_hw_flt[v * dim_::vec_size + p] = static_cast<float>((&src)[v].Get(p)); // NOLINT
-        }
+    hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{}, ptr_elms_v{}, ptr_elms_p{};
+    for (int64_t i = 0; i < dim_::elms; ++i) {
+        hvx::util::TensorDimVecElmsIter<dim_>(ptr_elms, ptr_elms_v, ptr_elms_p, i);
+        auto& vec                                            = (&src)[hvx::util::TensorPtrElmsV<dim_>(ptr_elms_v)]; // NOLINT
+        const auto hw_dst                                    = vec.Get(hvx::util::TensorPtrElmsP<dim_>(ptr_elms_p));
+        dst_hw_flt[hvx::util::TensorPtrElms<dim_>(ptr_elms)] = static_cast<float>(hw_dst); // NOLINT
     }
 }
 //xwq
@@ -124,6 +124,206 @@ public:
         hvx::sw::ConvertDstHwToFloat<dst_type_, dst_dim_, eval_::dst_flags>(*dst_hw_, dst_hw_flt_.data());
         return hvx::sw::EvalPrintDiff<dst_dim_, eval_>(dst_sw_.data(), dst_hw_flt_.data());
     }
+
+    /*!
+     * @brief checks if the HW result equals the SW result (only for data that both represent exactly, e.g. small integers)
+     */
+    auto IsExact() noexcept -> bool {
+        hvx::sw::ConvertDstHwToFloat<dst_type_, dst_dim_, eval_::dst_flags>(*dst_hw_, dst_hw_flt_.data());
+        return dst_hw_flt_ == dst_sw_;
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Wrapper classe to evaluate the convolution function followed by a BatchNorm, which is folded into the weights and bias
+ */
+template<typename param_, typename eval_>
+class ConvBatchNormEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src_type,
+                        typename param_::src_dim,
+                        typename param_::src_port,
+                        typename param_::dst_type,
+                        typename param_::dst_dim,
+                        typename param_::dst_port,
+                        typename param_::wgts_type,
+                        typename param_::wgts_dim,
+                        typename param_::wgts_port,
+                        typename param_::bias_type,
+                        typename param_::bias_dim,
+                        typename param_::bias_port> {
+private:
+    // statistics and affine parameters of the BatchNorm
+    std::vector<float> gamma_, beta_, mean_, var_;
+    static constexpr float eps_ = 1e-5f;
+
+    // requantization error of the folded weights and bias
+    hvx::util::WeightsFoldReport report_{};
+
+    /*!
+     * @brief fills a vector with random values between (lower,upper)
+     */
+    static auto RandomValues(std::vector<float>& dst, float lower, float upper) noexcept -> void {
+        std::mt19937 rng(std::random_device{}());
+        std::uniform_real_distribution<float> distribution(lower, upper);
+        for (auto& data: dst)
+            data = distribution(rng);
+    }
+
+    /*!
+     * @brief SW function (convolution with bias, then the BatchNorm on the output feature maps)
+     */
+    static constexpr auto SwConvBatchNorm(float* src, float* wgts, float* bias, float* dst, float* gamma, float* beta, float* mean,
+                                          float* var) noexcept -> void {
+        hvx::sw::SwConv<param_, true>(src, wgts, bias, dst);
+        for (int64_t i = 0; i < param_::dst_dim::elms; ++i) {
+            const int64_t fm = i % param_::fms;
+            dst[i]           = (dst[i] - mean[fm]) * gamma[fm] / std::sqrt(var[fm] + eps_) + beta[fm]; // NOLINT
+        }
+    }
+
+public:
+
+    /*!
+     * @brief constructor (the BatchNorm keeps the results in the range of the unsigned types, if the weights are unsigned)
+     */
+    ConvBatchNormEvaluate(float conv_max, float bias_max) {
+        const bool is_signed = param_::wgts_type::is_signed;
+        const float upper    = conv_max / static_cast<float>(param_::knl_elms * param_::chnls);
+        gamma_.resize(param_::fms);
+        beta_.resize(param_::fms);
+        mean_.resize(param_::fms);
+        var_.resize(param_::fms);
+
+        // create random data, the unfolded weights and bias are only used by the SW function
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, typename param_::src_dim>(this->src_hw_.data(), this->src_sw_.data());
+        RandomValues(this->wgts_sw_, is_signed ? -upper : 0.0f, upper);
+        RandomValues(this->bias_sw_, is_signed ? -bias_max : 0.0f, bias_max);
+        RandomValues(gamma_, 0.5f, 1.0f);
+        RandomValues(beta_, is_signed ? -0.1f : 0.0f, 0.1f);
+        RandomValues(mean_, is_signed ? -0.1f : 0.0f, is_signed ? 0.1f : 0.0f);
+        RandomValues(var_, 0.8f, 1.6f);
+
+        // fold and pack the weights and bias for the HW
+        report_ = hvx::util::WeightsFoldBatchNorm<param_>(this->wgts_sw_.data(), this->bias_sw_.data(), gamma_.data(), beta_.data(),
+                                                          mean_.data(), var_.data(), eps_, this->wgts_hw_.data(), this->bias_hw_.data());
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwConvBatchNorm, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 this->bias_sw_.data(), this->dst_sw_.data(), gamma_.data(), beta_.data(), mean_.data(), var_.data());
+    }
+
+    /*!
+     * @brief the requantization error of the folded weights and bias
+     */
+    auto GetReport() const noexcept -> const hvx::util::WeightsFoldReport& {
+        return report_;
+    }
+
+    /*!
+     * @brief folds the same BatchNorm into the weights and bias of a Winograd conv with the same kernel (transformed after the fold)
+     */
+    template<typename wino_>
+    auto FoldWinograd(typename wino_::wgts_port* wgts, typename wino_::bias_port* bias) noexcept -> hvx::util::WeightsFoldReport {
+        return hvx::util::WeightsFoldBatchNorm<wino_>(this->wgts_sw_.data(), this->bias_sw_.data(), gamma_.data(), beta_.data(),
+                                                      mean_.data(), var_.data(), eps_, wgts, bias);
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Wrapper classe to evaluate the per-channel quantized convolution function (the weights and bias are quantized by
+ * WeightsQuantizePerChannel, the SW function uses the same codes and requantization, so HW and SW are expected to be bit exact)
+ */
+template<typename param_, typename eval_>
+class ConvRequantEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src_type,
+                        typename param_::src_dim,
+                        typename param_::src_port,
+                        typename param_::dst_type,
+                        typename param_::dst_dim,
+                        typename param_::dst_port,
+                        typename param_::wgts_type,
+                        typename param_::wgts_dim,
+                        typename param_::wgts_port,
+                        typename param_::bias_type,
+                        typename param_::bias_dim,
+                        typename param_::bias_port> {
+private:
+    // weights scale of each dst fm
+    std::vector<float> wgts_scale_;
+
+    // quantization error of the weights and bias
+    hvx::util::WeightsFoldReport report_{};
+
+    /*!
+     * @brief SW function
+     */
+    static constexpr auto SwConvRequant(float* src, float* wgts, float* bias, typename param_::bias_port* requant, float* dst) noexcept
+        -> void {
+        hvx::sw::SwConvRequant<param_>(src, wgts, bias, requant, dst);
+    }
+
+public:
+
+    /*!
+     * @brief constructor (the src are random codes, the real weights of a dst fm are between (-wgts_max,wgts_max) times a factor of the fm)
+     */
+    ConvRequantEvaluate(float src_scale, float dst_scale, float wgts_max, float bias_max) {
+        using src_data = typename param_::src_type::data_type;
+        using wgts_dim = typename param_::wgts_dim;
+        wgts_scale_.resize(param_::fms);
+
+        // create random src codes (the SW gets the truncated codes of the HW)
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, typename param_::src_dim>(
+            this->src_hw_.data(), this->src_sw_.data(), static_cast<float>(std::numeric_limits<src_data>::max()));
+        for (auto& data: this->src_sw_)
+            data = std::trunc(data);
+
+        // create random real weights (a different range for each dst fm) and bias
+        std::mt19937 rng(std::random_device{}());
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{};
+        for (int64_t i = 0; i < wgts_dim::elms; ++i) {
+            hvx::util::TensorDimElmsIter<wgts_dim>(ptr_elms, i);
+            const auto fm = static_cast<float>(ptr_elms.Get(wgts_dim::dim_num - 1) + 1);
+            auto& data    = this->wgts_sw_.at(static_cast<std::size_t>(i));
+            data          = distribution(rng) * wgts_max * fm / static_cast<float>(param_::fms);
+        }
+        for (auto& data: this->bias_sw_)
+            data = distribution(rng) * bias_max;
+
+        // quantize and pack the weights and bias for the HW
+        report_ = hvx::util::WeightsQuantizePerChannel<param_>(this->wgts_sw_.data(), this->bias_sw_.data(), src_scale, dst_scale,
+                                                               this->wgts_hw_.data(), this->bias_hw_.data(), wgts_scale_.data());
+
+        // the SW uses the weights codes and the bias codes without the src zero point
+        hvx::sw::ConvertDstHwToFloat<typename param_::wgts_type, wgts_dim, 0>(this->wgts_hw_.at(0), this->wgts_sw_.data());
+        for (int64_t fm = 0; fm < param_::fms; ++fm) {
+            auto& data = this->bias_sw_.at(static_cast<std::size_t>(fm));
+            data       = std::round(data / (src_scale * wgts_scale_.at(static_cast<std::size_t>(fm))));
+        }
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwConvRequant, this->src_sw_.data(),
+                                 this->wgts_sw_.data(), this->bias_sw_.data(), this->bias_hw_.data(), this->dst_sw_.data());
+    }
+
+    /*!
+     * @brief the quantization error of the weights and bias
+     */
+    auto GetReport() const noexcept -> const hvx::util::WeightsFoldReport& {
+        return report_;
+    }
+
+    /*!
+     * @brief if the dst codes of the HW and the integer SW reference are equal
+     */
+    auto IsExact() noexcept -> bool {
+        hvx::sw::ConvertDstHwToFloat<typename param_::dst_type, typename param_::dst_dim, eval_::dst_flags>(*this->dst_hw_,
+                                                                                                          this->dst_hw_flt_.data());
+        return this->dst_hw_flt_ == this->dst_sw_;
+    }
 };
 
 /******************************************************************************************************************************************/
@@ -274,34 +474,20 @@ private:
         std::mt19937 rng(std::random_device{}());
         std::uniform_real_distribution<float> distribution(lower, upper);
 
-        // feature maps
-        for (int64_t fmv = 0; fmv < param_::fm_vec_elms; ++fmv) {
-            for (int64_t fmp = 0; fmp < param_::fm_vec_size; ++fmp) {
-                const int64_t fm = (fmv * param_::fm_vec_size) + fmp;
+        // loop pointers of the weights tensor (the kernel can be partially vectorized, so the vectors are packed like in EvalCreateRndSrc)
+        using wgts_dim = typename param_::wgts_dim;
+        hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{}, ptr_elms_v{}, ptr_elms_p{};
 
-                // channels
-                for (int64_t chnlv = 0; chnlv < param_::chnl_vec_elms; ++chnlv) {
-                    for (int64_t chnlp = 0; chnlp < param_::chnl_vec_size; ++chnlp) {
-                        const int64_t chnl = (chnlv * param_::chnl_vec_size) + chnlp;
+        for (int64_t i = 0; i < wgts_dim::elms; ++i) {
+            hvx::util::TensorDimVecElmsIter<wgts_dim>(ptr_elms, ptr_elms_v, ptr_elms_p, i);
 
-                        // kernel
-                        for (int64_t knl_row = 0; knl_row < param_::knl_rows; ++knl_row) {
-                            for (int64_t knl_col = 0; knl_col < param_::knl_cols; ++knl_col) {
-                                const int64_t knl = (knl_row * param_::knl_cols) + knl_col;
-
-                                // software
-                                const auto sw_wgt = distribution(rng);
-                                this->wgts_sw_.at((fm * param_::chnls * param_::knl_elms) + (chnl * param_::knl_elms) + knl) = sw_wgt;
-
-                                // hardware
-                                auto hw_wgt = static_cast<typename param_::wgts_type>(sw_wgt);
-                                this->wgts_hw_.at((fmv * param_::chnl_vec_elms) + chnlv)
-                                    .Set(hw_wgt, (fmp * param_::chnl_vec_size * param_::knl_elms) + (chnlp * param_::knl_elms) + knl);
-                            }
-                        }
-                    }
-                }
-            }
+            // software
+            const auto sw_wgt                                               = distribution(rng);
+            this->wgts_sw_.at(hvx::util::TensorPtrElms<wgts_dim>(ptr_elms)) = sw_wgt;
+
+            // hardware
+            auto hw_wgt = static_cast<typename param_::wgts_type>(sw_wgt);
+            this->wgts_hw_.at(hvx::util::TensorPtrElmsV<wgts_dim>(ptr_elms_v)).Set(hw_wgt, hvx::util::TensorPtrElmsP<wgts_dim>(ptr_elms_p));
         }
     }
 
@@ -459,6 +645,409 @@ public:
 
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief Wrapper classe to evaluate the fused depthwise-separable function (the wgts/bias of the core class belong to the depthwise
+ * stage, the ones of the pointwise stage are stored separately)
+ */
+template<typename param_, typename eval_>
+class SeparableEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src_type,
+                        typename param_::src_dim,
+                        typename param_::src_port,
+                        typename param_::dst_type,
+                        typename param_::dst_dim,
+                        typename param_::dst_port,
+                        typename param_::wgts_type,
+                        typename param_::dw_wgts_dim,
+                        typename param_::dw_wgts_port,
+                        typename param_::bias_type,
+                        typename param_::dw_bias_dim,
+                        typename param_::dw_bias_port> {
+private:
+
+    // hw/sw containers of the pointwise stage
+    std::vector<typename param_::pw_wgts_port> pw_wgts_hw_; // NOLINT
+    std::vector<typename param_::pw_bias_port> pw_bias_hw_; // NOLINT
+    std::vector<float> pw_wgts_sw_;                         // NOLINT
+    std::vector<float> pw_bias_sw_;                         // NOLINT
+
+    /*!
+     * @brief create random values between (upper,-upper) for signed or (upper,0) for unsigned (packed like in EvalCreateRndSrc)
+     */
+    template<typename type_, typename dim_, typename port_>
+    static auto RandomTensor(const float upper, std::vector<port_>& hw, std::vector<float>& sw) noexcept -> void {
+        const float lower = (type_::is_signed == true) ? (-upper) : (0.0f);
+
+        //
+        std::mt19937 rng(std::random_device{}());
+        std::uniform_real_distribution<float> distribution(lower, upper);
+
+        // loop pointers of the tensor
+        hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{}, ptr_elms_v{}, ptr_elms_p{};
+
+        for (int64_t i = 0; i < dim_::elms; ++i) {
+            hvx::util::TensorDimVecElmsIter<dim_>(ptr_elms, ptr_elms_v, ptr_elms_p, i);
+
+            // software
+            const auto sw_val                                 = distribution(rng);
+            sw.at(hvx::util::TensorPtrElms<dim_>(ptr_elms)) = sw_val;
+
+            // hardware
+            auto hw_val = static_cast<type_>(sw_val);
+            hw.at(hvx::util::TensorPtrElmsV<dim_>(ptr_elms_v)).Set(hw_val, hvx::util::TensorPtrElmsP<dim_>(ptr_elms_p));
+        }
+    }
+
+    /*!
+     * @brief create random weights (and biases) of both stages
+     */
+    auto RandomParams(const float wgts_max, const float bias_max) noexcept -> void {
+        using wgts_type = typename param_::wgts_type;
+        using bias_type = typename param_::bias_type;
+        RandomTensor<wgts_type, typename param_::dw_wgts_dim>(wgts_max / static_cast<float>(param_::knl_elms), this->wgts_hw_,
+                                                              this->wgts_sw_);
+        RandomTensor<wgts_type, typename param_::pw_wgts_dim>(wgts_max / static_cast<float>(param_::chnls), pw_wgts_hw_, pw_wgts_sw_);
+        if (bias_max > 0.0f) {
+            RandomTensor<bias_type, typename param_::dw_bias_dim>(bias_max, this->bias_hw_, this->bias_sw_);
+            RandomTensor<bias_type, typename param_::pw_bias_dim>(bias_max, pw_bias_hw_, pw_bias_sw_);
+        }
+    }
+
+    /*!
+     * @brief SW function (with Bias)
+     */
+    static constexpr auto SwSeparableWithBias(float* src, float* dw_wgts, float* dw_bias, float* pw_wgts, float* pw_bias,
+                                              float* dst) noexcept -> void {
+        hvx::sw::SwSeparable<param_, true>(src, dw_wgts, dw_bias, pw_wgts, pw_bias, dst);
+    }
+
+    /*!
+     * @brief SW function (without Bias)
+     */
+    static constexpr auto SwSeparableWithoutBias(float* src, float* dw_wgts, float* pw_wgts, float* dst) noexcept -> void {
+        hvx::sw::SwSeparable<param_, false>(src, dw_wgts, nullptr, pw_wgts, nullptr, dst);
+    }
+
+    /*!
+     * @brief allocates the containers of the pointwise stage
+     */
+    auto ResizePointwise() noexcept -> void {
+        pw_wgts_hw_.resize(param_::pw_wgts_dim::vec_elms);
+        pw_bias_hw_.resize(param_::pw_bias_dim::vec_elms);
+        pw_wgts_sw_.resize(param_::pw_wgts_dim::elms);
+        pw_bias_sw_.resize(param_::pw_bias_dim::elms);
+    }
+
+public:
+
+    /*!
+     * @brief constructor (without bias)
+     */
+    SeparableEvaluate(float conv_max) {
+        ResizePointwise();
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, typename param_::src_dim>(this->src_hw_.data(), this->src_sw_.data());
+        RandomParams(conv_max, 0.0f);
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwSeparableWithoutBias, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 pw_wgts_sw_.data(), this->dst_sw_.data());
+    }
+
+    /*!
+     * @brief constructor (with bias)
+     */
+    SeparableEvaluate(float conv_max, float bias_max) {
+        ResizePointwise();
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, typename param_::src_dim>(this->src_hw_.data(), this->src_sw_.data());
+        RandomParams(conv_max, bias_max);
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwSeparableWithBias, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 this->bias_sw_.data(), pw_wgts_sw_.data(), pw_bias_sw_.data(), this->dst_sw_.data());
+    }
+
+    auto GetPwWgtsHw() noexcept -> typename param_::pw_wgts_port* {
+        return pw_wgts_hw_.data();
+    }
+
+    auto GetPwBiasHw() noexcept -> typename param_::pw_bias_port* {
+        return pw_bias_hw_.data();
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Wrapper classe to evaluate the transposed convolution function
+ */
+template<typename param_, typename eval_>
+class TransposedConvEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src_type,
+                        typename param_::src_dim,
+                        typename param_::src_port,
+                        typename param_::dst_type,
+                        typename param_::dst_dim,
+                        typename param_::dst_port,
+                        typename param_::wgts_type,
+                        typename param_::wgts_dim,
+                        typename param_::wgts_port,
+                        typename param_::bias_type,
+                        typename param_::bias_dim,
+                        typename param_::bias_port> {
+private:
+
+    /*!
+     * @brief create random weights between (upper,-1) for signed or (upper,0) for unsigned (a dst element sums up one phase of the kernel)
+     */
+    auto RandomWeights(const float wgts_max) noexcept -> void {
+        // upper/lower boundary for values
+        const float upper = wgts_max / static_cast<float>(param_::sub_knl_elms * param_::chnls);
+        const float lower = (param_::wgts_type::is_signed == true) ? (-upper) : (0.0f);
+
+        //
+        std::mt19937 rng(std::random_device{}());
+        std::uniform_real_distribution<float> distribution(lower, upper);
+
+        // loop pointers of the weights tensor
+        using wgts_dim = typename param_::wgts_dim;
+        hvx::util::vector<int64_t, hvx::util::limits_e::kTensorDimMax> ptr_elms{}, ptr_elms_v{}, ptr_elms_p{};
+
+        for (int64_t i = 0; i < wgts_dim::elms; ++i) {
+            hvx::util::TensorDimVecElmsIter<wgts_dim>(ptr_elms, ptr_elms_v, ptr_elms_p, i);
+
+            // software
+            const auto sw_wgt                                               = distribution(rng);
+            this->wgts_sw_.at(hvx::util::TensorPtrElms<wgts_dim>(ptr_elms)) = sw_wgt;
+
+            // hardware
+            auto hw_wgt = static_cast<typename param_::wgts_type>(sw_wgt);
+            this->wgts_hw_.at(hvx::util::TensorPtrElmsV<wgts_dim>(ptr_elms_v)).Set(hw_wgt, hvx::util::TensorPtrElmsP<wgts_dim>(ptr_elms_p));
+        }
+    }
+
+    /*!
+     * @brief SW function (with Bias)
+     */
+    static constexpr auto SwTransposedConvWithBias(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
+        hvx::sw::SwTransposedConv<param_, true>(src, wgts, bias, dst);
+    }
+
+    /*!
+     * @brief SW function (without Bias)
+     */
+    static constexpr auto SwTransposedConvWithoutBias(float* src, float* wgts, float* dst) noexcept -> void {
+        hvx::sw::SwTransposedConv<param_, false>(src, wgts, nullptr, dst);
+    }
+
+public:
+
+    /*!
+     * @brief constructor (without bias)
+     */
+    TransposedConvEvaluate(float conv_max) {
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, typename param_::src_dim>(this->src_hw_.data(), this->src_sw_.data());
+        RandomWeights(conv_max);
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwTransposedConvWithoutBias, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 this->dst_sw_.data());
+    }
+
+    /*!
+     * @brief constructor (with bias)
+     */
+    TransposedConvEvaluate(float conv_max, float bias_max) {
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, typename param_::src_dim>(this->src_hw_.data(), this->src_sw_.data());
+        this->RandomBiases(bias_max);
+        RandomWeights(conv_max);
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwTransposedConvWithBias, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 this->bias_sw_.data(), this->dst_sw_.data());
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Wrapper classe to evaluate the matmul function (src2 is stored in the weights containers)
+ */
+template<typename param_, typename eval_>
+class MatMulEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src1_type,
+                        typename param_::src1_dim,
+                        typename param_::src1_port,
+                        typename param_::dst_type,
+                        typename param_::dst_dim,
+                        typename param_::dst_port,
+                        typename param_::src2_type,
+                        typename param_::src2_dim,
+                        typename param_::src2_port> {
+private:
+
+    /*!
+     * @brief SW function
+     */
+    static constexpr auto SwMatMul(float* src1, float* src2, float* dst) noexcept -> void {
+        hvx::sw::SwMatMul<param_>(src1, src2, dst);
+    }
+
+public:
+
+    /*!
+     * @brief constructor (the values of src2 are scaled by the inner dimension to keep the dot products in range)
+     */
+    constexpr MatMulEvaluate(float src2_max) {
+        hvx::sw::EvalCreateRndSrc<typename param_::src1_port, typename param_::src1_dim>(this->src_hw_.data(), this->src_sw_.data());
+        hvx::sw::EvalCreateRndSrc<typename param_::src2_port, typename param_::src2_dim>(
+            this->wgts_hw_.data(), this->wgts_sw_.data(), src2_max / static_cast<float>(param_::inner));
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwMatMul, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 this->dst_sw_.data());
+    }
+
+    constexpr auto GetSrc1Hw() noexcept -> typename param_::src1_port* {
+        return this->src_hw_.data();
+    }
+
+    constexpr auto GetSrc2Hw() noexcept -> typename param_::src2_port* {
+        return this->wgts_hw_.data();
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Wrapper classe to evaluate the recurrent layer (LSTM or GRU) over a sequence of "calls_" calls
+ */
+template<typename param_,
+         typename eval_,
+         int64_t calls_,
+         typename src_dim_ = hvx::util::TensorParam<3,
+                                                    typename param_::src_dim::dim0,
+                                                    typename param_::src_dim::dim1,
+                                                    hvx::util::VectorParam<param_::seq * calls_, 1>>,
+         typename dst_dim_ = hvx::util::TensorParam<3,
+                                                    typename param_::dst_dim::dim0,
+                                                    typename param_::dst_dim::dim1,
+                                                    hvx::util::VectorParam<param_::seq * calls_, 1>>>
+class RnnEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src_type,
+                        src_dim_,
+                        typename param_::src_port,
+                        typename param_::dst_type,
+                        dst_dim_,
+                        typename param_::dst_port,
+                        typename param_::wgts_type,
+                        typename param_::wgts_dim,
+                        typename param_::wgts_port,
+                        typename param_::bias_type,
+                        typename param_::bias_dim,
+                        typename param_::bias_port> {
+private:
+
+    /*!
+     * @brief SW function
+     */
+    static constexpr auto SwRnn(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
+        hvx::sw::SwRnn<param_, param_::seq * calls_>(src, wgts, bias, dst);
+    }
+
+public:
+
+    /*!
+     * @brief constructor (the weights are scaled by the size of the concatenated input to keep the gates in range)
+     */
+    RnnEvaluate(float wgts_max) {
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, src_dim_>(this->src_hw_.data(), this->src_sw_.data());
+        hvx::sw::EvalCreateRndSrc<typename param_::wgts_port, typename param_::wgts_dim>(
+            this->wgts_hw_.data(), this->wgts_sw_.data(), wgts_max / std::sqrt(static_cast<float>(param_::inner)));
+        hvx::sw::EvalCreateRndSrc<typename param_::bias_port, typename param_::bias_dim>(this->bias_hw_.data(), this->bias_sw_.data(),
+                                                                                         0.5f);
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwRnn, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 this->bias_sw_.data(), this->dst_sw_.data());
+    }
+
+    /*!
+     * @brief the src/dst vectors of a call
+     */
+    constexpr auto GetSrcHw(int64_t call) noexcept -> typename param_::src_port* {
+        return this->src_hw_.data() + call * param_::src_dim::vec_elms;
+    }
+
+    constexpr auto GetDstHw(int64_t call) noexcept -> typename param_::dst_port* {
+        return this->dst_hw_ + call * param_::dst_dim::vec_elms;
+    }
+};
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief Wrapper classe to evaluate the attention function over a sequence of "calls_" calls (query, key and value are stored in the
+ * src, weights and bias containers)
+ */
+template<typename param_,
+         typename eval_,
+         int64_t calls_,
+         typename seq_dim_ = hvx::util::TensorParam<3,
+                                                    typename param_::src_dim::dim0,
+                                                    typename param_::src_dim::dim1,
+                                                    hvx::util::VectorParam<param_::tokens * calls_, 1>>>
+class AttentionEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src_type,
+                        seq_dim_,
+                        typename param_::src_port,
+                        typename param_::dst_type,
+                        seq_dim_,
+                        typename param_::dst_port,
+                        typename param_::src_type,
+                        seq_dim_,
+                        typename param_::src_port,
+                        typename param_::src_type,
+                        seq_dim_,
+                        typename param_::src_port> {
+private:
+
+    /*!
+     * @brief SW function
+     */
+    static constexpr auto SwAttention(float* q, float* k, float* v, float* dst) noexcept -> void {
+        hvx::sw::SwAttention<param_, param_::tokens * calls_>(q, k, v, dst);
+    }
+
+public:
+
+    /*!
+     * @brief constructor
+     */
+    AttentionEvaluate() {
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, seq_dim_>(this->src_hw_.data(), this->src_sw_.data());
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, seq_dim_>(this->wgts_hw_.data(), this->wgts_sw_.data());
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, seq_dim_>(this->bias_hw_.data(), this->bias_sw_.data());
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwAttention, this->src_sw_.data(), this->wgts_sw_.data(),
+                                 this->bias_sw_.data(), this->dst_sw_.data());
+    }
+
+    /*!
+     * @brief the src/dst vectors of a call
+     */
+    static constexpr auto call_vec_elms = param_::src_dim::vec_elms;
+
+    constexpr auto GetQHw(int64_t call) noexcept -> typename param_::src_port* {
+        return this->src_hw_.data() + call * call_vec_elms;
+    }
+
+    constexpr auto GetKHw(int64_t call) noexcept -> typename param_::src_port* {
+        return this->wgts_hw_.data() + call * call_vec_elms;
+    }
+
+    constexpr auto GetVHw(int64_t call) noexcept -> typename param_::src_port* {
+        return this->bias_hw_.data() + call * call_vec_elms;
+    }
+
+    constexpr auto GetDstHw(int64_t call) noexcept -> typename param_::dst_port* {
+        return this->dst_hw_ + call * call_vec_elms;
+    }
+};
+
+/******************************************************************************************************************************************/
+
 /*!
  * @brief Wrapper classe to evaluate the pool function
  */
@@ -501,6 +1090,40 @@ public:
 
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief Wrapper classe to evaluate the global pool function
+ */
+template<typename param_, typename eval_, hvx::util::pooling_e pool_type_>
+class GlobalPoolEvaluate:
+    public EvaluateCore<eval_,
+                        typename param_::src_type,
+                        typename param_::src_dim,
+                        typename param_::src_port,
+                        typename param_::dst_type,
+                        typename param_::dst_dim,
+                        typename param_::dst_port> {
+private:
+
+    /*!
+     * @brief SW function
+     */
+    static constexpr auto SwGlobalPool(float* src, float* dst) noexcept -> void {
+        hvx::sw::SwGlobalPool<param_, pool_type_>(src, dst);
+    }
+
+public:
+
+    /*!
+     * @brief constructor
+     */
+    constexpr GlobalPoolEvaluate() {
+        hvx::sw::EvalCreateRndSrc<typename param_::src_port, typename param_::src_dim>(this->src_hw_.data(), this->src_sw_.data());
+        hvx::sw::MeasureFuncTime(eval_::dbg, "SW", eval_::rept, SwGlobalPool, this->src_sw_.data(), this->dst_sw_.data());
+    }
+};
+
+/******************************************************************************************************************************************/
+
 /*!
  * @brief Wrapper classe to evaluate the softmax function
  */
@@ -74,6 +74,34 @@ SwPool(const float* src, float* dst) noexcept -> void {
     }
 }
 
+/*!
+ * @brief SW function of the global pooling layer
+ */
+template<typename param_, hvx::util::pooling_e pool_type_>
+HVX_FORCE_INLINE constexpr auto
+SwGlobalPool(const float* src, float* dst) noexcept -> void {
+    for (int64_t batch = 0; batch < param_::batch; ++batch) {
+        for (int64_t chnl = 0; chnl < param_::chnls; ++chnl) {
+            // initialize pooling
+            float result = (pool_type_ == hvx::util::pooling_e::kMax) ? (std::numeric_limits<float>::lowest()) : (0.0f);
+
+            // compute pooling over all pixels
+            for (int64_t src_row = 0; src_row < param_::src_rows; ++src_row) {
+                for (int64_t src_col = 0; src_col < param_::src_cols; ++src_col) {
+                    const float data = src[hvx::util::TensorGetPtr<typename param_::src_dim>(batch, src_row, src_col, chnl)]; // NOLINT
+                    result = (pool_type_ == hvx::util::pooling_e::kMax) ? (hvx::util::Max(result, data)) : (result + data);
+                }
+            }
+
+            // compute average pooling
+            result = (pool_type_ == hvx::util::pooling_e::kAvg) ? (result / static_cast<float>(param_::pixels)) : (result);
+
+            // write output
+            dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, chnl)] = result; // NOLINT
+        }
+    }
+}
+
 //template<typename param_, hvx::util::pooling_e pool_type_>
 //HVX_FORCE_INLINE constexpr auto
 //SwPool(const float* src, float* dst) noexcept -> void {
@@ -116,6 +144,20 @@ SwPool(const float* src, float* dst) noexcept -> void {
 
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief SW function of the fused epilogue of the conv/depthwise/dense layer: act(result * scale + shift)
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+SwEpilogue(float result) noexcept -> float {
+    using epilogue   = typename param_::epilogue;
+    const float arg1 = static_cast<float>(epilogue::arg1::num) / static_cast<float>(epilogue::arg1::den);
+    const float arg2 = static_cast<float>(epilogue::arg2::num) / static_cast<float>(epilogue::arg2::den);
+    result *= static_cast<float>(epilogue::scale::num) / static_cast<float>(epilogue::scale::den);
+    result += static_cast<float>(epilogue::shift::num) / static_cast<float>(epilogue::shift::den);
+    return (epilogue::is_active == true) ? hvx::util::FltOp<epilogue::act>(result, arg1, arg2) : result;
+}
+
 /*!
  * @brief SW function of the dense layer
  */
@@ -139,7 +181,139 @@ SwDense(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
                 result += bias[hvx::util::TensorGetPtr<typename param_::src_dim>(fm)]; // NOLINT
 
             // write output
-            dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, fm)] = result; // NOLINT
+            dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, fm)] = hvx::sw::SwEpilogue<param_>(result); // NOLINT
+        }
+    }
+}
+
+/*!
+ * @brief SW function of the recurrent layer (LSTM or GRU) over a whole sequence ([seq][batch][src] -> [seq][batch][hidden])
+ */
+template<typename param_, int64_t seq_>
+HVX_FORCE_INLINE auto
+SwRnn(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
+    using src_dim  = hvx::util::TensorParam<3, hvx::util::VectorParam<param_::src_elms, 1>, hvx::util::VectorParam<param_::batch, 1>,
+                                            hvx::util::VectorParam<seq_, 1>>;
+    using dst_dim  = hvx::util::TensorParam<3, hvx::util::VectorParam<param_::hidden, 1>, hvx::util::VectorParam<param_::batch, 1>,
+                                            hvx::util::VectorParam<seq_, 1>>;
+    using wgts_dim = hvx::util::TensorParam<3, hvx::util::VectorParam<param_::hidden, 1>, hvx::util::VectorParam<param_::wgts_gates, 1>,
+                                            hvx::util::VectorParam<param_::inner, 1>>;
+    using bias_dim = hvx::util::TensorParam<2, hvx::util::VectorParam<param_::hidden, 1>, hvx::util::VectorParam<param_::sum_gates, 1>>;
+    const auto sigmoid = [](float x) { return 1.0f / (1.0f + std::exp(-x)); };
+
+    // hidden and cell state (zero at the start of the sequence)
+    std::vector<float> hidden(param_::batch * param_::hidden, 0.0f), cell(param_::batch * param_::hidden, 0.0f);
+    std::vector<float> hidden_next(param_::batch * param_::hidden, 0.0f), act(param_::sum_gates, 0.0f);
+
+    for (int64_t seq = 0; seq < seq_; ++seq) {
+        for (int64_t batch = 0; batch < param_::batch; ++batch) {
+            for (int64_t unit = 0; unit < param_::hidden; ++unit) {
+                // gate sums over the concatenated input [src, hidden state] (the GRU sums up the new gate separately)
+                for (int64_t gate = 0; gate < param_::sum_gates; ++gate) {
+                    const bool is_gru    = (param_::cell_type == hvx::util::rnn_e::kGru);
+                    const int64_t column = is_gru ? hvx::util::Min(gate, static_cast<int64_t>(2)) : gate;
+                    float sum            = bias[hvx::util::TensorGetPtr<bias_dim>(gate, unit)]; // NOLINT
+                    for (int64_t inner = 0; inner < param_::inner; ++inner) {
+                        const bool is_src = (inner < param_::src_elms);
+                        if (is_gru && (((gate == 2) && !is_src) || ((gate == 3) && is_src)))
+                            continue;
+                        const float data = is_src ? src[hvx::util::TensorGetPtr<src_dim>(seq, batch, inner)] // NOLINT
+                                                  : hidden.at(batch * param_::hidden + inner - param_::src_elms);
+                        sum += data * wgts[hvx::util::TensorGetPtr<wgts_dim>(inner, column, unit)]; // NOLINT
+                    }
+                    act.at(gate) = sum;
+                }
+
+                // cell update
+                const int64_t ptr = batch * param_::hidden + unit;
+                if (param_::cell_type == hvx::util::rnn_e::kLstm) {
+                    cell.at(ptr)        = sigmoid(act.at(1)) * cell.at(ptr) + sigmoid(act.at(0)) * std::tanh(act.at(2));
+                    hidden_next.at(ptr) = sigmoid(act.at(3)) * std::tanh(cell.at(ptr));
+                } else {
+                    const float gate_z  = sigmoid(act.at(0));
+                    const float gate_n  = std::tanh(act.at(2) + sigmoid(act.at(1)) * act.at(3));
+                    hidden_next.at(ptr) = (1.0f - gate_z) * gate_n + gate_z * hidden.at(ptr);
+                }
+                dst[hvx::util::TensorGetPtr<dst_dim>(seq, batch, unit)] = hidden_next.at(ptr); // NOLINT
+            }
+        }
+        hidden = hidden_next;
+    }
+}
+
+/*!
+ * @brief SW function of the attention layer over a whole sequence ([seq][heads][dims], causal, at most "cache_len" keys per token)
+ */
+template<typename param_, int64_t seq_>
+HVX_FORCE_INLINE auto
+SwAttention(float* q, float* k, float* v, float* dst) noexcept -> void {
+    using dim         = hvx::util::TensorParam<3, hvx::util::VectorParam<param_::dims, 1>, hvx::util::VectorParam<param_::heads, 1>,
+                                               hvx::util::VectorParam<seq_, 1>>;
+    const float scale = (param_::scaled != false) ? (1.0f / std::sqrt(static_cast<float>(param_::dims))) : (1.0f);
+    std::vector<float> scores(param_::cache_len);
+
+    // iterates over the output tensors
+    for (int64_t token = 0; token < seq_; ++token) {
+        for (int64_t head = 0; head < param_::heads; ++head) {
+            const int64_t key_first = hvx::util::Max(token - param_::cache_len + 1, static_cast<int64_t>(0));
+            const int64_t keys      = token - key_first + 1;
+
+            // scaled scores and their maximum
+            float score_max = std::numeric_limits<float>::lowest();
+            for (int64_t key = 0; key < keys; ++key) {
+                float score = 0.0f;
+                for (int64_t d = 0; d < param_::dims; ++d)
+                    score += q[hvx::util::TensorGetPtr<dim>(token, head, d)] * k[hvx::util::TensorGetPtr<dim>(key_first + key, head, d)];
+                scores.at(key) = score * scale;
+                score_max      = hvx::util::Max(score_max, scores.at(key));
+            }
+
+            // softmax
+            float sum = 0.0f;
+            for (int64_t key = 0; key < keys; ++key) {
+                scores.at(key) = std::exp(scores.at(key) - score_max);
+                sum += scores.at(key);
+            }
+
+            // weighted sum of the values
+            for (int64_t d = 0; d < param_::dims; ++d) {
+                float result = 0.0f;
+                for (int64_t key = 0; key < keys; ++key)
+                    result += scores.at(key) * v[hvx::util::TensorGetPtr<dim>(key_first + key, head, d)]; // NOLINT
+                dst[hvx::util::TensorGetPtr<dim>(token, head, d)] = result / sum;                        // NOLINT
+            }
+        }
+    }
+}
+
+/*!
+ * @brief SW function of the matmul layer
+ */
+template<typename param_>
+HVX_FORCE_INLINE constexpr auto
+SwMatMul(float* src1, float* src2, float* dst) noexcept -> void {
+    // iterates over the output tensors
+    for (int64_t batch = 0; batch < param_::batch; ++batch) {
+        for (int64_t head = 0; head < param_::heads; ++head) {
+            for (int64_t row = 0; row < param_::rows; ++row) {
+                for (int64_t col = 0; col < param_::cols; ++col) {
+                    float result = 0.0f;
+
+                    // compute the dot product
+                    for (int64_t inner = 0; inner < param_::inner; ++inner) {
+                        const int64_t ptr_src2 = (param_::src2_trans != false)
+                                                     ? hvx::util::TensorGetPtr<typename param_::src2_dim>(batch, head, col, inner)
+                                                     : hvx::util::TensorGetPtr<typename param_::src2_dim>(batch, head, inner, col);
+                        const float data1 = src1[hvx::util::TensorGetPtr<typename param_::src1_dim>(batch, head, row, inner)]; // NOLINT
+                        const float data2 = src2[ptr_src2];                                                                   // NOLINT
+                        result += data1 * data2;
+                    }
+
+                    // write output
+                    const int64_t ptr_dst = hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, head, row, col);
+                    dst[ptr_dst]          = hvx::sw::SwEpilogue<param_>(result); // NOLINT
+                }
+            }
         }
     }
 }
@@ -185,7 +359,8 @@ SwDepthwise(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
 
                     // write output
                     if ((dst_row < param_::dst_rows) && (dst_col < param_::dst_cols))
-                        dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, chnl)] = result; // NOLINT
+                        dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, chnl)] = // NOLINT
+                            hvx::sw::SwEpilogue<param_>(result);
                 }
             }
         }
@@ -239,7 +414,77 @@ SwConv(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
 
                     // write output
                     if ((dst_row < param_::dst_rows) && (dst_col < param_::dst_cols))
-                        dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, fm)] = result; // NOLINT
+                        dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, fm)] =
+                            hvx::sw::SwEpilogue<param_>(result); // NOLINT
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief SW function of the per-channel quantized convolution layer (integer codes, like the reference of TFLite/ONNX QLinearConv). The
+ * src zero point of the dqbias is subtracted from the src and padded elements are skipped (they are the real zero), the bias codes are
+ * not folded with it. The multiplier and shift of each dst fm are taken from the dqbias, the dst zero point and the activation from the
+ * epilogue.
+ */
+template<typename param_>
+HVX_FORCE_INLINE auto
+SwConvRequant(float* src, float* wgts, float* bias, typename param_::bias_port* requant, float* dst) noexcept -> void {
+    using epilogue          = typename param_::epilogue;
+    using dst_data          = typename param_::dst_type::data_type;
+    constexpr auto src_zero = param_::bias_type::src_zero;
+    const auto zero         = static_cast<float>(epilogue::shift::num) / static_cast<float>(epilogue::shift::den);
+    const auto arg1         = static_cast<float>(epilogue::arg1::num) / static_cast<float>(epilogue::arg1::den);
+    const auto arg2         = static_cast<float>(epilogue::arg2::num) / static_cast<float>(epilogue::arg2::den);
+
+    // iterates over the output tensors
+    for (int64_t batch = 0; batch < param_::batch; ++batch) {
+        for (int64_t dst_row = 0; dst_row < param_::dst_rows; ++dst_row) {
+            for (int64_t dst_col = 0; dst_col < param_::dst_cols; ++dst_col) {
+                for (int64_t fm = 0; fm < param_::fms; ++fm) {
+                    auto acc = static_cast<int64_t>(bias[fm]); // NOLINT
+
+                    // iterate and sum over channels and kernels (exact in int64)
+                    for (int64_t chnl = 0; chnl < param_::chnls; ++chnl) {
+                        for (int64_t knl_row = 0; knl_row < param_::knl_rows; ++knl_row) {
+                            for (int64_t knl_col = 0; knl_col < param_::knl_cols; ++knl_col) {
+                                const int64_t ptr_row =
+                                    (dst_row * param_::str_rows) - param_::pad_rows_up + knl_row * (param_::dil_rows + 1);
+                                const int64_t ptr_col =
+                                    (dst_col * param_::str_cols) - param_::pad_cols_left + knl_col * (param_::dil_cols + 1);
+                                if ((ptr_row >= 0) && (ptr_row < param_::src_rows) && (ptr_col >= 0) && (ptr_col < param_::src_cols)) {
+                                    const int64_t ptr_src =
+                                        hvx::util::TensorGetPtr<typename param_::src_dim>(batch, ptr_row, ptr_col, chnl);
+                                    const int64_t ptr_wgts =
+                                        hvx::util::TensorGetPtr<typename param_::wgts_dim>(fm, chnl, knl_row, knl_col);
+                                    acc += (static_cast<int64_t>(src[ptr_src]) - src_zero) * static_cast<int64_t>(wgts[ptr_wgts]); // NOLINT
+                                }
+                            }
+                        }
+                    }
+
+                    // requantize (rounded once by the underflow policy), add the dst zero point, apply the activation and saturate
+                    const auto& qnt     = requant[fm / param_::fm_vec_size].Get(fm % param_::fm_vec_size); // NOLINT
+                    const int32_t shift = 31 + static_cast<int32_t>(qnt.shift);
+                    const int64_t prod  = acc * static_cast<int64_t>(qnt.mult);
+                    const int64_t down  = prod >> shift;
+                    const int64_t up    = -((-prod) >> shift);
+                    int64_t code        = down;
+                    if (param_::underflow_type == hvx::util::underflow_e::kRound)
+                        code = (prod - (down << shift) >= (static_cast<int64_t>(1) << (shift - 1))) ? (up) : (down);
+                    else if (param_::underflow_type == hvx::util::underflow_e::kCeil)
+                        code = up;
+                    else if (param_::underflow_type == hvx::util::underflow_e::kTrunc)
+                        code = (prod < 0) ? (up) : (down);
+                    auto result = static_cast<float>(code) + zero;
+                    if (epilogue::is_active == true)
+                        result = hvx::util::FltOp<epilogue::act>(result, arg1, arg2);
+                    result = hvx::util::Clamp(result, static_cast<float>(std::numeric_limits<dst_data>::lowest()),
+                                              static_cast<float>(std::numeric_limits<dst_data>::max()));
+                    dst[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, fm)] = result; // NOLINT
                 }
             }
         }
@@ -248,6 +493,19 @@ SwConv(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
 
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief SW function of the fused depthwise-separable layer (depthwise conv followed by a 1x1 conv, unfused and in float)
+ */
+template<typename param_, bool with_bias_ = false>
+HVX_FORCE_INLINE auto
+SwSeparable(float* src, float* dw_wgts, float* dw_bias, float* pw_wgts, float* pw_bias, float* dst) noexcept -> void {
+    std::vector<float> mid(param_::mid_dim::elms);
+    hvx::sw::SwDepthwise<typename param_::dw_param, with_bias_>(src, dw_wgts, dw_bias, mid.data());
+    hvx::sw::SwConv<typename param_::pw_param, with_bias_>(mid.data(), pw_wgts, pw_bias, dst);
+}
+
+/******************************************************************************************************************************************/
+
 /*!
  * @brief SW function of the softmax layer
  */
@@ -285,9 +543,28 @@ SwSoftmax(const float* src, float* dst) noexcept -> void {
 template<typename param_>
 void
 SwLayernorm(float* src, float* wgts, float* bias, float* dst) {
-    for (int64_t i = 0; i < param_::batch * param_::src_rows * param_::src_cols; ++i) {
-        for (int64_t chnl = 0; chnl < param_::chnls; ++chnl) {
-            dst[i * param_::chnls + chnl] = src[i * param_::chnls + chnl] * wgts[chnl] + bias[chnl]; // NOLINT
+    for (int64_t grp = 0; grp < (param_::src_dim::elms / param_::norm_elms); ++grp) {
+        float* src_grp = &src[grp * param_::norm_elms]; // NOLINT
+        float* dst_grp = &dst[grp * param_::norm_elms]; // NOLINT
+
+        // statistics of the normalization group
+        double mean = 0.0, var = 0.0;
+        for (int64_t i = 0; i < param_::norm_elms; ++i)
+            mean += static_cast<double>(src_grp[i]); // NOLINT
+        mean /= static_cast<double>(param_::norm_elms);
+        for (int64_t i = 0; i < param_::norm_elms; ++i) {
+            const double data = (param_::norm_type == hvx::util::norm_e::kRms) ? src_grp[i] : (src_grp[i] - mean); // NOLINT
+            var += data * data;
+        }
+        var /= static_cast<double>(param_::norm_elms);
+
+        // normalization and affine transformation
+        const bool is_affine = (param_::norm_type == hvx::util::norm_e::kAffine);
+        const double shift   = (param_::norm_type == hvx::util::norm_e::kLayer) ? mean : 0.0;
+        const double scale   = is_affine ? 1.0 : (1.0 / std::sqrt(var + static_cast<double>(param_::eps)));
+        for (int64_t i = 0; i < param_::norm_elms; ++i) {
+            const int64_t chnl = i % param_::chnls;
+            dst_grp[i] = static_cast<float>((src_grp[i] - shift) * scale * wgts[chnl] + bias[chnl]); // NOLINT
         }
     }
 }
@@ -295,54 +572,32 @@ SwLayernorm(float* src, float* wgts, float* bias, float* dst) {
 /******************************************************************************************************************************************/
 
 /*!
- * @brief SW function of the ConvTranspose layer
+ * @brief SW function of the transposed convolution layer (scatters every src element with the kernel into the dst)
  */
-template<typename param_>
-HVX_FORCE_INLINE constexpr auto
-SwConvTranspose(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
-    // kernel parameters
-    constexpr int64_t str_rows = (param_::dst_rows - param_::knl_dil_rows + 2 * param_::pad_rows) / (param_::src_rows - 1);
-    constexpr int64_t str_cols = (param_::dst_cols - param_::knl_dil_cols + 2 * param_::pad_cols) / (param_::src_cols - 1);
+template<typename param_, bool with_bias_ = false>
+HVX_FORCE_INLINE auto
+SwTransposedConv(float* src, float* wgts, float* bias, float* dst) noexcept -> void {
+    std::vector<float> sum(param_::dst_dim::elms, 0.0f);
 
     for (int64_t batch = 0; batch < param_::batch; ++batch) {
-        // initializes the output with the corresponding bias value
-        for (int64_t dst_row = 0; dst_row < param_::dst_rows; ++dst_row) {
-            for (int64_t dst_col = 0; dst_col < param_::dst_cols; ++dst_col) {
-                for (int64_t dst_chnl = 0; dst_chnl < param_::fms; ++dst_chnl) {
-                    const int64_t ptr_dst  = hvx::util::TensorGetPtr<typename param_::dst_dim>(dst_row, dst_col, dst_chnl);
-                    const int64_t ptr_bias = hvx::util::TensorGetPtr<typename param_::src_dim>(dst_chnl);
-                    dst[ptr_dst]           =                                                                             // NOLINT
-                        (param_::bias_dim::elms == param_::fms)                                                //
-                                      ? (bias[ptr_bias])                                                                 // NOLINT
-                                      : ((param_::bias_dim::elms == (param_::dst_rows * param_::dst_cols * param_::fms)) //
-                                             ? (bias[ptr_dst])                                                           // NOLINT
-                                             : (0));
-                }
-            }
-        }
-
         // multiplies wgts with input and adds to output
         for (int64_t src_row = 0; src_row < param_::src_rows; ++src_row) {
             for (int64_t src_col = 0; src_col < param_::src_cols; ++src_col) {
-                for (int64_t dst_chnl = 0; dst_chnl < param_::fms; ++dst_chnl) {
-                    for (int64_t src_chnl = 0; src_chnl < param_::chnls; ++src_chnl) {
-                        // reads input data
-                        auto src_data = src[hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, src_row, src_col, src_chnl)];
+                for (int64_t fm = 0; fm < param_::fms; ++fm) {
+                    for (int64_t chnl = 0; chnl < param_::chnls; ++chnl) {
+                        const int64_t ptr_src = hvx::util::TensorGetPtr<typename param_::src_dim>(batch, src_row, src_col, chnl);
+                        const float src_data  = src[ptr_src]; // NOLINT
 
-                        // Iterates over the kernel
+                        // iterates over the kernel
                         for (int64_t knl_row = 0; knl_row < param_::knl_rows; ++knl_row) {
-                            const int64_t dst_row = src_row * str_rows + knl_row * (param_::dil_rows + 1) - param_::pad_rows;
                             for (int64_t knl_col = 0; knl_col < param_::knl_cols; ++knl_col) {
-                                const int64_t dst_col = src_col * str_cols + knl_col * (param_::dil_cols + 1) - param_::pad_cols;
-
-                                // writes output data
-                                if ((dst_row >= 0) && (dst_row < param_::dst_rows - 2 * param_::pad_rows) && (dst_col >= 0) &&
-                                    (dst_col < param_::dst_cols - 2 * param_::pad_cols)) {
+                                const int64_t dst_row = src_row * param_::str_rows + knl_row - param_::pad_rows;
+                                const int64_t dst_col = src_col * param_::str_cols + knl_col - param_::pad_cols;
+                                if ((dst_row >= 0) && (dst_row < param_::dst_rows) && (dst_col >= 0) && (dst_col < param_::dst_cols)) {
                                     const int64_t ptr_dst =
-                                        hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, dst_chnl);
-                                    const int64_t ptr_wgt =
-                                        hvx::util::TensorGetPtr<typename param_::wgts_dim>(dst_chnl, src_chnl, knl_row, knl_col);
-                                    dst[ptr_dst] += (src_data * wgts[ptr_wgt]); // NOLINT
+                                        hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, fm);
+                                    const int64_t ptr_wgt = hvx::util::TensorGetPtr<typename param_::wgts_dim>(fm, chnl, knl_row, knl_col);
+                                    sum.at(ptr_dst) += (src_data * wgts[ptr_wgt]); // NOLINT
                                 }
                             }
                         }
@@ -350,6 +605,19 @@ SwConvTranspose(float* src, float* wgts, float* bias, float* dst) noexcept -> vo
                 }
             }
         }
+
+        // add bias and write output
+        for (int64_t dst_row = 0; dst_row < param_::dst_rows; ++dst_row) {
+            for (int64_t dst_col = 0; dst_col < param_::dst_cols; ++dst_col) {
+                for (int64_t fm = 0; fm < param_::fms; ++fm) {
+                    const int64_t ptr_dst = hvx::util::TensorGetPtr<typename param_::dst_dim>(batch, dst_row, dst_col, fm);
+                    float result          = sum.at(ptr_dst);
+                    if (with_bias_ == true)
+                        result += bias[hvx::util::TensorGetPtr<typename param_::bias_dim>(fm)]; // NOLINT
+                    dst[ptr_dst] = hvx::sw::SwEpilogue<param_>(result); // NOLINT
+                }
+            }
+        }
     }
 }
 
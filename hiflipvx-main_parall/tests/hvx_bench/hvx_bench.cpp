@@ -0,0 +1,380 @@
+﻿/**
+ * Licence: GNU GPLv3 \n
+ * You may copy, distribute and modify the software as long as you track
+ * changes/dates in source files. Any modifications to or software
+ * including (via compiler) GPL-licensed code must also be made available
+ * under the GPL along with build & install instructions.
+ *
+ * @file    hvx_bench.cpp
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Microbenchmark suite for the C-simulation of all Hw* entry points of hvx_core.h.
+ *  Usage: hvx_bench [--reps N] [--warmup N] [--filter NAME] [--csv FILE] [--json FILE]
+ */
+
+#include "../../include/sw_test/hvx_sw_test_core.h"
+#include <cerrno>
+
+constexpr auto overflow  = hvx::util::overflow_e::kSaturate;
+constexpr auto underflow = hvx::util::underflow_e::kTrunc;
+constexpr auto exec      = hvx::util::execution_e::kExact;
+constexpr bool buffer_wgts = false, buffer_bias = false;
+using batch_v = hvx::util::VectorParam<1, 1>;
+
+/*!
+ * @brief evaluation parameters without debug output or repetitions (only the hw buffers of the evaluators are used)
+ */
+template<typename dst_port_>
+using bench_eval = hvx::sw::EvaluateParam<false, 1, 1, 1, dst_port_, 0>;
+
+/*!
+ * @brief shape string of a 3d feature map (rows x cols x chnls)
+ */
+auto
+BenchShape(int64_t rows, int64_t cols, int64_t chnls) -> std::string {
+    return std::to_string(rows) + "x" + std::to_string(cols) + "x" + std::to_string(chnls);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief convolution (3x3, padding 1) with bias
+ */
+template<typename type_, int64_t rows_, int64_t cols_, int64_t chnls_, int64_t fms_, int64_t vec_size_>
+auto
+BenchConv(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    if (!hvx::sw::BenchSelected(cfg, "HwConv"))
+        return;
+    using param = hvx::nn::ConvParam<type_, type_, type_, type_, batch_v, hvx::util::VectorParam<rows_, 1>,
+                                     hvx::util::VectorParam<cols_, 1>, hvx::util::VectorParam<chnls_, vec_size_>,
+                                     hvx::util::VectorParam<fms_, vec_size_>, hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>,
+                                     hvx::util::Array2dParam<1, 1>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>,
+                                     buffer_wgts, buffer_bias, overflow, underflow, exec>;
+    hvx::sw::ConvEvaluate<param, bench_eval<typename param::dst_port>> eval(0.25f, 0.25f);
+    const int64_t macs = param::dst_dim::elms * chnls_ * 3 * 3;
+    results.push_back(hvx::sw::BenchRun(cfg, "HwConv", type_name, BenchShape(rows_, cols_, chnls_) + "->" + std::to_string(fms_) + " k3",
+                                        vec_size_, param::src_dim::elms, macs, [&]() {
+                                            hvx::HwConv<param>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+                                        }));
+    hvx::sw::BenchPrint(results.back());
+}
+
+/*!
+ * @brief dense (fully connected) with bias
+ */
+template<typename type_, int64_t chnls_, int64_t fms_, int64_t vec_size_>
+auto
+BenchDense(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    if (!hvx::sw::BenchSelected(cfg, "HwDense"))
+        return;
+    using param = hvx::nn::DenseParam<type_, type_, type_, type_, batch_v, hvx::util::VectorParam<chnls_, vec_size_>,
+                                      hvx::util::VectorParam<fms_, vec_size_>, buffer_wgts, buffer_bias, overflow, underflow, exec>;
+    hvx::sw::DenseEvaluate<param, bench_eval<typename param::dst_port>> eval(0.25f, 0.25f);
+    const int64_t macs = param::dst_dim::elms * chnls_;
+    results.push_back(hvx::sw::BenchRun(cfg, "HwDense", type_name, std::to_string(chnls_) + "->" + std::to_string(fms_), vec_size_,
+                                        param::src_dim::elms, macs, [&]() {
+                                            hvx::HwDense<param>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+                                        }));
+    hvx::sw::BenchPrint(results.back());
+}
+
+/*!
+ * @brief depthwise convolution (3x3, padding 1) with bias
+ */
+template<typename type_, int64_t rows_, int64_t cols_, int64_t chnls_, int64_t vec_size_>
+auto
+BenchDepthwise(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    if (!hvx::sw::BenchSelected(cfg, "HwDepthwise"))
+        return;
+    using param = hvx::nn::DepthwiseParam<type_, type_, type_, type_, batch_v, hvx::util::VectorParam<rows_, 1>,
+                                          hvx::util::VectorParam<cols_, 1>, hvx::util::VectorParam<chnls_, vec_size_>,
+                                          hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                          hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                          underflow, exec>;
+    hvx::sw::DepthwiseEvaluate<param, bench_eval<typename param::dst_port>> eval(0.25f, 0.25f);
+    const int64_t macs = param::dst_dim::elms * 3 * 3;
+    results.push_back(hvx::sw::BenchRun(cfg, "HwDepthwise", type_name, BenchShape(rows_, cols_, chnls_) + " k3", vec_size_,
+                                        param::src_dim::elms, macs, [&]() {
+                                            hvx::HwDepthwise<param>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+                                        }));
+    hvx::sw::BenchPrint(results.back());
+}
+
+/*!
+ * @brief average and max pooling (2x2, stride 2)
+ */
+template<typename type_, int64_t rows_, int64_t cols_, int64_t chnls_, int64_t vec_size_>
+auto
+BenchPool(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    using avg = hvx::pool_avg_param<type_, type_, batch_v, hvx::util::VectorParam<rows_, 1>, hvx::util::VectorParam<cols_, 1>,
+                                    hvx::util::VectorParam<chnls_, vec_size_>, hvx::util::VectorParam<2, 2>, hvx::util::VectorParam<2, 2>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<2, 2>, overflow,
+                                    underflow, exec>;
+    using max = hvx::pool_max_param<type_, type_, batch_v, hvx::util::VectorParam<rows_, 1>, hvx::util::VectorParam<cols_, 1>,
+                                    hvx::util::VectorParam<chnls_, vec_size_>, hvx::util::VectorParam<2, 2>, hvx::util::VectorParam<2, 2>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<2, 2>, overflow,
+                                    underflow, exec>;
+    const auto shape = BenchShape(rows_, cols_, chnls_) + " k2s2";
+    if (hvx::sw::BenchSelected(cfg, "HwPoolAvg")) {
+        hvx::sw::PoolEvaluate<avg, bench_eval<typename avg::dst_port>, hvx::util::pooling_e::kAvg> eval;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwPoolAvg", type_name, shape, vec_size_, avg::src_dim::elms, 0,
+                                            [&]() { hvx::HwPoolAvg<avg>(eval.GetSrcHw(), eval.GetDstHw()); }));
+        hvx::sw::BenchPrint(results.back());
+    }
+    if (hvx::sw::BenchSelected(cfg, "HwPoolMax")) {
+        hvx::sw::PoolEvaluate<max, bench_eval<typename max::dst_port>, hvx::util::pooling_e::kMax> eval;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwPoolMax", type_name, shape, vec_size_, max::src_dim::elms, 0,
+                                            [&]() { hvx::HwPoolMax<max>(eval.GetSrcHw(), eval.GetDstHw()); }));
+        hvx::sw::BenchPrint(results.back());
+    }
+}
+
+/*!
+ * @brief softmax and layer normalization over the channels
+ */
+template<typename type_, int64_t rows_, int64_t cols_, int64_t chnls_, int64_t vec_size_>
+auto
+BenchNorm(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    using softmax = hvx::nn::SoftmaxParam<type_, type_, batch_v, hvx::util::VectorParam<rows_, 1>, hvx::util::VectorParam<cols_, 1>,
+                                          hvx::util::VectorParam<chnls_, vec_size_>, overflow, underflow, exec>;
+    using layernorm = hvx::nn::LayernormParam<type_, type_, type_, type_, batch_v, hvx::util::VectorParam<rows_, 1>,
+                                              hvx::util::VectorParam<cols_, 1>, hvx::util::VectorParam<chnls_, vec_size_>, buffer_wgts,
+                                              buffer_bias, overflow, underflow, exec>;
+    const auto shape = BenchShape(rows_, cols_, chnls_);
+    if (hvx::sw::BenchSelected(cfg, "HwSoftmax")) {
+        hvx::sw::SoftmaxEvaluate<softmax, bench_eval<typename softmax::dst_port>> eval;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwSoftmax", type_name, shape, vec_size_, softmax::src_dim::elms, 0,
+                                            [&]() { hvx::HwSoftmax<softmax>(eval.GetSrcHw(), eval.GetDstHw()); }));
+        hvx::sw::BenchPrint(results.back());
+    }
+    if (hvx::sw::BenchSelected(cfg, "HwLayernorm")) {
+        hvx::sw::LayernormEvaluate<layernorm, bench_eval<typename layernorm::dst_port>> eval(1.0f, 1.0f, 0.25f);
+        results.push_back(hvx::sw::BenchRun(cfg, "HwLayernorm", type_name, shape, vec_size_, layernorm::src_dim::elms, 0, [&]() {
+            hvx::HwLayernorm<layernorm>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+        }));
+        hvx::sw::BenchPrint(results.back());
+    }
+}
+
+/*!
+ * @brief one reduce function over the first dimension (the reduce functions only support a vector size of 1)
+ */
+template<typename type_, int64_t dim0_, int64_t dim1_, int64_t dim2_, hvx::util::reduce_e op_type_>
+auto
+BenchReduceSingle(const hvx::sw::BenchConfig& cfg, const char* name, const char* type_name, std::vector<hvx::sw::BenchResult>& results)
+    -> void {
+    if (!hvx::sw::BenchSelected(cfg, name))
+        return;
+    using dim =
+        hvx::util::TensorParam<3, hvx::util::VectorParam<dim0_, 1>, hvx::util::VectorParam<dim1_, 1>, hvx::util::VectorParam<dim2_, 1>>;
+    using param = hvx::red::Reduce<type_, type_, dim, hvx::util::ReduceParam<true>, overflow, underflow, exec, op_type_>;
+    hvx::sw::ReduceEvaluate<param, bench_eval<typename param::dst_port>> eval(0.01f);
+    results.push_back(hvx::sw::BenchRun(cfg, name, type_name, BenchShape(dim2_, dim1_, dim0_) + " (chnls)", 1, dim::elms, 0,
+                                        [&]() { eval.HwReduce(); }));
+    hvx::sw::BenchPrint(results.back());
+}
+
+/*!
+ * @brief all reduce functions
+ */
+template<typename type_, int64_t dim0_, int64_t dim1_, int64_t dim2_>
+auto
+BenchReduce(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    BenchReduceSingle<type_, dim0_, dim1_, dim2_, hvx::util::reduce_e::Max>(cfg, "HwReduceMax", type_name, results);
+    BenchReduceSingle<type_, dim0_, dim1_, dim2_, hvx::util::reduce_e::Mean>(cfg, "HwReduceMean", type_name, results);
+    BenchReduceSingle<type_, dim0_, dim1_, dim2_, hvx::util::reduce_e::Min>(cfg, "HwReduceMin", type_name, results);
+    BenchReduceSingle<type_, dim0_, dim1_, dim2_, hvx::util::reduce_e::Sum>(cfg, "HwReduceSum", type_name, results);
+}
+
+/*!
+ * @brief one elementwise function
+ */
+template<typename param_>
+auto
+BenchEwSingle(const hvx::sw::BenchConfig& cfg,
+              const char* name,
+              const char* type_name,
+              float arg1,
+              float arg2,
+              std::vector<hvx::sw::BenchResult>& results) -> void {
+    if (!hvx::sw::BenchSelected(cfg, name))
+        return;
+    using dim = typename param_::src1_dim;
+    hvx::sw::EwEvaluate<param_, bench_eval<typename param_::dst_port>> eval(0.5f);
+    results.push_back(hvx::sw::BenchRun(cfg, name, type_name, std::to_string(dim::dims[1]) + "x" + std::to_string(dim::dims[0]),
+                                        dim::vec_size, dim::elms, 0, [&]() { eval.HwElementwise(arg1, arg2); }));
+    hvx::sw::BenchPrint(results.back());
+}
+
+/*!
+ * @brief all elementwise functions
+ */
+template<typename type_, int64_t rows_, int64_t cols_, int64_t vec_size_>
+auto
+BenchEw(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    using dim = hvx::util::TensorParam<2, hvx::util::VectorParam<cols_, vec_size_>, hvx::util::VectorParam<rows_, 1>>;
+    BenchEwSingle<hvx::abs_param<type_, type_, dim, overflow, underflow, exec>>(cfg, "HwAbs", type_name, 0, 0, results);
+    BenchEwSingle<hvx::add_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwAdd", type_name, 0, 0, results);
+    BenchEwSingle<hvx::addconst_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwAddConst", type_name, 0.25f, 0,
+                                                                                             results);
+    BenchEwSingle<hvx::clip2_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwClip", type_name, -0.25f, 0.25f, results);
+    BenchEwSingle<hvx::max_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwMax", type_name, 0, 0, results);
+    BenchEwSingle<hvx::maxconst_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwMaxConst", type_name, 0.25f, 0,
+                                                                                             results);
+    BenchEwSingle<hvx::min_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwMin", type_name, 0, 0, results);
+    BenchEwSingle<hvx::minconst_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwMinConst", type_name, 0.25f, 0,
+                                                                                             results);
+    BenchEwSingle<hvx::mul_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwMul", type_name, 0, 0, results);
+    BenchEwSingle<hvx::mulconst_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwMulConst", type_name, 0.5f, 0,
+                                                                                             results);
+    BenchEwSingle<hvx::sigmoid_param<type_, type_, dim, overflow, underflow, exec>>(cfg, "HwSigmoid", type_name, 0, 0, results);
+    BenchEwSingle<hvx::sub_param<type_, type_, type_, dim, overflow, underflow, exec>>(cfg, "HwSub", type_name, 0, 0, results);
+    BenchEwSingle<hvx::tanh_param<type_, type_, dim, overflow, underflow, exec>>(cfg, "HwTanh", type_name, 0, 0, results);
+}
+
+/*!
+ * @brief transpose, reshape, multicast, split and concat of a 2d tensor
+ */
+template<typename type_, int64_t rows_, int64_t cols_, int64_t vec_size_>
+auto
+BenchConvert(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    using dim   = hvx::util::TensorParam<2, hvx::util::VectorParam<cols_, vec_size_>, hvx::util::VectorParam<rows_, 1>>;
+    using rdim  = hvx::util::TensorParam<2, hvx::util::VectorParam<cols_ / 2, vec_size_>, hvx::util::VectorParam<rows_ * 2, 1>>;
+    using vec   = hvx::util::vector<type_, vec_size_>;
+    const auto shape = std::to_string(rows_) + "x" + std::to_string(cols_);
+
+    // inputs and outputs (the convert functions only move data, so the values are irrelevant)
+    std::vector<vec> src(dim::vec_elms), dst0(dim::vec_elms), dst1(dim::vec_elms);
+    std::vector<float> src_sw(dim::elms);
+    hvx::sw::EvalCreateRndSrc<vec, dim>(src.data(), src_sw.data());
+
+    if (hvx::sw::BenchSelected(cfg, "HwTranspose")) {
+        using param = hvx::convert::TransposeParam<type_, dim, hvx::util::TransposePerm<1, 0>, vec_size_>;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwTranspose", type_name, shape, vec_size_, dim::elms, 0,
+                                            [&]() { hvx::HwTranspose<param>(src.data(), dst0.data()); }));
+        hvx::sw::BenchPrint(results.back());
+    }
+    if (hvx::sw::BenchSelected(cfg, "HwReshape")) {
+        using param = hvx::convert::ReshapeParam<type_, dim, rdim>;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwReshape", type_name, shape, vec_size_, dim::elms, 0,
+                                            [&]() { hvx::HwReshape<param>(src.data(), dst0.data()); }));
+        hvx::sw::BenchPrint(results.back());
+    }
+    if (hvx::sw::BenchSelected(cfg, "HwMulticast")) {
+        using param = hvx::convert::MulticastParam<type_, dim>;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwMulticast", type_name, shape + " x2", vec_size_, dim::elms, 0,
+                                            [&]() { hvx::HwMulticast<param>(src.data(), dst0.data(), dst1.data()); }));
+        hvx::sw::BenchPrint(results.back());
+    }
+    if (hvx::sw::BenchSelected(cfg, "HwSplit")) {
+        using param = hvx::convert::SplitParam<type_, dim, hvx::util::ConcatSplitParam<1, rows_ / 2, rows_ / 2>>;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwSplit", type_name, shape + " /2", vec_size_, dim::elms, 0, [&]() {
+            hvx::HwSplit<param>(src.data(), dst0.data(), dst0.data() + dim::vec_elms / 2);
+        }));
+        hvx::sw::BenchPrint(results.back());
+    }
+    if (hvx::sw::BenchSelected(cfg, "HwConcat")) {
+        using param = hvx::convert::ConcatParam<type_, dim, hvx::util::ConcatSplitParam<1, rows_ / 2, rows_ / 2>>;
+        results.push_back(hvx::sw::BenchRun(cfg, "HwConcat", type_name, shape + " /2", vec_size_, dim::elms, 0, [&]() {
+            hvx::HwConcat<param>(src.data(), src.data() + dim::vec_elms / 2, dst0.data());
+        }));
+        hvx::sw::BenchPrint(results.back());
+    }
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief all benchmarks of one data type and vector size
+ */
+template<typename type_, int64_t vec_size_>
+auto
+BenchAll(const hvx::sw::BenchConfig& cfg, const char* type_name, std::vector<hvx::sw::BenchResult>& results) -> void {
+    BenchConv<type_, 32, 32, 16, 16, vec_size_>(cfg, type_name, results);
+    BenchDense<type_, 512, 512, vec_size_>(cfg, type_name, results);
+    BenchDepthwise<type_, 32, 32, 32, vec_size_>(cfg, type_name, results);
+    BenchPool<type_, 32, 32, 32, vec_size_>(cfg, type_name, results);
+    BenchNorm<type_, 16, 16, 256, vec_size_>(cfg, type_name, results);
+    BenchEw<type_, 64, 4096, vec_size_>(cfg, type_name, results);
+    BenchConvert<type_, 256, 512, vec_size_>(cfg, type_name, results);
+    if (vec_size_ == 1)
+        BenchReduce<type_, 256, 16, 16>(cfg, type_name, results);
+}
+
+/*!
+ * @brief parses a non-negative integer argument (false if it is no number, out of range or negative)
+ */
+auto
+ParseCount(const std::string& str, int64_t& dst) noexcept -> bool {
+    char* end      = nullptr;
+    errno          = 0;
+    const auto val = std::strtoll(str.c_str(), &end, 10);
+    if (str.empty() || (end != (str.c_str() + str.size())) || (errno == ERANGE) || (val < 0)) // NOLINT
+        return false;
+    dst = static_cast<int64_t>(val);
+    return true;
+}
+
+/*!
+ * @brief parses the command line arguments
+ */
+auto
+ParseArgs(int argc, char** argv, hvx::sw::BenchConfig& cfg, std::string& csv, std::string& json) -> bool {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg  = argv[i];                                   // NOLINT
+        const bool has_value   = (i + 1 < argc);
+        const std::string next = has_value ? std::string(argv[i + 1]) : ""; // NOLINT
+        bool valid             = has_value;
+        if (arg == "--reps")
+            valid = valid && ParseCount(next, cfg.reps);
+        else if (arg == "--warmup")
+            valid = valid && ParseCount(next, cfg.warmup);
+        else if (arg == "--filter")
+            cfg.filter = next;
+        else if (arg == "--csv")
+            csv = next;
+        else if (arg == "--json")
+            json = next;
+        else
+            valid = false;
+        if (!valid) {
+            std::cout << "usage: " << argv[0] << " [--reps N] [--warmup N] [--filter NAME] [--csv FILE] [--json FILE]\n"; // NOLINT
+            return false;
+        }
+        ++i;
+    }
+    return true;
+}
+
+/*!
+ * @brief main function
+ */
+auto
+main(int argc, char** argv) -> int {
+    hvx::sw::BenchConfig cfg;
+    std::string csv, json;
+    if (!ParseArgs(argc, argv, cfg, csv, json))
+        return 1;
+
+    using type1 = hvx::util::dfixed<int16_t, 15>;
+    using type2 = hvx::util::dfixed<int8_t, 7>;
+    using type3 = hvx::util::dfixed<float, 28>;
+
+    // sweep over data types and vector sizes
+    std::vector<hvx::sw::BenchResult> results;
+    hvx::sw::BenchPrintHeader();
+    BenchAll<type1, 1>(cfg, "int16", results);
+    BenchAll<type1, 4>(cfg, "int16", results);
+    BenchAll<type2, 1>(cfg, "int8", results);
+    BenchAll<type2, 4>(cfg, "int8", results);
+    BenchAll<type3, 1>(cfg, "float", results);
+    BenchAll<type3, 4>(cfg, "float", results);
+
+    // export
+    if (!csv.empty() && !hvx::sw::BenchWriteCsv(csv, results))
+        std::cout << "could not write " << csv << "\n";
+    if (!json.empty() && !hvx::sw::BenchWriteJson(json, results))
+        std::cout << "could not write " << json << "\n";
+    return 0;
+}
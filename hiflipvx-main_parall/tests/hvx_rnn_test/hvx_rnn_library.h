@@ -54,6 +54,7 @@ template<typename param_>
 HVX_FORCE_INLINE auto
 HwRnnWriter(typename param_::src_port* src, typename param_::hid_port* hid, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, hid, dst);
+    HVX_SIM_PROFILE_TOP();
 
     //
     int64_t src_ptr = 0, hid_ptr = 0, dst_ptr = 0;
@@ -102,6 +103,7 @@ template<typename param_>
 HVX_FORCE_INLINE auto
 HwRnnReader(typename param_::src_port* src, typename param_::h0_port* h0, typename param_::dst_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, h0, dst);
+    HVX_SIM_PROFILE_TOP();
 
     //
     int64_t src_ptr = 0, h0_ptr = 0, dst_ptr = 0;
@@ -146,6 +148,7 @@ template<typename param_>
 HVX_FORCE_INLINE auto
 HwHidden(typename param_::wgts_port* src, typename param_::wgts_port* h0_init, typename param_::wgts_port* dst) noexcept -> void {
     HVX_DATAPACK_TOP(src, h0_init, dst);
+    HVX_SIM_PROFILE_TOP();
 
     //
     static typename param_::wgts_vec h0[param_::wgts_dim::vec_elms];
@@ -18,6 +18,9 @@ constexpr auto overflow  = hvx::util::overflow_e::kSaturate;
 constexpr auto underflow = hvx::util::underflow_e::kTrunc;
 constexpr auto exec      = hvx::util::execution_e::kExact;
 
+// number of failed bit exactness checks (over all threads)
+std::atomic<int64_t> failures{0};
+
 /******************************************************************************************************************************************/
 
 template<typename src_type_, typename arg_type_, typename dst_type_, int64_t vec_size_>
@@ -76,6 +79,106 @@ TestConfiguration(const char* name) noexcept -> std::string {
          + "\tTanh    : " + eval_tanh.Evaluation(sw_arg1, sw_arg2) + "\n";    //
 }
 
+/*!
+ * @brief Compares the (SIMD) result of ElementwiseTop against ElementwiseComp element by element
+ */
+template<typename param_>
+auto
+TestBitExact(const float src_max, const float sw_arg1, const float sw_arg2) noexcept -> bool {
+    using eval = hvx::sw::EvaluateParam<false, 4, 4, 4, hvx::util::vector<typename param_::dst_type, param_::vec_size>, 0>;
+    hvx::sw::EwEvaluate<param_, eval> eval_ew(src_max);
+    eval_ew.HwElementwise(sw_arg1, sw_arg2);
+
+    // element by element computation on the same data
+    const auto arg1 = static_cast<typename param_::arg_type>(sw_arg1);
+    const auto arg2 = static_cast<typename param_::arg_type>(sw_arg2);
+    std::vector<typename param_::dst_port> dst(param_::vec_elms);
+    for (int64_t i = 0; i < param_::vec_elms; ++i) {
+        for (int64_t j = 0; j < param_::vec_size; ++j) {
+            hvx::ew::impl::ElementwiseComp<param_>(eval_ew.GetSrc1Hw()[i].Get(j), eval_ew.GetSrc2Hw()[i].Get(j), arg1, arg2,
+                                                   dst[i].Get(j));
+        }
+    }
+    bool exact = std::memcmp(dst.data(), eval_ew.GetDstHw(), dst.size() * sizeof(typename param_::dst_port)) == 0;
+
+    // the SIMD fast path on its own (returns false if the configuration is computed by the scalar implementation)
+    std::vector<typename param_::dst_port> dst_simd(param_::vec_elms);
+    if (hvx::ew::impl::ElementwiseSimd<param_>(eval_ew.GetSrc1Hw(), eval_ew.GetSrc2Hw(), dst_simd.data(), arg1, arg2))
+        exact &= std::memcmp(dst.data(), dst_simd.data(), dst.size() * sizeof(typename param_::dst_port)) == 0;
+    return exact;
+}
+
+/*!
+ * @brief Tests if the SIMD C-simulation of the elementwise operations is bit exact for one overflow and underflow policy. All operations
+ * except Mul/MulConst write to "shift_type_", which has one fraction bit less than the src, so that the underflow policy is applied.
+ */
+template<typename src_type_,
+         typename arg_type_,
+         typename dst_type_,
+         typename shift_type_,
+         int64_t vec_size_,
+         hvx::util::overflow_e overflow_,
+         hvx::util::underflow_e underflow_>
+auto
+TestSimdPolicy() noexcept -> bool {
+    constexpr float sw_arg1 = arg_type_::is_signed ? -0.25f : 0.25f; // constants must be in the range of the argument type
+    constexpr float sw_arg2 = 0.75f;
+    using dim = hvx::tensor_param<2, hvx::vector_param<60, vec_size_>, hvx::vector_param<7, 1>>;
+    using sh  = shift_type_;
+
+    // configuration
+    bool exact = true;
+    exact &= TestBitExact<hvx::abs_param<src_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::addconst_param<src_type_, arg_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::add_param<src_type_, src_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::clip2_param<src_type_, arg_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::maxconst_param<src_type_, arg_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::max_param<src_type_, src_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::minconst_param<src_type_, arg_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::min_param<src_type_, src_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::mulconst_param<src_type_, arg_type_, dst_type_, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::mul_param<src_type_, src_type_, dst_type_, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    exact &= TestBitExact<hvx::sub_param<src_type_, src_type_, sh, dim, overflow_, underflow_, exec>>(1.0f, sw_arg1, sw_arg2);
+    return exact;
+}
+
+/*!
+ * @brief Tests if the SIMD C-simulation of the elementwise operations is bit exact for all underflow policies
+ */
+template<typename src_type_,
+         typename arg_type_,
+         typename dst_type_,
+         typename shift_type_,
+         int64_t vec_size_,
+         hvx::util::overflow_e overflow_>
+auto
+TestSimdOverflow() noexcept -> bool {
+    bool exact = true;
+    exact &= TestSimdPolicy<src_type_, arg_type_, dst_type_, shift_type_, vec_size_, overflow_, hvx::util::underflow_e::kCeil>();
+    exact &= TestSimdPolicy<src_type_, arg_type_, dst_type_, shift_type_, vec_size_, overflow_, hvx::util::underflow_e::kFloor>();
+    exact &= TestSimdPolicy<src_type_, arg_type_, dst_type_, shift_type_, vec_size_, overflow_, hvx::util::underflow_e::kRound>();
+    exact &= TestSimdPolicy<src_type_, arg_type_, dst_type_, shift_type_, vec_size_, overflow_, hvx::util::underflow_e::kTrunc>();
+    return exact;
+}
+
+/*!
+ * @brief Tests if the SIMD C-simulation of the elementwise operations is bit exact for all overflow and underflow policies
+ */
+template<typename src_type_, typename arg_type_, typename dst_type_, int64_t vec_size_>
+auto
+TestSimd(const char* name) noexcept -> std::string {
+    using shift_type = hvx::util::dfixed<typename dst_type_::data_type, src_type_::frac_bits - 1>;
+
+    // configuration
+    bool exact = true;
+    exact &= TestSimdOverflow<src_type_, arg_type_, dst_type_, shift_type, vec_size_, hvx::util::overflow_e::kWrap>();
+    exact &= TestSimdOverflow<src_type_, arg_type_, dst_type_, shift_type, vec_size_, hvx::util::overflow_e::kSaturate>();
+    exact &= TestSimdOverflow<src_type_, arg_type_, dst_type_, shift_type, vec_size_, hvx::util::overflow_e::kClip>();
+    if (!exact)
+        ++failures;
+    return std::string(name) + (exact ? "bit exact" : "MISMATCH") + " [" + hvx::ew::impl::EwSimdIsa() + "]\n";
+}
+
 /*!
  * @brief
  */
@@ -87,6 +190,8 @@ TestLayers(const char* name) noexcept -> void {
     results.append(TestConfiguration<src_type_, arg_type_, dst_type_, 1>("  Vec1:"));
     results.append(TestConfiguration<src_type_, arg_type_, dst_type_, 2>("  Vec2:"));
     results.append(TestConfiguration<src_type_, arg_type_, dst_type_, 4>("  Vec4:"));
+    results.append(TestSimd<src_type_, arg_type_, dst_type_, 1>("  Vec1 (simd): "));
+    results.append(TestSimd<src_type_, arg_type_, dst_type_, 4>("  Vec4 (simd): "));
     std::cout << results;
 }
 
@@ -95,11 +200,12 @@ TestLayers(const char* name) noexcept -> void {
 auto
 main() -> int {
     //
-    constexpr int64_t num = 7;
+    constexpr int64_t num = 8;
     using type1           = hvx::util::dfixed<int16_t, 15>;
     using type2           = hvx::util::dfixed<uint16_t, 16>;
     using type3           = hvx::util::dfixed<float, 28>;
     using type4           = hvx::util::dfixed<int16_t, 14>;
+    using type7           = hvx::util::dfixed<int8_t, 7>;
     // using type5           = dynfloat::std_f32;
     // using type6           = dynfloat::std_f16;
 
@@ -112,6 +218,7 @@ main() -> int {
         "\nFloating-Point\n",
         "\nDfloat std32\n",
         "\nDfloat std16\n",
+        "\nFixed-Point [signed 8-bit, 7-bit fraction]\n",
     };
 
     //
@@ -126,8 +233,10 @@ main() -> int {
     threads.emplace_back(&TestLayers<type3, type3, type3>, names[4]);
     // threads.emplace_back(&TestLayers<type5, type5, type5>, names[5]);
     // threads.emplace_back(&TestLayers<type6, type6, type6>, names[6]);
+    threads.emplace_back(&TestLayers<type7, type7, type7>, names[7]);
 
     // wait until all threads have finished
     for (auto& thread: threads)
         thread.join();
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,140 @@
+﻿/**
+ * Licence: GNU GPLv3 \n
+ * You may copy, distribute and modify the software as long as you track
+ * changes/dates in source files. Any modifications to or software
+ * including (via compiler) GPL-licensed code must also be made available
+ * under the GPL along with build & install instructions.
+ *
+ * @file    hvx_sw_test_gemm.cpp
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Compares the im2col + GEMM C-simulation of the conv and dense layers against their streaming execution (kHw). The same source is built
+ *  once per instruction set (scalar, AVX2 and AVX-512), so every GEMM kernel is checked.
+ */
+
+#include "../../include/sw_test/hvx_sw_test_core.h"
+#include <cstring>
+
+constexpr auto overflow  = hvx::util::overflow_e::kSaturate;
+constexpr auto underflow = hvx::util::underflow_e::kTrunc;
+constexpr auto exec      = hvx::util::execution_e::kExact;
+constexpr bool buffer_wgts = false, buffer_bias = false;
+using batch_v = hvx::util::VectorParam<2, 1>;
+
+// number of failed bit exactness checks
+int64_t failures = 0;
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief result of a bit exactness check, counts it if it failed
+ */
+auto
+CheckExact(const bool exact) noexcept -> std::string {
+    if (!exact)
+        ++failures;
+    return exact ? "bit exact" : "MISMATCH";
+}
+
+/*!
+ * @brief name of the GEMM kernel that is used for the data types of a layer
+ */
+template<typename param_>
+auto
+GemmKernel() noexcept -> std::string {
+    using gemm = hvx::nn::impl::ConvGemmParam<param_>;
+    if (gemm::n_tile == 1)
+        return gemm::pack32 ? "scalar, int32" : (gemm::is_flt ? "scalar, float" : "scalar, int64");
+    return gemm::acc32 ? "acc32" : "acc64";
+}
+
+/*!
+ * @brief overwrites the src with values that have the most significant bit set (they do not fit into an int32)
+ */
+template<typename param_>
+auto
+SetSrcMsb(typename param_::src_vec* src) noexcept -> void {
+    for (int64_t i = 0; i < param_::src_dim::vec_elms; ++i) {
+        for (int64_t j = 0; j < param_::src_dim::vec_size; ++j) {
+            const auto lsb      = static_cast<uint32_t>((i * param_::src_dim::vec_size + j) * 40503) & 0x7fffffffu;
+            src[i].data[j].data = static_cast<typename param_::src_type::data_type>(0x80000000u | lsb); // NOLINT
+        }
+    }
+}
+
+/*!
+ * @brief GEMM conv layer compared against the streaming execution
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_, bool src_msb_ = false>
+auto
+TestConvGemm(const char* name) noexcept -> std::string {
+    // configuration
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow, exec>;
+
+    // streaming and GEMM execution on the same data
+    hvx::sw::ConvEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(0.75f, 0.25f);
+    if (src_msb_)
+        SetSrcMsb<conv>(eval.GetSrcHw());
+    hvx::nn::ConvState<conv> state;
+    hvx::nn::ConvTop<conv, true>(state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms);
+    hvx::nn::ConvState<conv> gemm_state;
+    const bool done = hvx::nn::ConvGemmTop<conv, true>(gemm_state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data());
+
+    // both executions need to be bit exact
+    const bool exact = done && (std::memcmp(dst.data(), eval.GetDstHw(), dst.size() * sizeof(typename conv::dst_port)) == 0);
+    return name + CheckExact(exact) + " [" + GemmKernel<conv>() + "]\n";
+}
+
+/*!
+ * @brief GEMM dense layer compared against the streaming execution
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestDenseGemm(const char* name) noexcept -> std::string {
+    // configuration
+    using dense = hvx::nn::DenseParam<src_type_, dst_type_, wgts_type_, bias_type_, hvx::util::VectorParam<8, 1>,
+                                      hvx::util::VectorParam<512, 2>, hvx::util::VectorParam<256, 2>, buffer_wgts, buffer_bias, overflow,
+                                      underflow, exec>;
+
+    // streaming and GEMM execution on the same data
+    hvx::sw::DenseEvaluate<dense, hvx::sw::EvaluateParam<false, 4, 4, 4, typename dense::dst_port, 0>> eval(0.75f, 0.25f);
+    hvx::nn::DenseState<dense> state;
+    hvx::nn::DenseTop<dense>(state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    std::vector<typename dense::dst_port> dst(dense::dst_dim::vec_elms);
+    hvx::nn::DenseState<dense> gemm_state;
+    const bool done = hvx::nn::DenseGemmTop<dense>(gemm_state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data());
+
+    // both executions need to be bit exact
+    const bool exact = done && (std::memcmp(dst.data(), eval.GetDstHw(), dst.size() * sizeof(typename dense::dst_port)) == 0);
+    return name + CheckExact(exact) + " [" + GemmKernel<typename dense::conv_param>() + "]\n";
+}
+
+/******************************************************************************************************************************************/
+
+auto
+main() -> int {
+    using int8   = hvx::util::dfixed<int8_t, 7>;
+    using int16  = hvx::util::dfixed<int16_t, 15>;
+    using uint16 = hvx::util::dfixed<uint16_t, 16>;
+    using uint32 = hvx::util::dfixed<uint32_t, 16>;
+    using int32  = hvx::util::dfixed<int32_t, 0>;
+    using flt    = hvx::util::dfixed<float, 28>;
+
+    std::cout << "\nGEMM [" << hvx::nn::impl::ConvGemmIsa() << "]\n"
+              << "  Convolution: src[(16,1),(32,1),(8,2)] dst[(16,1),(32,1),(16,2)] ker(3,3):\n"
+              << TestConvGemm<int8, int8, int8, int8>("\t(int8)        ")
+              << TestConvGemm<int16, int16, int16, int16>("\t(int16)       ")
+              << TestConvGemm<uint16, uint16, uint16, uint16>("\t(uint16)      ")
+              << TestConvGemm<uint32, int16, int32, int32, true>("\t(uint32 src)  ")
+              << TestConvGemm<flt, flt, flt, flt>("\t(float)       ")
+              << "  Dense: src[(512,2)] dst[(256,2)]:\n"
+              << TestDenseGemm<int8, int8, int8, int8>("\t(int8)        ")
+              << TestDenseGemm<int16, int16, int16, int16>("\t(int16)       ");
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -12,7 +12,9 @@
  *
  */
 
+#include "../../include/hiflipvx/sim/hvx_sim_parallel_super.h"
 #include "../../include/sw_test/hvx_sw_test_core.h"
+#include <cstring>
 
 /******************************************************************************************************************************************/
 
@@ -25,8 +27,37 @@ constexpr auto exec            = hvx::util::execution_e::kExact;
 constexpr bool buffer_wgts = false, buffer_bias = false, debug = false;
 using batch_v = hvx::util::VectorParam<2, 1>;
 
+// fused epilogues of the conv/dense layers: relu(x / 2 + 1/8), clip(3x / 2, 0, 1/2) and tanh(2x)
+using relu_epilogue = hvx::util::EpilogueParam<hvx::util::elmwise_e::MaxConst, hvx::util::RatioParam<1, 2>, hvx::util::RatioParam<1, 8>>;
+using clip_epilogue = hvx::util::EpilogueParam<hvx::util::elmwise_e::Clip, hvx::util::RatioParam<3, 2>, hvx::util::RatioParam<0, 1>,
+                                               hvx::util::RatioParam<0, 1>, hvx::util::RatioParam<1, 2>>;
+using tanh_epilogue = hvx::util::EpilogueParam<hvx::util::elmwise_e::Tanh, hvx::util::RatioParam<2, 1>>;
+
+// number of failed checks (over all threads)
+std::atomic<int64_t> failures{0};
+
 /******************************************************************************************************************************************/
 
+/*!
+ * @brief result of a bit exactness check, counts it if it failed
+ */
+auto
+CheckExact(const bool exact) noexcept -> std::string {
+    if (!exact)
+        ++failures;
+    return exact ? "bit exact" : "MISMATCH";
+}
+
+/*!
+ * @brief prints the result of a runtime check and counts it if it failed (the test returns a failure if any check failed)
+ */
+auto
+Check(const char* name, const bool passed) noexcept -> void {
+    if (!passed)
+        ++failures;
+    std::cout << "\t" << name << ": " << (passed ? "passed" : "FAILED") << "\n";
+}
+
 /*!
  * @brief
  */
@@ -48,16 +79,21 @@ template<typename src_type_,
          int64_t dil_rows_,
          int64_t dil_cols_,
          int64_t str_rows_,
-         int64_t str_cols_>
+         int64_t str_cols_,
+         int64_t row_vec_size_      = 1,
+         int64_t col_vec_size_      = 1,
+         int64_t knl_rows_vec_size_ = knl_rows_,
+         int64_t knl_cols_vec_size_ = knl_cols_,
+         typename epilogue_         = hvx::util::EpilogueParam<>>
 auto
 TestConv(const char* name) noexcept -> std::string {
     // configuration
-    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<src_rows_, 1>,
-                                    hvx::util::VectorParam<src_cols_, 1>, hvx::util::VectorParam<fms_, fm_vec_size_>,
-                                    hvx::util::VectorParam<chnls_, chnl_vec_size_>, hvx::util::VectorParam<knl_rows_, knl_rows_>,
-                                    hvx::util::VectorParam<knl_cols_, knl_cols_>, hvx::util::Array2dParam<pad_rows_, pad_cols_>,
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<src_rows_, row_vec_size_>,
+                                    hvx::util::VectorParam<src_cols_, col_vec_size_>, hvx::util::VectorParam<fms_, fm_vec_size_>,
+                                    hvx::util::VectorParam<chnls_, chnl_vec_size_>, hvx::util::VectorParam<knl_rows_, knl_rows_vec_size_>,
+                                    hvx::util::VectorParam<knl_cols_, knl_cols_vec_size_>, hvx::util::Array2dParam<pad_rows_, pad_cols_>,
                                     hvx::util::Array2dParam<dil_rows_, dil_cols_>, hvx::util::Array2dParam<str_rows_, str_cols_>,
-                                    buffer_wgts, buffer_bias, overflow, underflow, exec>;
+                                    buffer_wgts, buffer_bias, overflow, underflow, exec, hvx::util::conv_e::kDirect, epilogue_>;
 
     // create random data, compute SW, compute HW and evaluate
     if (with_bias_ == true) {
@@ -71,6 +107,243 @@ TestConv(const char* name) noexcept -> std::string {
     }
 }
 
+/*!
+ * @brief two instances of the same convolution running concurrently, each with its own layer state
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestConvState(const char* name) noexcept -> std::string {
+    // configuration
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<16, 2>, hvx::util::VectorParam<8, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow, exec>;
+
+    // create random data, compute HW in two threads with independent states, compute SW and evaluate
+    hvx::sw::ConvEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval1(0.75f, 0.25f);
+    hvx::sw::ConvEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval2(0.75f, 0.25f);
+    hvx::nn::ConvState<conv> state1, state2;
+    std::thread thread1([&]() { hvx::HwConv<conv>(state1, eval1.GetSrcHw(), eval1.GetWgtsHw(), eval1.GetBiasHw(), eval1.GetDstHw()); });
+    std::thread thread2([&]() { hvx::HwConv<conv>(state2, eval2.GetSrcHw(), eval2.GetWgtsHw(), eval2.GetBiasHw(), eval2.GetDstHw()); });
+    thread1.join();
+    thread2.join();
+    return name + eval1.Compute() + "\n" + name + eval2.Compute() + "\n";
+}
+
+/*!
+ * @brief two chained convolutions running as a dataflow region (connected by channels) compared against the layer by layer execution
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestConvDataflow(const char* name) noexcept -> std::string {
+    // configuration (the second convolution consumes the output of the first one)
+    using conv1 = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                     hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                     hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                     hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                     underflow, exec>;
+    using conv2 = hvx::nn::ConvParam<dst_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                     hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<16, 2>, hvx::util::VectorParam<16, 2>,
+                                     hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                     hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                     underflow, exec>;
+    static_assert(std::is_same<typename conv1::dst_port, typename conv2::src_port>::value, "Port types of the chain do not match!");
+    static_assert(conv1::dst_dim::vec_elms == conv2::src_dim::vec_elms, "Tensor sizes of the chain do not match!");
+    constexpr auto src_elms = conv1::src_dim::vec_elms;
+    constexpr auto mid_elms = conv1::dst_dim::vec_elms;
+    constexpr auto dst_elms = conv2::dst_dim::vec_elms;
+
+    // layer by layer execution (the intermediate tensor is the input of the second evaluation)
+    hvx::sw::ConvEvaluate<conv1, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv1::dst_port, 0>> eval1(0.75f, 0.25f);
+    hvx::sw::ConvEvaluate<conv2, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv2::dst_port, 0>> eval2(0.75f, 0.25f);
+    hvx::HwConv<conv1>(eval1.GetSrcHw(), eval1.GetWgtsHw(), eval1.GetBiasHw(), eval1.GetDstHw());
+    std::copy(eval1.GetDstHw(), eval1.GetDstHw() + mid_elms, eval2.GetSrcHw());
+    hvx::HwConv<conv2>(eval2.GetSrcHw(), eval2.GetWgtsHw(), eval2.GetBiasHw(), eval2.GetDstHw());
+
+    // dataflow execution (only the channels hold intermediate data)
+    std::vector<typename conv2::dst_port> dst(dst_elms);
+    hvx::sim::Channel<typename conv1::src_port> chnl_src(2);
+    hvx::sim::Channel<typename conv1::dst_port> chnl_mid(2);
+    hvx::sim::Channel<typename conv2::dst_port> chnl_dst(2);
+    hvx::nn::ConvState<conv1> state1;
+    hvx::nn::ConvState<conv2> state2;
+    hvx::sim::Dataflow dataflow;
+    dataflow.AddSource(chnl_src, eval1.GetSrcHw(), src_elms)
+        .Add([&]() { hvx::HwConv<conv1>(state1, chnl_src.Port(), eval1.GetWgtsHw(), eval1.GetBiasHw(), chnl_mid.Port()); })
+        .Add([&]() { hvx::HwConv<conv2>(state2, chnl_mid.Port(), eval2.GetWgtsHw(), eval2.GetBiasHw(), chnl_dst.Port()); })
+        .AddSink(chnl_dst, dst.data(), dst_elms)
+        .Run();
+
+    // both executions need to be bit exact
+    const bool exact = (std::memcmp(dst.data(), eval2.GetDstHw(), dst_elms * sizeof(typename conv2::dst_port)) == 0);
+    return name + CheckExact(exact) + "\n";
+}
+
+/*!
+ * @brief batch and row band parallel convolution compared against the serial execution
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         int64_t row_bands_,
+         int64_t pad_,
+         int64_t dil_,
+         int64_t str_>
+auto
+TestConvParallel(const char* name) noexcept -> std::string {
+    // configuration
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<pad_, pad_>,
+                                    hvx::util::Array2dParam<dil_, dil_>, hvx::util::Array2dParam<str_, str_>, buffer_wgts, buffer_bias,
+                                    overflow, underflow, exec>;
+
+    // serial and parallel execution on the same data
+    hvx::sw::ConvEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(0.75f, 0.25f);
+    hvx::HwConv<conv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms);
+    hvx::sim::ThreadPool pool(4);
+    hvx::sim::ParallelConv<conv, true, row_bands_>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data(), pool);
+
+    // both executions need to be bit exact
+    const bool exact = (std::memcmp(dst.data(), eval.GetDstHw(), dst.size() * sizeof(typename conv::dst_port)) == 0);
+    return name + CheckExact(exact) + "\n";
+}
+
+/*!
+ * @brief im2col + GEMM convolution compared against the streaming execution
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         bool with_bias_,
+         int64_t knl_,
+         int64_t pad_,
+         int64_t dil_,
+         int64_t str_>
+auto
+TestConvGemm(const char* name) noexcept -> std::string {
+    // configuration
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<knl_, knl_>, hvx::util::VectorParam<knl_, knl_>,
+                                    hvx::util::Array2dParam<pad_, pad_>, hvx::util::Array2dParam<dil_, dil_>,
+                                    hvx::util::Array2dParam<str_, str_>, buffer_wgts, buffer_bias, overflow, underflow, exec>;
+    using gemm = hvx::conv_param<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                 hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                 hvx::util::VectorParam<knl_, knl_>, hvx::util::VectorParam<knl_, knl_>,
+                                 hvx::util::Array2dParam<pad_, pad_>, hvx::util::Array2dParam<dil_, dil_>,
+                                 hvx::util::Array2dParam<str_, str_>, buffer_wgts, buffer_bias, overflow, underflow, exec,
+                                 hvx::conv_e::kDirect, hvx::epilogue_param<>, hvx::sim_e::kGemm>;
+
+    // streaming and GEMM execution on the same data (called directly and selected by the layer parameters of the public API)
+    hvx::sw::ConvEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(0.75f, 0.25f);
+    hvx::nn::ConvState<conv> state;
+    hvx::nn::ConvTop<conv, with_bias_>(state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms), dst_sel(conv::dst_dim::vec_elms);
+    hvx::nn::ConvState<conv> gemm_state;
+    const bool done = hvx::nn::ConvGemmTop<conv, with_bias_>(gemm_state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data());
+    hvx::nn::ConvState<gemm> sel_state;
+    hvx::nn::ConvTop<gemm, with_bias_>(sel_state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst_sel.data());
+
+    // all executions need to be bit exact
+    const std::size_t bytes = dst.size() * sizeof(typename conv::dst_port);
+    const bool exact        = done && (std::memcmp(dst.data(), eval.GetDstHw(), bytes) == 0) &&
+                       (std::memcmp(dst_sel.data(), eval.GetDstHw(), bytes) == 0);
+    return name + CheckExact(exact) + "\n";
+}
+
+/*!
+ * @brief verifies that the Winograd result differs from the direct conv at most by the documented error bound
+ */
+template<typename conv_, typename wino_>
+auto
+TestConvWinogradBound(const typename conv_::dst_port* direct, const typename wino_::dst_port* wino, const float wgts_max) noexcept
+    -> std::string {
+    // the src values are in [-1,1]
+    const double bound = hvx::nn::ConvWinogradErrorBound<wino_>(1.0, static_cast<double>(wgts_max));
+    double error       = 0.0;
+    for (int64_t i = 0; i < conv_::dst_dim::vec_elms; ++i) {
+        for (int64_t j = 0; j < conv_::dst_dim::vec_size; ++j) {
+            const auto diff = static_cast<double>(static_cast<float>(direct[i].data[j])) - // NOLINT
+                              static_cast<double>(static_cast<float>(wino[i].data[j]));    // NOLINT
+            error = hvx::util::Max(error, hvx::util::Abs(diff));
+        }
+    }
+    const bool passed = (error <= bound);
+    if (!passed)
+        ++failures;
+    return " err: " + std::to_string(error) + " <= " + std::to_string(bound) + (passed ? " passed" : " FAILED");
+}
+
+/*!
+ * @brief Winograd convolution (weights transformed at load time) compared against the SW and the direct convolution
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         hvx::util::conv_e conv_type_,
+         bool with_bias_,
+         std::enable_if_t<wgts_type_::is_signed, bool> = true>
+auto
+TestConvWinograd(const char* name) noexcept -> std::string {
+    // the transformed weights of F(4x4,3x3) need more fraction bits than the dst (the kernel keeps the type of the direct conv)
+    constexpr int64_t tile = static_cast<int64_t>(conv_type_);
+    constexpr int64_t frac = dst_type_::frac_bits + hvx::nn::impl::WinogradFracBits<tile>();
+    constexpr bool wide    = (tile == 4) && std::is_integral<typename wgts_type_::data_type>::value;
+    using wino_wgts_type   = std::conditional_t<wide, hvx::util::dfixed<int32_t, frac>, wgts_type_>;
+
+    // configuration (the direct conv creates the weights in the default layout)
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow, exec>;
+    using wino = hvx::nn::ConvParam<src_type_, dst_type_, wino_wgts_type, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow, exec, conv_type_>;
+    constexpr float conv_max = 0.75f;
+    constexpr float wgts_max = conv_max / static_cast<float>(conv::knl_elms * conv::chnls);
+
+    // create random data, compute SW and the direct conv, transform the weights, compute HW and evaluate
+    std::vector<typename wino::wgts_vec> wgts(wino::wgts_vec_elms);
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms);
+    if (with_bias_ == true) {
+        hvx::sw::ConvEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(conv_max, 0.25f);
+        hvx::HwConv<conv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data());
+        hvx::nn::ConvWinogradWeights<wino>(eval.GetWgtsHw(), wgts.data());
+        hvx::HwConv<wino>(eval.GetSrcHw(), wgts.data(), eval.GetBiasHw(), eval.GetDstHw());
+        return name + eval.Compute() + TestConvWinogradBound<conv, wino>(dst.data(), eval.GetDstHw(), wgts_max) + "\n";
+    } else {
+        hvx::sw::ConvEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(conv_max);
+        hvx::HwConv<conv>(eval.GetSrcHw(), eval.GetWgtsHw(), dst.data());
+        hvx::nn::ConvWinogradWeights<wino>(eval.GetWgtsHw(), wgts.data());
+        hvx::HwConv<wino>(eval.GetSrcHw(), wgts.data(), eval.GetDstHw());
+        return name + eval.Compute() + TestConvWinogradBound<conv, wino>(dst.data(), eval.GetDstHw(), wgts_max) + "\n";
+    }
+}
+
+/*!
+ * @brief Winograd needs signed weights
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         hvx::util::conv_e conv_type_,
+         bool with_bias_,
+         std::enable_if_t<!wgts_type_::is_signed, bool> = true>
+auto
+TestConvWinograd(const char* name) noexcept -> std::string {
+    return name + std::string("not supported for unsigned weights\n");
+}
+
 /*!
  * @brief
  */
@@ -100,7 +373,43 @@ TestConvMultiple() noexcept -> std::string {
            // test stride
            TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 2, 2>("\t(str=2|2) ") +
            TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 1, 2>("\t(str=1|2) ") +
-           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 2, 1>("\t(str=2|1) ");
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 2, 1>("\t(str=2|1) ") +
+           // test row/col vectorization (the last one is a first layer with 3 src chnls)
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 1, 1, 2, 2>("\t(rc=2|2)  ") +
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 5, 5, 4, 4, 1, 1, 1, 1, 1, 4>(
+               "\t(rc=1|4, ker=5|5, dil=1|1) ") +
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 2, 2, 2, 2>(
+               "\t(rc=2|2, str=2|2) ") +
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 16, 3, 4, 3, 3, 3, 1, 1, 0, 0, 1, 1, 4, 4>(
+               "\t(rc=4|4, chnls=3) ") +
+           // test partially vectorized kernels (the kernel parts are computed one after another)
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1>(
+               "\t(knl=1|1) ") +
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 5, 5, 2, 2, 0, 0, 1, 1, 1, 1, 1, 5>(
+               "\t(knl=1|5, ker=5|5) ") +
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 1, 1, 2, 2, 1, 1, 3, 1>(
+               "\t(knl=3|1, dil=1|1, str=2|2) ") +
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 1, 1, 2, 2, 1, 3>(
+               "\t(knl=1|3, rc=2|2) ") +
+           // test fused epilogues
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 1, 1, 1, 1, 3, 3,
+                    relu_epilogue>("\t(epilogue=relu) ") +
+           TestConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 16, 2, 2, 3, 3, 1, 1, 0, 0, 1, 1, 1, 1, 3, 3,
+                    clip_epilogue>("\t(epilogue=clip) ") +
+           // test concurrent instances
+           TestConvState<src_type_, wgts_type_, bias_type_, dst_type_>("\t(state)   ") +
+           TestConvDataflow<src_type_, wgts_type_, bias_type_, dst_type_>("\t(dataflow) ") +
+           // test parallel execution
+           TestConvParallel<src_type_, wgts_type_, bias_type_, dst_type_, 1, 1, 0, 1>("\t(parallel, batch) ") +
+           TestConvParallel<src_type_, wgts_type_, bias_type_, dst_type_, 4, 1, 0, 1>("\t(parallel, bands=4) ") +
+           TestConvParallel<src_type_, wgts_type_, bias_type_, dst_type_, 2, 2, 1, 2>("\t(parallel, bands=2, dil=1, str=2) ") +
+           // test GEMM execution
+           TestConvGemm<src_type_, wgts_type_, bias_type_, dst_type_, true, 3, 1, 0, 1>("\t(gemm) ") +
+           TestConvGemm<src_type_, wgts_type_, bias_type_, dst_type_, false, 5, 2, 1, 2>("\t(gemm, no bias, ker=5, dil=1, str=2) ") +
+           // test Winograd execution
+           TestConvWinograd<src_type_, wgts_type_, bias_type_, dst_type_, hvx::util::conv_e::kWinograd2, true>("\t(wino=2) ") +
+           TestConvWinograd<src_type_, wgts_type_, bias_type_, dst_type_, hvx::util::conv_e::kWinograd2, false>("\t(wino=2, no bias) ") +
+           TestConvWinograd<src_type_, wgts_type_, bias_type_, dst_type_, hvx::util::conv_e::kWinograd4, true>("\t(wino=4) ");
 }
 
 /******************************************************************************************************************************************/
@@ -124,7 +433,8 @@ template<typename src_type_,
          int64_t dil_rows_,
          int64_t dil_cols_,
          int64_t str_rows_,
-         int64_t str_cols_>
+         int64_t str_cols_,
+         typename epilogue_ = hvx::util::EpilogueParam<>>
 auto
 TestDepth(const char* name) noexcept -> std::string {
     // configuration
@@ -133,7 +443,8 @@ TestDepth(const char* name) noexcept -> std::string {
                                 hvx::util::VectorParam<src_cols_, 1>, hvx::util::VectorParam<chnls_, chnls_vec_size_>,
                                 hvx::util::VectorParam<knl_rows_, knl_rows_>, hvx::util::VectorParam<knl_cols_, knl_cols_>,
                                 hvx::util::Array2dParam<pad_rows_, pad_cols_>, hvx::util::Array2dParam<dil_rows_, dil_cols_>,
-                                hvx::util::Array2dParam<str_rows_, str_cols_>, buffer_wgts, buffer_bias, overflow, underflow, exec>;
+                                hvx::util::Array2dParam<str_rows_, str_cols_>, buffer_wgts, buffer_bias, overflow, underflow, exec,
+                                epilogue_>;
 
     // create random data, compute SW, compute HW and evaluate
     if (with_bias_ == true) {
@@ -147,6 +458,234 @@ TestDepth(const char* name) noexcept -> std::string {
     }
 }
 
+/*!
+ * @brief convolution followed by a BatchNorm, which is folded into the weights and bias when they are loaded
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         int64_t chnl_vec_size_,
+         int64_t fm_vec_size_,
+         int64_t knl_size_,
+         int64_t pad_size_>
+auto
+TestConvBatchNorm(const char* name) noexcept -> std::string {
+    // configuration
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<16, fm_vec_size_>,
+                                    hvx::util::VectorParam<8, chnl_vec_size_>, hvx::util::VectorParam<knl_size_, knl_size_>,
+                                    hvx::util::VectorParam<knl_size_, knl_size_>, hvx::util::Array2dParam<pad_size_, pad_size_>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow, exec>;
+
+    // fold the BatchNorm, compute SW, compute HW and evaluate
+    hvx::sw::ConvBatchNormEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(0.75f, 0.1f);
+    hvx::HwConv<conv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    const auto& report = eval.GetReport();
+    return name + eval.Compute() + " fold err (wgts=" + std::to_string(report.wgts.max_err) +
+           " bias=" + std::to_string(report.bias.max_err) + " sat=" + std::to_string(report.wgts.saturated + report.bias.saturated) + ")\n";
+}
+
+/*!
+ * @brief convolution followed by a BatchNorm, which is folded into the kernel of a Winograd conv before its transform, compared against
+ * the SW and the folded direct convolution
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         hvx::util::conv_e conv_type_,
+         std::enable_if_t<wgts_type_::is_signed, bool> = true>
+auto
+TestConvBatchNormWinograd(const char* name) noexcept -> std::string {
+    // configuration
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow, exec>;
+    using wino = hvx::nn::ConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow, exec, conv_type_>;
+
+    // the folded kernel is at most the kernel divided by the smallest sqrt(var + eps) of the evaluation (var >= 0.8, gamma <= 1)
+    constexpr float conv_max = 0.75f;
+    const float wgts_max     = conv_max / static_cast<float>(conv::knl_elms * conv::chnls) / std::sqrt(0.8f);
+
+    // fold the BatchNorm into both layers, compute SW, compute HW and evaluate
+    hvx::sw::ConvBatchNormEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(conv_max, 0.1f);
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms);
+    std::vector<typename wino::wgts_vec> wgts(wino::wgts_vec_elms);
+    std::vector<typename wino::bias_vec> bias(wino::bias_vec_elms);
+    hvx::HwConv<conv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data());
+    const auto report = eval.template FoldWinograd<wino>(wgts.data(), bias.data());
+    hvx::HwConv<wino>(eval.GetSrcHw(), wgts.data(), bias.data(), eval.GetDstHw());
+    return name + eval.Compute() + " fold err (wgts=" + std::to_string(report.wgts.max_err) + ")" +
+           TestConvWinogradBound<conv, wino>(dst.data(), eval.GetDstHw(), wgts_max) + "\n";
+}
+
+/*!
+ * @brief Winograd needs signed weights
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         hvx::util::conv_e conv_type_,
+         std::enable_if_t<!wgts_type_::is_signed, bool> = true>
+auto
+TestConvBatchNormWinograd(const char* name) noexcept -> std::string {
+    return name + std::string("not supported for unsigned weights\n");
+}
+
+/*!
+ * @brief
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestConvBatchNormMultiple() noexcept -> std::string {
+    return "  Convolution + BatchNorm (folded): src[(16,1),(32,1),(8,2)] dst[(?,1),(?,1),(16,2)]:\n" +
+           TestConvBatchNorm<src_type_, wgts_type_, bias_type_, dst_type_, 2, 2, 3, 1>("\t(default) ") +
+           TestConvBatchNorm<src_type_, wgts_type_, bias_type_, dst_type_, 1, 4, 3, 1>("\t(vec=1|4) ") +
+           TestConvBatchNorm<src_type_, wgts_type_, bias_type_, dst_type_, 4, 1, 3, 1>("\t(vec=4|1) ") +
+           TestConvBatchNorm<src_type_, wgts_type_, bias_type_, dst_type_, 2, 2, 1, 0>("\t(ker=1|1) ") +
+           TestConvBatchNormWinograd<src_type_, wgts_type_, bias_type_, dst_type_, hvx::util::conv_e::kWinograd2>("\t(wino=2) ");
+}
+
+/*!
+ * @brief per-channel quantized convolution (int32 accumulation and requantization) compared against the integer SW reference and the
+ * GEMM execution. The weights and bias are quantized from floating-point values, the src scale maps the largest src code to 1.
+ */
+template<typename src_type_,
+         typename dst_type_,
+         int64_t chnl_vec_size_,
+         int64_t fm_vec_size_,
+         int64_t knl_size_,
+         int64_t pad_size_,
+         int64_t src_zero_,
+         hvx::util::underflow_e underflow_type_ = hvx::util::underflow_e::kRound,
+         typename epilogue_                     = hvx::util::EpilogueParam<>>
+auto
+TestConvRequant(const char* name) noexcept -> std::string {
+    // configuration
+    using conv = hvx::nn::ConvParam<src_type_, dst_type_, hvx::util::dfixed<int8_t, 0>, hvx::util::dqbias<int32_t, src_zero_>, batch_v,
+                                    hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, chnl_vec_size_>,
+                                    hvx::util::VectorParam<16, fm_vec_size_>, hvx::util::VectorParam<knl_size_, knl_size_>,
+                                    hvx::util::VectorParam<knl_size_, knl_size_>, hvx::util::Array2dParam<pad_size_, pad_size_>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    underflow_type_, exec, hvx::util::conv_e::kDirect, epilogue_>;
+    constexpr auto src_scale = 1.0f / static_cast<float>(std::numeric_limits<typename src_type_::data_type>::max());
+    constexpr auto dst_scale = 4.0f / static_cast<float>(std::numeric_limits<typename dst_type_::data_type>::max());
+
+    // quantize the weights and bias, compute SW, compute HW and evaluate
+    hvx::sw::ConvRequantEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(src_scale, dst_scale,
+                                                                                                                 0.5f, 0.25f);
+    hvx::HwConv<conv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    const bool exact_sw = eval.IsExact();
+
+    // the GEMM execution needs to be bit exact
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms);
+    hvx::nn::ConvState<conv> gemm_state;
+    const bool done = hvx::nn::ConvGemmTop<conv, true>(gemm_state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data());
+    const auto gemm = done ? CheckExact(std::memcmp(dst.data(), eval.GetDstHw(), dst.size() * sizeof(typename conv::dst_port)) == 0)
+                           : std::string("n/a");
+
+    // the quantization error of the weights is reported in the real scale
+    const auto& report = eval.GetReport();
+    return name + eval.Compute() + " quant err (wgts=" + std::to_string(report.wgts.max_err) + ") ref=" + CheckExact(exact_sw) +
+           " gemm=" + gemm + "\n";
+}
+
+/*!
+ * @brief row band parallel per-channel quantized convolution compared against the integer SW reference and the serial execution (the
+ * padding and halo rows of a band hold the src zero point)
+ */
+template<int64_t row_bands_, int64_t pad_size_, int64_t src_zero_>
+auto
+TestConvRequantParallel(const char* name) noexcept -> std::string {
+    // configuration
+    using type = hvx::util::dfixed<int8_t, 0>;
+    using conv = hvx::nn::ConvParam<type, type, type, hvx::util::dqbias<int32_t, src_zero_>, batch_v, hvx::util::VectorParam<16, 1>,
+                                    hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 2>,
+                                    hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<pad_size_, pad_size_>,
+                                    hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>, buffer_wgts, buffer_bias, overflow,
+                                    hvx::util::underflow_e::kRound, exec>;
+    constexpr auto src_scale = 1.0f / 127.0f;
+    constexpr auto dst_scale = 4.0f / 127.0f;
+
+    // quantize the weights and bias, compute SW, compute HW serial and parallel on the same data
+    hvx::sw::ConvRequantEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(src_scale, dst_scale,
+                                                                                                                 0.5f, 0.25f);
+    hvx::HwConv<conv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    const bool exact_sw = eval.IsExact();
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms);
+    hvx::sim::ThreadPool pool(4);
+    hvx::sim::ParallelConv<conv, true, row_bands_>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data(), pool);
+
+    // the parallel execution needs to be bit exact
+    const bool exact = (std::memcmp(dst.data(), eval.GetDstHw(), dst.size() * sizeof(typename conv::dst_port)) == 0);
+    return name + eval.Compute() + " ref=" + CheckExact(exact_sw) + " serial=" + CheckExact(exact) + "\n";
+}
+
+/*!
+ * @brief per-channel quantized dense layer compared against the integer SW reference (of the underlying convolution)
+ */
+template<int64_t chnl_vec_size_, int64_t fm_vec_size_, int64_t src_zero_, typename epilogue_ = hvx::util::EpilogueParam<>>
+auto
+TestDenseRequant(const char* name) noexcept -> std::string {
+    // configuration
+    using type  = hvx::util::dfixed<int8_t, 0>;
+    using dense = hvx::nn::DenseParam<type, type, type, hvx::util::dqbias<int32_t, src_zero_>, batch_v,
+                                      hvx::util::VectorParam<512, chnl_vec_size_>, hvx::util::VectorParam<256, fm_vec_size_>, buffer_wgts,
+                                      buffer_bias, overflow, hvx::util::underflow_e::kRound, exec, epilogue_>;
+    using conv  = typename dense::conv_param;
+
+    // quantize the weights and bias, compute SW, compute HW and evaluate
+    constexpr auto src_scale = 1.0f / 127.0f;
+    constexpr auto dst_scale = 16.0f / 127.0f;
+    hvx::sw::ConvRequantEvaluate<conv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename conv::dst_port, 0>> eval(src_scale, dst_scale,
+                                                                                                                 0.5f, 0.25f);
+    hvx::HwDense<dense>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    const bool exact_sw = eval.IsExact();
+    const auto& report  = eval.GetReport();
+    return name + eval.Compute() + " quant err (wgts=" + std::to_string(report.wgts.max_err) + ") ref=" + CheckExact(exact_sw) + "\n";
+}
+
+/*!
+ * @brief per-channel quantized layers (int8 codes, the dst zero point is the shift of the epilogue)
+ */
+auto
+TestRequantMultiple() noexcept -> std::string {
+    using int8  = hvx::util::dfixed<int8_t, 0>;
+    using uint8 = hvx::util::dfixed<uint8_t, 0>;
+
+    // the dst zero point is the shift of the epilogue, a fused ReLU clips at the dst zero point
+    using zero_epilogue = hvx::util::EpilogueParam<hvx::util::elmwise_e::None, hvx::util::RatioParam<1, 1>, hvx::util::RatioParam<-3, 1>>;
+    using relu_epilogue = hvx::util::EpilogueParam<hvx::util::elmwise_e::Clip, hvx::util::RatioParam<1, 1>, hvx::util::RatioParam<-3, 1>,
+                                                   hvx::util::RatioParam<-3, 1>, hvx::util::RatioParam<127, 1>>;
+    using uint8_epilogue = hvx::util::EpilogueParam<hvx::util::elmwise_e::None, hvx::util::RatioParam<1, 1>, hvx::util::RatioParam<128, 1>>;
+    return "  Convolution (per-channel quantized): src[(16,1),(32,1),(8,2)] dst[(?,1),(?,1),(16,2)] ker(3,3) pad(1,1):\n" +
+           TestConvRequant<int8, int8, 2, 2, 3, 1, 0>("\t(default) ") +
+           TestConvRequant<int8, int8, 2, 2, 3, 1, 0, hvx::util::underflow_e::kRound, zero_epilogue>("\t(dst zero=-3) ") +
+           TestConvRequant<int8, int8, 2, 2, 3, 1, 0, hvx::util::underflow_e::kRound, relu_epilogue>("\t(dst zero=-3, relu) ") +
+           TestConvRequant<int8, int8, 2, 2, 3, 0, 5>("\t(src zero=5, pad=0|0) ") +
+           TestConvRequant<int8, int8, 2, 2, 3, 1, 5>("\t(src zero=5) ") +
+           TestConvRequant<int8, int8, 1, 4, 1, 0, -7>("\t(src zero=-7, ker=1|1, vec=1|4) ") +
+           TestConvRequant<int8, int8, 4, 1, 3, 1, -7, hvx::util::underflow_e::kTrunc>("\t(src zero=-7, trunc, vec=4|1) ") +
+           TestConvRequant<int8, int8, 2, 2, 3, 1, 3, hvx::util::underflow_e::kFloor>("\t(src zero=3, floor) ") +
+           TestConvRequant<int8, int8, 2, 2, 3, 1, 3, hvx::util::underflow_e::kCeil>("\t(src zero=3, ceil) ") +
+           TestConvRequant<uint8, uint8, 2, 2, 3, 1, 128, hvx::util::underflow_e::kRound, uint8_epilogue>(
+               "\t(uint8, src zero=128, dst zero=128) ") +
+           TestConvRequantParallel<4, 1, 5>("\t(parallel, bands=4, src zero=5) ") +
+           TestConvRequantParallel<2, 2, -7>("\t(parallel, bands=2, src zero=-7, pad=2|2) ") +
+           "  Dense (per-channel quantized): src[(512,2)] dst[(256,2)]:\n" +
+           TestDenseRequant<2, 2, 0>("\t(default) ") +
+           TestDenseRequant<8, 4, 9, zero_epilogue>("\t(src zero=9, dst zero=-3, vec=8|4) ");
+}
+
 /*!
  * @brief
  */
@@ -175,7 +714,139 @@ TestDepthMultiple() noexcept -> std::string {
            // test stride
            TestDepth<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 2, 3, 3, 1, 1, 0, 0, 2, 2>("\t(str=2|2) ") +
            TestDepth<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 2, 3, 3, 1, 1, 0, 0, 1, 2>("\t(str=1|2) ") +
-           TestDepth<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 2, 3, 3, 1, 1, 0, 0, 2, 1>("\t(str=2|1) ");
+           TestDepth<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 2, 3, 3, 1, 1, 0, 0, 2, 1>("\t(str=2|1) ") +
+           // test fused epilogue
+           TestDepth<src_type_, wgts_type_, bias_type_, dst_type_, true, 16, 32, 8, 2, 3, 3, 1, 1, 0, 0, 1, 1, relu_epilogue>(
+               "\t(epilogue=relu) ");
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         bool with_bias_,
+         int64_t chnls_,
+         int64_t fms_,
+         int64_t chnl_vec_size_,
+         int64_t fm_vec_size_,
+         int64_t knl_,
+         int64_t pad_,
+         int64_t str_,
+         typename epilogue_ = hvx::util::EpilogueParam<>>
+auto
+TestSeparable(const char* name) noexcept -> std::string {
+    // configuration (the depthwise results have the dst type)
+    using sep = hvx::nn::SeparableParam<src_type_, dst_type_, wgts_type_, bias_type_, dst_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                        hvx::util::VectorParam<32, 1>, hvx::util::VectorParam<chnls_, chnl_vec_size_>,
+                                        hvx::util::VectorParam<fms_, fm_vec_size_>, hvx::util::VectorParam<knl_, knl_>,
+                                        hvx::util::VectorParam<knl_, knl_>, hvx::util::Array2dParam<pad_, pad_>,
+                                        hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<str_, str_>, buffer_wgts, buffer_bias,
+                                        overflow, underflow, exec, epilogue_>;
+
+    // create random data, compute SW, compute HW and evaluate
+    if (with_bias_ == true) {
+        hvx::sw::SeparableEvaluate<sep, hvx::sw::EvaluateParam<false, 4, 4, 4, typename sep::dst_port, 0>> eval(0.75f, 0.25f);
+        hvx::HwSeparable<sep>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetPwWgtsHw(), eval.GetPwBiasHw(),
+                              eval.GetDstHw());
+        return name + eval.Compute() + "\n";
+    } else {
+        hvx::sw::SeparableEvaluate<sep, hvx::sw::EvaluateParam<false, 4, 4, 4, typename sep::dst_port, 0>> eval(0.75f);
+        hvx::HwSeparable<sep>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetPwWgtsHw(), eval.GetDstHw());
+        return name + eval.Compute() + "\n";
+    }
+}
+
+/*!
+ * @brief
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestSeparableMultiple() noexcept -> std::string {
+    return "  Separable: src[(16,1),(32,1),(8,2)] dst[(16,2)] ker(3,3) pad(1,1) str(1,1):\n" +
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 3, 1, 1>("\t(default) ") +
+           // test without bias
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, false, 8, 16, 2, 2, 3, 1, 1>("\t(no bias) ") +
+           // test different vector sizes
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 8, 4, 3, 1, 1>("\t(vec=8|4) ") +
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 1, 16, 3, 1, 1>("\t(vec=1|16) ") +
+           // test different kernel sizes and strides
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 5, 2, 1>("\t(ker=5|5) ") +
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 3, 1, 2>("\t(str=2|2) ") +
+           // test fused epilogue (activation on both stages, scale/shift only on the pointwise stage)
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 3, 1, 1, relu_epilogue>("\t(epilogue=relu) ") +
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 3, 1, 1, clip_epilogue>("\t(epilogue=clip) ") +
+           TestSeparable<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 3, 1, 1,
+                         hvx::util::EpilogueParam<hvx::util::elmwise_e::None, hvx::util::RatioParam<3, 2>, hvx::util::RatioParam<-1, 8>>>(
+               "\t(epilogue=3x/2-1/8) ");
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         bool with_bias_,
+         int64_t chnls_,
+         int64_t fms_,
+         int64_t chnl_vec_size_,
+         int64_t fm_vec_size_,
+         int64_t knl_,
+         int64_t pad_,
+         int64_t str_,
+         int64_t out_pad_,
+         typename epilogue_ = hvx::util::EpilogueParam<>>
+auto
+TestTransposedConv(const char* name) noexcept -> std::string {
+    // configuration
+    using tconv = hvx::nn::TransposedConvParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<8, 1>,
+                                               hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<chnls_, chnl_vec_size_>,
+                                               hvx::util::VectorParam<fms_, fm_vec_size_>, hvx::util::VectorParam<knl_, knl_>,
+                                               hvx::util::VectorParam<knl_, knl_>, hvx::util::Array2dParam<pad_, pad_>,
+                                               hvx::util::Array2dParam<str_, str_>, hvx::util::Array2dParam<out_pad_, out_pad_>,
+                                               buffer_wgts, buffer_bias, overflow, underflow, exec, epilogue_>;
+
+    // create random data, compute SW, compute HW and evaluate
+    if (with_bias_ == true) {
+        hvx::sw::TransposedConvEvaluate<tconv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename tconv::dst_port, 0>> eval(0.75f, 0.25f);
+        hvx::HwTransposedConv<tconv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+        return name + eval.Compute() + "\n";
+    } else {
+        hvx::sw::TransposedConvEvaluate<tconv, hvx::sw::EvaluateParam<false, 4, 4, 4, typename tconv::dst_port, 0>> eval(0.75f);
+        hvx::HwTransposedConv<tconv>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetDstHw());
+        return name + eval.Compute() + "\n";
+    }
+}
+
+/*!
+ * @brief
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestTransposedConvMultiple() noexcept -> std::string {
+    return "  TransposedConv: src[(8,1),(16,1),(8,2)] dst[(16,2)] ker(4,4) pad(1,1) str(2,2):\n" +
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 4, 1, 2, 0>("\t(default) ") +
+           // test without bias
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, false, 8, 16, 2, 2, 4, 1, 2, 0>("\t(no bias) ") +
+           // test different vector sizes
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 8, 4, 4, 1, 2, 0>("\t(vec=8|4) ") +
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 1, 16, 4, 1, 2, 0>("\t(vec=1|16) ") +
+           // test different kernel sizes, paddings and strides
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 2, 0, 2, 0>("\t(ker=2|2 pad=0|0) ") +
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 3, 1, 2, 1>("\t(ker=3|3 out_pad=1|1) ") +
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 3, 1, 1, 0>("\t(str=1|1) ") +
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 4, 0, 4, 0>("\t(ker=4|4 str=4|4) ") +
+           // test fused epilogue
+           TestTransposedConv<src_type_, wgts_type_, bias_type_, dst_type_, true, 8, 16, 2, 2, 4, 1, 2, 0, relu_epilogue>(
+               "\t(epilogue=relu) ");
 }
 
 /******************************************************************************************************************************************/
@@ -249,6 +920,151 @@ TestPoolMultiple() noexcept -> std::string {
            TestPool<avg_pool, src_type_, dst_type_, 16, 32, 8, 2, 2, 2, 0, 0, 0, 0, 3, 3>("\t(str=3|3) ");
 }
 
+/*!
+ * @brief fills a tensor with small integers (multiples of step_), the window layers compute them exactly in HW and SW
+ */
+template<typename dim_, int64_t step_, typename vec_>
+auto
+SetSmallInts(std::vector<vec_>& dst, const int64_t seed) noexcept -> void {
+    for (int64_t i = 0; i < dim_::vec_elms; ++i) {
+        for (int64_t j = 0; j < dim_::vec_size; ++j) {
+            const auto value = ((((i * dim_::vec_size) + j) * seed) % 9) - 4;
+            dst[i].Get(j) = static_cast<typename vec_::type>(static_cast<float>(value * step_));
+        }
+    }
+}
+
+/*!
+ * @brief depthwise layer on small integers, the window (padding, dilation and stride) has to match the SW function exactly
+ */
+template<int64_t knl_, int64_t pad_rows_, int64_t pad_cols_, int64_t dil_rows_, int64_t dil_cols_, int64_t str_rows_, int64_t str_cols_>
+auto
+TestDepthExact(const char* name) noexcept -> std::string {
+    using type  = hvx::util::dfixed<int16_t, 0>;
+    using depth = hvx::nn::DepthwiseParam<type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<32, 1>,
+                                          hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<knl_, knl_>,
+                                          hvx::util::VectorParam<knl_, knl_>, hvx::util::Array2dParam<pad_rows_, pad_cols_>,
+                                          hvx::util::Array2dParam<dil_rows_, dil_cols_>, hvx::util::Array2dParam<str_rows_, str_cols_>,
+                                          buffer_wgts, buffer_bias, overflow, underflow, exec>;
+
+    std::vector<typename depth::src_vec> src(depth::src_dim::vec_elms);
+    std::vector<typename depth::wgts_vec> wgts(depth::wgts_dim::vec_elms);
+    std::vector<typename depth::bias_vec> bias(depth::bias_dim::vec_elms);
+    SetSmallInts<typename depth::src_dim, 1>(src, 7);
+    SetSmallInts<typename depth::wgts_dim, 1>(wgts, 5);
+    SetSmallInts<typename depth::bias_dim, 1>(bias, 2);
+    hvx::sw::DepthwiseEvaluate<depth, hvx::sw::EvaluateParam<false, 4, 4, 4, typename depth::dst_port, 0>> eval(src.data(), wgts.data(),
+                                                                                                               bias.data());
+    hvx::HwDepthwise<depth>(src.data(), wgts.data(), bias.data(), eval.GetDstHw());
+    return name + CheckExact(eval.IsExact()) + "\n";
+}
+
+/*!
+ * @brief pooling layer on small integers, the window (padding, dilation and stride) has to match the SW function exactly
+ */
+template<hvx::util::pooling_e pool_type_,
+         int64_t knl_,
+         int64_t pad_rows_,
+         int64_t pad_cols_,
+         int64_t dil_rows_,
+         int64_t dil_cols_,
+         int64_t str_rows_,
+         int64_t str_cols_>
+auto
+TestPoolExact(const char* name) noexcept -> std::string {
+    using type = hvx::util::dfixed<int16_t, 8>;
+    using pool = hvx::nn::PoolParam<type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<32, 1>,
+                                    hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<knl_, knl_>, hvx::util::VectorParam<knl_, knl_>,
+                                    hvx::util::Array2dParam<pad_rows_, pad_cols_>, hvx::util::Array2dParam<dil_rows_, dil_cols_>,
+                                    hvx::util::Array2dParam<str_rows_, str_cols_>, overflow, underflow, exec>;
+
+    // the average of a kernel is an integer, if every value is a multiple of the kernel size (the normalization needs fraction bits)
+    std::vector<typename pool::src_vec> src(pool::src_dim::vec_elms);
+    SetSmallInts<typename pool::src_dim, knl_ * knl_>(src, 7);
+    hvx::sw::PoolEvaluate<pool, hvx::sw::EvaluateParam<false, 4, 4, 4, typename pool::dst_port, 0>, pool_type_> eval(src.data());
+    if (pool_type_ == hvx::util::pooling_e::kAvg)
+        hvx::HwPoolAvg<pool>(src.data(), eval.GetDstHw());
+    else
+        hvx::HwPoolMax<pool>(src.data(), eval.GetDstHw());
+    return name + CheckExact(eval.IsExact()) + "\n";
+}
+
+/*!
+ * @brief bit exact depthwise and pooling layers for all window options, they share the window of the conv layer
+ */
+auto
+TestWindowLayers() noexcept -> void {
+    constexpr auto avg_pool = hvx::util::pooling_e::kAvg;
+    constexpr auto max_pool = hvx::util::pooling_e::kMax;
+
+    std::cout << "\nWindow layers (small integers): src[(16,1),(32,1),(8,2)]\n"
+              << "  Depthwise ker(3,3):\n"
+              << TestDepthExact<3, 1, 1, 0, 0, 1, 1>("\t(default) ")
+              << TestDepthExact<3, 0, 0, 0, 0, 1, 1>("\t(pad=0|0) ")
+              << TestDepthExact<3, 2, 1, 0, 0, 1, 1>("\t(pad=2|1) ")
+              << TestDepthExact<3, 1, 1, 1, 0, 1, 1>("\t(dil=1|0) ")
+              << TestDepthExact<3, 1, 1, 1, 1, 1, 1>("\t(dil=1|1) ")
+              << TestDepthExact<3, 1, 1, 0, 0, 2, 2>("\t(str=2|2) ")
+              << TestDepthExact<3, 1, 1, 0, 0, 1, 2>("\t(str=1|2) ")
+              << TestDepthExact<3, 2, 2, 1, 1, 2, 2>("\t(all)     ")
+              << "  Pooling ker(2,2):\n"
+              << TestPoolExact<max_pool, 2, 0, 0, 0, 0, 2, 2>("\t(MaxPool) ")
+              << TestPoolExact<avg_pool, 2, 0, 0, 0, 0, 2, 2>("\t(AvgPool) ")
+              << TestPoolExact<max_pool, 2, 1, 1, 0, 0, 2, 2>("\t(pad=1|1) ")
+              << TestPoolExact<avg_pool, 2, 1, 0, 0, 0, 2, 2>("\t(pad=1|0) ")
+              << TestPoolExact<max_pool, 2, 0, 0, 1, 1, 2, 2>("\t(dil=1|1) ")
+              << TestPoolExact<avg_pool, 2, 0, 0, 0, 1, 2, 2>("\t(dil=0|1) ")
+              << TestPoolExact<max_pool, 2, 0, 0, 0, 0, 1, 2>("\t(str=1|2) ")
+              << TestPoolExact<avg_pool, 2, 0, 0, 0, 0, 3, 3>("\t(str=3|3) ");
+}
+
+/*!
+ * @brief
+ */
+template<hvx::util::pooling_e pool_type_, typename src_type_, typename dst_type_, int64_t src_rows_, int64_t src_cols_, int64_t chnls_,
+         int64_t chnls_vec_size_>
+auto
+TestGlobalPool(const char* name) noexcept -> std::string {
+    // configuration
+    using pool = hvx::nn::GlobalPoolParam<src_type_, dst_type_, batch_v, hvx::util::VectorParam<src_rows_, 1>,
+                                          hvx::util::VectorParam<src_cols_, 1>, hvx::util::VectorParam<chnls_, chnls_vec_size_>, overflow,
+                                          underflow, exec, pool_type_>;
+
+    // create random data, compute SW, compute HW and evaluate
+    hvx::sw::GlobalPoolEvaluate<pool, hvx::sw::EvaluateParam<false, 4, 4, 4, typename pool::dst_port, 0>, pool_type_> eval;
+    if (pool_type_ == hvx::util::pooling_e::kAvg)
+        hvx::HwGlobalPoolAvg<pool>(eval.GetSrcHw(), eval.GetDstHw());
+    else if (pool_type_ == hvx::util::pooling_e::kMax)
+        hvx::HwGlobalPoolMax<pool>(eval.GetSrcHw(), eval.GetDstHw());
+    else
+        hvx::HwGlobalPoolSum<pool>(eval.GetSrcHw(), eval.GetDstHw());
+    return name + eval.Compute() + "\n";
+}
+
+/*!
+ * @brief
+ */
+template<typename src_type_, typename dst_type_>
+auto
+TestGlobalPoolMultiple() noexcept -> std::string {
+    constexpr auto avg_pool = hvx::util::pooling_e::kAvg;
+    constexpr auto max_pool = hvx::util::pooling_e::kMax;
+    constexpr auto sum_pool = hvx::util::pooling_e::kSum;
+
+    // the sum needs 8 more integer bits
+    using sum_type = hvx::util::dfixed<typename dst_type_::data_type, dst_type_::frac_bits - 8>;
+
+    return "  Global pooling (AvgPool): src[(16,1),(32,1),(8,2)]:\n" +
+           TestGlobalPool<avg_pool, src_type_, dst_type_, 16, 32, 8, 2>("\t(default) ") +
+           TestGlobalPool<max_pool, src_type_, dst_type_, 16, 32, 8, 2>("\t(MaxPool) ") +
+           TestGlobalPool<sum_pool, src_type_, sum_type, 4, 4, 8, 2>("\t(SumPool src=4|4) ") +
+           // test vector
+           TestGlobalPool<avg_pool, src_type_, dst_type_, 16, 32, 8, 1>("\t(vec=1)   ") +
+           TestGlobalPool<avg_pool, src_type_, dst_type_, 16, 32, 8, 8>("\t(vec=8)   ") +
+           // test number of pixels that is no power of 2
+           TestGlobalPool<avg_pool, src_type_, dst_type_, 7, 7, 8, 2>("\t(src=7|7) ");
+}
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -262,12 +1078,15 @@ template<typename src_type_,
          int64_t fms_,
          int64_t chnl_vec_size_,
          int64_t fm_vec_size_,
-         bool with_bias_>
+         bool with_bias_,
+         typename dense_batch_v_ = batch_v,
+         typename epilogue_      = hvx::util::EpilogueParam<>>
 auto
 TestDense(const char* name) noexcept -> std::string {
     // configuration
-    using dense = hvx::nn::DenseParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<chnls_, chnl_vec_size_>,
-                                      hvx::util::VectorParam<fms_, fm_vec_size_>, buffer_wgts, buffer_bias, overflow, underflow, exec>;
+    using dense = hvx::nn::DenseParam<src_type_, dst_type_, wgts_type_, bias_type_, dense_batch_v_,
+                                      hvx::util::VectorParam<chnls_, chnl_vec_size_>, hvx::util::VectorParam<fms_, fm_vec_size_>,
+                                      buffer_wgts, buffer_bias, overflow, underflow, exec, epilogue_>;
 
     // create random data, compute SW, compute HW and evaluate
     if (with_bias_ == true) {
@@ -281,6 +1100,60 @@ TestDense(const char* name) noexcept -> std::string {
     }
 }
 
+/*!
+ * @brief batch parallel dense layer compared against the serial execution
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestDenseParallel(const char* name) noexcept -> std::string {
+    // configuration
+    using dense = hvx::nn::DenseParam<src_type_, dst_type_, wgts_type_, bias_type_, hvx::util::VectorParam<8, 1>,
+                                      hvx::util::VectorParam<512, 2>, hvx::util::VectorParam<512, 2>, buffer_wgts, buffer_bias, overflow,
+                                      underflow, exec>;
+
+    // serial and parallel execution on the same data
+    hvx::sw::DenseEvaluate<dense, hvx::sw::EvaluateParam<false, 4, 4, 4, typename dense::dst_port, 0>> eval(0.75f, 0.25f);
+    hvx::HwDense<dense>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    std::vector<typename dense::dst_port> dst(dense::dst_dim::vec_elms);
+    hvx::sim::ThreadPool pool(4);
+    hvx::sim::ParallelDense<dense>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data(), pool);
+
+    // both executions need to be bit exact
+    const bool exact = (std::memcmp(dst.data(), eval.GetDstHw(), dst.size() * sizeof(typename dense::dst_port)) == 0);
+    return name + CheckExact(exact) + "\n";
+}
+
+/*!
+ * @brief GEMM dense layer compared against the streaming execution
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestDenseGemm(const char* name) noexcept -> std::string {
+    // configuration
+    using dense = hvx::nn::DenseParam<src_type_, dst_type_, wgts_type_, bias_type_, hvx::util::VectorParam<8, 1>,
+                                      hvx::util::VectorParam<512, 2>, hvx::util::VectorParam<512, 2>, buffer_wgts, buffer_bias, overflow,
+                                      underflow, exec>;
+    using gemm  = hvx::dense_param<src_type_, dst_type_, wgts_type_, bias_type_, hvx::util::VectorParam<8, 1>,
+                                   hvx::util::VectorParam<512, 2>, hvx::util::VectorParam<512, 2>, buffer_wgts, buffer_bias, overflow,
+                                   underflow, exec, hvx::epilogue_param<>, hvx::sim_e::kGemm>;
+
+    // streaming and GEMM execution on the same data (called directly and selected by the layer parameters of the public API)
+    hvx::sw::DenseEvaluate<dense, hvx::sw::EvaluateParam<false, 4, 4, 4, typename dense::dst_port, 0>> eval(0.75f, 0.25f);
+    hvx::nn::DenseState<dense> state;
+    hvx::nn::DenseTop<dense>(state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
+    std::vector<typename dense::dst_port> dst(dense::dst_dim::vec_elms), dst_sel(dense::dst_dim::vec_elms);
+    hvx::nn::DenseState<dense> gemm_state;
+    const bool done = hvx::nn::DenseGemmTop<dense>(gemm_state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst.data());
+    hvx::nn::DenseState<gemm> sel_state;
+    hvx::nn::DenseTop<gemm>(sel_state, eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), dst_sel.data());
+
+    // all executions need to be bit exact
+    const std::size_t bytes = dst.size() * sizeof(typename dense::dst_port);
+    const bool exact        = done && (std::memcmp(dst.data(), eval.GetDstHw(), bytes) == 0) &&
+                       (std::memcmp(dst_sel.data(), eval.GetDstHw(), bytes) == 0);
+    return name + CheckExact(exact) + "\n";
+}
+
 /*!
  * @brief
  */
@@ -293,7 +1166,82 @@ TestDenseMultiple() noexcept -> std::string {
            // test vector
            TestDense<src_type_, wgts_type_, bias_type_, dst_type_, 512, 512, 1, 2, true>("\t(vec=1|2) ") +
            TestDense<src_type_, wgts_type_, bias_type_, dst_type_, 512, 512, 2, 1, true>("\t(vec=2|1) ") +
-           TestDense<src_type_, wgts_type_, bias_type_, dst_type_, 512, 512, 8, 8, true>("\t(vec=8|8) ");
+           TestDense<src_type_, wgts_type_, bias_type_, dst_type_, 512, 512, 8, 8, true>("\t(vec=8|8) ") +
+           TestDense<src_type_, wgts_type_, bias_type_, dst_type_, 512, 512, 2, 2, true, hvx::util::VectorParam<2, 2>>("\t(batch=2)  ") +
+           TestDense<src_type_, wgts_type_, bias_type_, dst_type_, 512, 512, 2, 2, true, batch_v, tanh_epilogue>("\t(epilogue=tanh) ") +
+           // test parallel execution
+           TestDenseParallel<src_type_, wgts_type_, bias_type_, dst_type_>("\t(parallel) ") +
+           // test GEMM execution
+           TestDenseGemm<src_type_, wgts_type_, bias_type_, dst_type_>("\t(gemm) ");
+}
+
+/*!
+ * @brief batch parallel super layer compared against the serial execution (both src/dst ports are computed)
+ */
+template<hvx::util::layer_e layer_type_,
+         hvx::util::pooling_e pool_type_,
+         typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         int64_t fms_>
+auto
+TestSuperParallel(const char* name) noexcept -> std::string {
+    // configuration
+    using super = hvx::nn::SuperParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<16, 1>,
+                                      hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<fms_, 1>,
+                                      hvx::util::VectorParam<3, 3>, hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>,
+                                      hvx::util::Array2dParam<1, 1>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<1, 1>,
+                                      buffer_wgts, buffer_bias, overflow, underflow, exec, layer_type_, pool_type_>;
+
+    // random data (the SW containers are not needed)
+    std::vector<typename super::src_vec> src1(super::src_dim::vec_elms), src2(super::src_dim::vec_elms);
+    std::vector<typename super::wgts_vec> wgts(super::wgts_dim::vec_elms);
+    std::vector<typename super::bias_vec> bias(super::bias_dim::vec_elms);
+    std::vector<float> src_sw(super::src_dim::elms), wgts_sw(super::wgts_dim::elms), bias_sw(super::bias_dim::elms);
+    hvx::sw::EvalCreateRndSrc<typename super::src_vec, typename super::src_dim>(src1.data(), src_sw.data(), 0.75f);
+    hvx::sw::EvalCreateRndSrc<typename super::src_vec, typename super::src_dim>(src2.data(), src_sw.data(), 0.75f);
+    hvx::sw::EvalCreateRndSrc<typename super::wgts_vec, typename super::wgts_dim>(wgts.data(), wgts_sw.data(), 0.25f);
+    hvx::sw::EvalCreateRndSrc<typename super::bias_vec, typename super::bias_dim>(bias.data(), bias_sw.data(), 0.25f);
+
+    // serial and parallel execution on the same data
+    std::vector<typename super::dst_vec> dst1(super::dst_dim::vec_elms), dst2(super::dst_dim::vec_elms);
+    std::vector<typename super::dst_vec> par1(super::dst_dim::vec_elms), par2(super::dst_dim::vec_elms);
+    hvx::nn::SuperState<super> state;
+    hvx::nn::SuperTop<super, true, pool_type_, layer_type_>(state, src1.data(), src2.data(), wgts.data(), bias.data(), dst1.data(),
+                                                            dst2.data());
+    hvx::sim::ThreadPool pool(4);
+    hvx::sim::ParallelSuper<super, true, pool_type_, layer_type_>(src1.data(), src2.data(), wgts.data(), bias.data(), par1.data(),
+                                                                  par2.data(), pool);
+
+    // both executions need to be bit exact
+    const std::size_t bytes = dst1.size() * sizeof(typename super::dst_vec);
+    const bool exact = (std::memcmp(par1.data(), dst1.data(), bytes) == 0) && (std::memcmp(par2.data(), dst2.data(), bytes) == 0);
+    return name + CheckExact(exact) + "\n";
+}
+
+/*!
+ * @brief batch parallel super layer (the super layer needs the same src and dst type)
+ */
+template<typename type_>
+auto
+TestSuperMultiple() noexcept -> std::string {
+    constexpr auto conv      = hvx::util::layer_e::Conv;
+    constexpr auto depthwise = hvx::util::layer_e::Depthwise;
+    constexpr auto pool      = hvx::util::layer_e::Pool;
+
+    return TestSuperParallel<conv, hvx::util::pooling_e::kAvg, type_, type_, type_, type_, 4>("\t(conv, fms=4) ") +
+           TestSuperParallel<depthwise, hvx::util::pooling_e::kAvg, type_, type_, type_, type_, 1>("\t(depthwise) ") +
+           TestSuperParallel<pool, hvx::util::pooling_e::kMax, type_, type_, type_, type_, 1>("\t(MaxPool) ");
+}
+
+/*!
+ * @brief
+ */
+auto
+TestSuperLayers() noexcept -> void {
+    std::cout << "\nSuper (parallel): src[(16,1),(16,1),(8,2)] ker(3,3) pad(1,1) dil(0,0) str(1,1):\n" +
+                     TestSuperMultiple<hvx::util::dfixed<int16_t, 15>>() + TestSuperMultiple<hvx::util::dfixed<float, 28>>();
 }
 
 /******************************************************************************************************************************************/
@@ -301,12 +1249,243 @@ TestDenseMultiple() noexcept -> std::string {
 /*!
  * @brief
  */
-template<typename src_type_, typename dst_type_, int64_t rows_, int64_t cols_, int64_t chnls_, int64_t chnls_vec_size_>
+template<typename src1_type_,
+         typename src2_type_,
+         typename dst_type_,
+         int64_t heads_,
+         int64_t rows_,
+         int64_t inner_,
+         int64_t cols_,
+         int64_t row_vec_size_,
+         int64_t inner_vec_size_,
+         int64_t col_vec_size_,
+         bool src2_trans_,
+         typename matmul_batch_v_ = batch_v,
+         typename epilogue_       = hvx::util::EpilogueParam<>>
+auto
+TestMatMul(const char* name) noexcept -> std::string {
+    // configuration
+    using matmul = hvx::nn::MatMulParam<src1_type_, src2_type_, dst_type_, matmul_batch_v_, hvx::util::VectorParam<heads_, 1>,
+                                        hvx::util::VectorParam<rows_, row_vec_size_>, hvx::util::VectorParam<inner_, inner_vec_size_>,
+                                        hvx::util::VectorParam<cols_, col_vec_size_>, src2_trans_, overflow, underflow, exec, epilogue_>;
+
+    // create random data, compute SW, compute HW and evaluate
+    hvx::sw::MatMulEvaluate<matmul, hvx::sw::EvaluateParam<false, 4, 4, 4, typename matmul::dst_port, 0>> eval(0.75f);
+    hvx::HwMatMul<matmul>(eval.GetSrc1Hw(), eval.GetSrc2Hw(), eval.GetDstHw());
+    return name + eval.Compute() + "\n";
+}
+
+/*!
+ * @brief
+ */
+template<typename src1_type_, typename src2_type_, typename dst_type_>
+auto
+TestMatMulMultiple() noexcept -> std::string {
+    return "  MatMul: src1[(2,1),(16,2),(64,4)] src2[(2,1),(16,2),(64,4)] (transposed)\n" + //
+           TestMatMul<src1_type_, src2_type_, dst_type_, 2, 16, 64, 16, 2, 4, 2, true>("\t(default)     ") +
+           TestMatMul<src1_type_, src2_type_, dst_type_, 2, 16, 64, 16, 2, 4, 2, false>("\t(no trans)    ") +
+           // test vector
+           TestMatMul<src1_type_, src2_type_, dst_type_, 2, 16, 64, 16, 1, 1, 1, true>("\t(vec=1|1|1)   ") +
+           TestMatMul<src1_type_, src2_type_, dst_type_, 2, 16, 64, 16, 4, 8, 4, false>("\t(vec=4|8|4)   ") +
+           TestMatMul<src1_type_, src2_type_, dst_type_, 2, 16, 64, 16, 1, 64, 1, true>("\t(vec=1|64|1)  ") +
+           // test dimensions
+           TestMatMul<src1_type_, src2_type_, dst_type_, 4, 8, 32, 24, 2, 4, 2, true, hvx::util::VectorParam<2, 1>>("\t(batch=2)     ") +
+           TestMatMul<src1_type_, src2_type_, dst_type_, 1, 12, 20, 6, 2, 4, 2, false>("\t(12x20x6)     ") +
+           TestMatMul<src1_type_, src2_type_, dst_type_, 2, 16, 64, 16, 2, 4, 2, true, batch_v, relu_epilogue>("\t(epilogue=relu) ");
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         hvx::util::rnn_e cell_type_,
+         int64_t seq_,
+         int64_t calls_,
+         int64_t src_,
+         int64_t src_vec_size_,
+         int64_t hidden_,
+         int64_t hidden_vec_size_,
+         int64_t buf_wgts_ = false,
+         typename rnn_batch_v_ = batch_v>
+auto
+TestRnn(const char* name) noexcept -> std::string {
+    // configuration
+    using rnn = hvx::nn::RnnParam<src_type_, wgts_type_, bias_type_, dst_type_, rnn_batch_v_, hvx::util::VectorParam<seq_, 1>,
+                                  hvx::util::VectorParam<src_, src_vec_size_>, hvx::util::VectorParam<hidden_, hidden_vec_size_>,
+                                  cell_type_, buf_wgts_, overflow, underflow, exec>;
+
+    // create random data, compute SW, compute HW (the sequence is continued by every call) and evaluate
+    hvx::sw::RnnEvaluate<rnn, hvx::sw::EvaluateParam<false, 4, 4, 4, typename rnn::dst_port, 0>, calls_> eval(1.0f);
+    hvx::nn::RnnState<rnn> state;
+    for (int64_t call = 0; call < calls_; ++call)
+        hvx::nn::RnnTop<rnn>(state, eval.GetSrcHw(call), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw(call));
+    return name + eval.Compute() + "\n";
+}
+
+/*!
+ * @brief
+ */
+template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
+auto
+TestRnnMultiple() noexcept -> std::string {
+    constexpr auto lstm = hvx::util::rnn_e::kLstm;
+    constexpr auto gru  = hvx::util::rnn_e::kGru;
+    return "  LSTM/GRU: src[(16,1),(2,1),(32,4)] hidden[(32,4)]\n" + //
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, lstm, 16, 1, 32, 4, 32, 4>("\t(lstm)            ") +
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, gru, 16, 1, 32, 4, 32, 4>("\t(gru)             ") +
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, lstm, 4, 4, 32, 4, 32, 4>("\t(lstm,calls=4)    ") +
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, gru, 4, 4, 32, 4, 32, 4, true>("\t(gru,calls=4,buf) ") +
+           // test vector
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, lstm, 16, 1, 32, 1, 32, 1>("\t(lstm,vec=1|1)    ") +
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, gru, 16, 1, 32, 8, 32, 16>("\t(gru,vec=8|16)    ") +
+           // test dimensions
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, lstm, 8, 1, 12, 2, 20, 2, false, hvx::util::VectorParam<1, 1>>(
+               "\t(lstm,12->20)     ") +
+           TestRnn<src_type_, wgts_type_, bias_type_, dst_type_, gru, 8, 1, 64, 4, 16, 4, false, hvx::util::VectorParam<3, 1>>(
+               "\t(gru,64->16,b=3)  ");
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief
+ */
+template<typename src_type_,
+         typename dst_type_,
+         int64_t heads_,
+         int64_t dims_,
+         int64_t dims_vec_size_,
+         int64_t tokens_,
+         int64_t calls_,
+         int64_t cache_len_,
+         bool scaled_ = true>
+auto
+TestAttention(const char* name) noexcept -> std::string {
+    // configuration
+    using attention = hvx::nn::AttentionParam<src_type_, dst_type_, hvx::util::VectorParam<heads_, 1>,
+                                              hvx::util::VectorParam<dims_, dims_vec_size_>, hvx::util::VectorParam<tokens_, 1>,
+                                              cache_len_, scaled_, overflow, underflow, exec>;
+
+    // create random data, compute SW, compute HW (one call per chunk of tokens) and evaluate
+    hvx::sw::AttentionEvaluate<attention, hvx::sw::EvaluateParam<false, 4, 4, 4, typename attention::dst_port, 0>, calls_> eval;
+    hvx::nn::AttentionState<attention> state;
+    for (int64_t call = 0; call < calls_; ++call)
+        hvx::HwAttention<attention>(state, eval.GetQHw(call), eval.GetKHw(call), eval.GetVHw(call), eval.GetDstHw(call));
+    return name + eval.Compute() + "\n";
+}
+
+/*!
+ * @brief online softmax with one dominant channel, its probability of 1.0 does not fit into the dst type and saturates
+ */
+auto
+TestSoftmaxSaturate() noexcept -> void {
+    using src_type = hvx::util::dfixed<int16_t, 8>;
+    using dst_type = hvx::util::dfixed<int16_t, 15>;
+    using softmax  = hvx::nn::SoftmaxParam<src_type, dst_type, hvx::util::VectorParam<1, 1>, hvx::util::VectorParam<1, 1>,
+                                           hvx::util::VectorParam<2, 1>, hvx::util::VectorParam<64, 4>, hvx::util::overflow_e::kSaturate,
+                                           hvx::util::underflow_e::kTrunc, exec, hvx::util::softmax_e::kOnline>;
+    constexpr int64_t chnl = 37;
+
+    // channel 37 of every pixel is 100.0, all others are -100.0 (exp(-200) vanishes in the sum)
+    std::vector<typename softmax::src_port> src(softmax::src_dim::vec_elms);
+    std::vector<typename softmax::dst_port> dst(softmax::dst_dim::vec_elms);
+    for (int64_t i = 0; i < softmax::src_dim::vec_elms; ++i) {
+        for (int64_t j = 0; j < softmax::src_dim::vec_size; ++j) {
+            const bool dominant = (((i * softmax::src_dim::vec_size) + j) % softmax::chnls) == chnl;
+            src[i].Get(j).data  = static_cast<int16_t>(dominant ? 25600 : -25600);
+        }
+    }
+
+    // the dominant channel saturates at the largest dst value, all others are 0
+    std::cout << "\nSoftmax (online, saturation)\n";
+    hvx::nn::SoftmaxState<softmax> state;
+    hvx::HwSoftmax<softmax>(state, src.data(), dst.data());
+    bool saturated = true;
+    for (int64_t i = 0; i < softmax::dst_dim::vec_elms; ++i) {
+        for (int64_t j = 0; j < softmax::dst_dim::vec_size; ++j) {
+            const bool dominant = (((i * softmax::dst_dim::vec_size) + j) % softmax::chnls) == chnl;
+            saturated &= (dst[i].Get(j).data == (dominant ? INT16_MAX : 0));
+        }
+    }
+    Check("saturated dst", saturated);
+}
+
+/*!
+ * @brief attention over values that do not fit into the dst type (the weighted sum of equal values is the value itself)
+ */
+auto
+TestAttentionSaturate() noexcept -> void {
+    using src_type  = hvx::util::dfixed<int16_t, 14>;
+    using dst_type  = hvx::util::dfixed<int16_t, 15>;
+    using attention = hvx::nn::AttentionParam<src_type, dst_type, hvx::util::VectorParam<2, 1>, hvx::util::VectorParam<16, 4>,
+                                              hvx::util::VectorParam<1, 1>, 4, true, hvx::util::overflow_e::kSaturate,
+                                              hvx::util::underflow_e::kRound, exec>;
+    constexpr int64_t head_elms = attention::src_dim::vec_elms / attention::heads;
+
+    // the queries and keys are zero (all keys have the same weight), the values of head 0 are 1.5 and of head 1 are -1.5
+    std::vector<typename attention::src_port> q(attention::src_dim::vec_elms), k(attention::src_dim::vec_elms);
+    std::vector<typename attention::src_port> v(attention::src_dim::vec_elms);
+    std::vector<typename attention::dst_port> dst(attention::dst_dim::vec_elms);
+    for (int64_t i = 0; i < attention::src_dim::vec_elms; ++i) {
+        for (int64_t j = 0; j < attention::src_dim::vec_size; ++j)
+            v[i].Get(j).data = static_cast<int16_t>((i < head_elms) ? 24576 : -24576);
+    }
+
+    // the dst saturates at the largest and smallest dst value in every decode step
+    std::cout << "\nAttention (saturation)\n";
+    hvx::nn::AttentionState<attention> state;
+    bool saturated = true;
+    for (int64_t call = 0; call < 6; ++call) {
+        hvx::HwAttention<attention>(state, q.data(), k.data(), v.data(), dst.data());
+        for (int64_t i = 0; i < attention::dst_dim::vec_elms; ++i) {
+            for (int64_t j = 0; j < attention::dst_dim::vec_size; ++j)
+                saturated &= (dst[i].Get(j).data == ((i < head_elms) ? INT16_MAX : INT16_MIN));
+        }
+    }
+    Check("saturated dst", saturated);
+}
+
+/*!
+ * @brief
+ */
+template<typename src_type_, typename dst_type_>
+auto
+TestAttentionMultiple() noexcept -> std::string {
+    return "  Attention: src[(1,1),(4,1),(64,4)] cache[16] (12 decode calls)\n" + //
+           TestAttention<src_type_, dst_type_, 4, 64, 4, 1, 12, 16>("\t(default)        ") +
+           TestAttention<src_type_, dst_type_, 4, 64, 4, 1, 12, 8>("\t(sliding window) ") +
+           TestAttention<src_type_, dst_type_, 4, 64, 4, 4, 3, 16>("\t(prefill=4)      ") +
+           TestAttention<src_type_, dst_type_, 4, 64, 4, 4, 5, 6>("\t(prefill=4,wrap) ") +
+           TestAttention<src_type_, dst_type_, 4, 64, 4, 1, 12, 16, false>("\t(unscaled)       ") +
+           // test vector
+           TestAttention<src_type_, dst_type_, 4, 64, 1, 1, 12, 16>("\t(vec=1)          ") +
+           TestAttention<src_type_, dst_type_, 4, 64, 16, 1, 12, 16>("\t(vec=16)         ") +
+           // test dimensions
+           TestAttention<src_type_, dst_type_, 1, 32, 2, 2, 6, 16>("\t(1x32,tokens=2)  ");
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief
+ */
+template<typename src_type_,
+         typename dst_type_,
+         int64_t rows_,
+         int64_t cols_,
+         int64_t chnls_,
+         int64_t chnls_vec_size_,
+         hvx::util::softmax_e softmax_type_ = hvx::util::softmax_e::kTwoPass>
 auto
 TestSoft(const char* name) noexcept -> std::string {
     // configuration
     using softmax = hvx::nn::SoftmaxParam<src_type_, dst_type_, batch_v, hvx::util::VectorParam<rows_, 1>, hvx::util::VectorParam<cols_, 1>,
-                                          hvx::util::VectorParam<chnls_, chnls_vec_size_>, overflow, underflow, exec>;
+                                          hvx::util::VectorParam<chnls_, chnls_vec_size_>, overflow, underflow, exec, softmax_type_>;
 
     // create random data, compute SW, compute HW and evaluate
     hvx::sw::SoftmaxEvaluate<softmax, hvx::sw::EvaluateParam<false, 4, 4, 4, typename softmax::dst_port, 0>> eval;
@@ -324,7 +1503,10 @@ TestSoftMultiple() noexcept -> std::string {
            TestSoft<src_type_, dst_type_, 1, 1, 1024, 1>("\t(default)      ") +
            TestSoft<src_type_, dst_type_, 1, 1, 512, 1>("\t(chnls=512)    ") +
            TestSoft<src_type_, dst_type_, 1, 1, 1024, 8>("\t(vec=8)        ") +
-           TestSoft<src_type_, dst_type_, 8, 8, 1024, 1>("\t(src=8,cols=8) ");
+           TestSoft<src_type_, dst_type_, 8, 8, 1024, 1>("\t(src=8,cols=8) ") +
+           TestSoft<src_type_, dst_type_, 1, 1, 1024, 1, hvx::util::softmax_e::kOnline>("\t(online)       ") +
+           TestSoft<src_type_, dst_type_, 1, 1, 1024, 8, hvx::util::softmax_e::kOnline>("\t(online,vec=8) ") +
+           TestSoft<src_type_, dst_type_, 8, 8, 64, 8, hvx::util::softmax_e::kOnline>("\t(online,8x8x64)");
 }
 
 /******************************************************************************************************************************************/
@@ -401,32 +1583,229 @@ template<typename src_type_,
          int64_t rows_,
          int64_t cols_,
          int64_t chnls_,
-         int64_t chnls_vec_size_>
+         int64_t chnls_vec_size_,
+         hvx::util::norm_e norm_type_      = hvx::util::norm_e::kAffine,
+         hvx::util::norm_axes_e norm_axes_ = hvx::util::norm_axes_e::kChnls,
+         std::enable_if_t<dst_type_::is_signed || (norm_type_ != hvx::util::norm_e::kLayer), bool> = true>
 auto
 TestLayernorm(const char* name) noexcept -> std::string {
     // configuration
     using layernorm = hvx::nn::LayernormParam<src_type_, dst_type_, wgts_type_, bias_type_, batch_v, hvx::util::VectorParam<rows_, 1>,
                                               hvx::util::VectorParam<cols_, 1>, hvx::util::VectorParam<chnls_, chnls_vec_size_>,
-                                              buffer_wgts, buffer_bias, overflow, underflow, exec>;
+                                              buffer_wgts, buffer_bias, overflow, underflow, exec, hvx::util::ClipParam<1, 0>,
+                                              norm_type_, norm_axes_>;
 
-    // create random data, compute SW, compute HW and evaluate
-    hvx::sw::LayernormEvaluate<layernorm, hvx::sw::EvaluateParam<false, 4, 4, 4, typename layernorm::dst_port, 0>> eval(1.0, 0.75, 0.25);
+    // create random data, compute SW, compute HW and evaluate (normalized data is scaled down to stay in the range of the dst type)
+    constexpr float wgts_max = (norm_type_ == hvx::util::norm_e::kAffine) ? 0.75f : 0.4f;
+    hvx::sw::LayernormEvaluate<layernorm, hvx::sw::EvaluateParam<false, 4, 4, 4, typename layernorm::dst_port, 0>> eval(1.0, wgts_max,
+                                                                                                                        0.25);
     hvx::HwLayernorm<layernorm>(eval.GetSrcHw(), eval.GetWgtsHw(), eval.GetBiasHw(), eval.GetDstHw());
     return name + eval.Compute() + "\n";
 }
 
+/*!
+ * @brief the normalized data of a layer norm is signed
+ */
+template<typename src_type_,
+         typename wgts_type_,
+         typename bias_type_,
+         typename dst_type_,
+         int64_t rows_,
+         int64_t cols_,
+         int64_t chnls_,
+         int64_t chnls_vec_size_,
+         hvx::util::norm_e norm_type_      = hvx::util::norm_e::kAffine,
+         hvx::util::norm_axes_e norm_axes_ = hvx::util::norm_axes_e::kChnls,
+         std::enable_if_t<!dst_type_::is_signed && (norm_type_ == hvx::util::norm_e::kLayer), bool> = true>
+auto
+TestLayernorm(const char* name) noexcept -> std::string {
+    return name + std::string("not supported for unsigned outputs\n");
+}
+
 /*!
  * @brief
  */
 template<typename src_type_, typename wgts_type_, typename bias_type_, typename dst_type_>
 auto
 TestLayernormMultiple() {
+    using hvx::util::norm_axes_e;
+    using hvx::util::norm_e;
     return "  Layer Norm: src[(16,1),(16,1),(32,1)\n" + //
            TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 32, 1>("\t(default)        ") +
            TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 32, 8>("\t(vec=8, chnl=32) ") +
-           TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 96, 8>("\t(vec=8, chnl=96) ");
+           TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 96, 8>("\t(vec=8, chnl=96) ") +
+           TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 32, 1, norm_e::kLayer, norm_axes_e::kChnls>(
+               "\t(layer, c)       ") +
+           TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 96, 8, norm_e::kLayer, norm_axes_e::kChnls>(
+               "\t(layer, c, v=8)  ") +
+           TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 32, 4, norm_e::kLayer, norm_axes_e::kColsChnls>(
+               "\t(layer, wc)      ") +
+           TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 8, 8, 32, 4, norm_e::kLayer, norm_axes_e::kRowsColsChnls>(
+               "\t(layer, hwc)     ") +
+           TestLayernorm<src_type_, wgts_type_, bias_type_, dst_type_, 16, 16, 32, 8, norm_e::kRms, norm_axes_e::kChnls>(
+               "\t(rms, c, v=8)    ");
 }
 
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief a layer state that is nested into another layer state
+ */
+struct InnerState : hvx::util::LayerArena<InnerState> {
+    hvx::util::array1d<int32_t, 100> buf;
+    hvx::util::ArenaSeal arena_seal;
+};
+
+/*!
+ * @brief a layer state with arrays before and after a nested layer state
+ */
+struct OuterState : hvx::util::LayerArena<OuterState> {
+    hvx::util::array1d<int64_t, 10> head;
+    InnerState inner;
+    hvx::util::array2d<int16_t, 8, 4> tail;
+    hvx::util::ArenaSeal arena_seal;
+};
+
+/*!
+ * @brief true if the arena of a layer state is completely used and no arena is open anymore
+ */
+auto
+ArenaClosed(const hvx::util::MemoryArena* arena) noexcept -> bool {
+    const auto& scope = hvx::util::ArenaScope::Current();
+    return (arena != nullptr) && (arena->BytesUsed() == arena->BytesReserved()) && (scope.arena == nullptr) && (scope.depth == 0);
+}
+
+/*!
+ * @brief the arrays of a layer state are zeroed and placed in one arena, also if the state is nested, copied or constructed again
+ */
+auto
+TestAllocator() noexcept -> void {
+    using type = hvx::util::dfixed<int16_t, 15>;
+    using conv = hvx::conv_param<type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                 hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<3, 3>,
+                                 hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>>;
+    std::cout << "\nAllocator (layer arena)\n";
+
+    // the nested state takes its arrays from the arena of the outer state
+    {
+        OuterState outer;
+        bool       zero = true;
+        for (int64_t i = 0; i < 10; ++i)
+            zero &= (outer.head.Get(i) == 0);
+        for (int64_t i = 0; i < 100; ++i)
+            zero &= (outer.inner.buf.Get(i) == 0);
+        for (int64_t i = 0; i < 8 * 4; ++i)
+            zero &= (outer.tail.data[i] == 0); // NOLINT
+        Check("nested state", ArenaClosed(outer.Arena()) && (outer.inner.Arena() == nullptr));
+        Check("zeroed arrays", zero);
+
+        // a copy gets its own arena, an array that is not part of a state is taken from the heap
+        outer.inner.buf.Set(7, 0);
+        OuterState copy(outer);
+        hvx::util::array1d<int32_t, 16> heap;
+        Check("copied state", ArenaClosed(copy.Arena()) && (copy.Arena() != outer.Arena()) && (copy.inner.buf.Get(0) == 7));
+        Check("heap array", ArenaClosed(outer.Arena()) && (heap.Get(0) == 0));
+    }
+
+    // states of a layer that are constructed one after the other reuse the measured layout
+    bool reuse = true;
+    for (int64_t i = 0; i < 3; ++i) {
+        hvx::nn::ConvState<conv> state;
+        reuse &= ArenaClosed(state.Arena()) && (state.sum_global.Get(0).Get(0).data == 0);
+    }
+    Check("reused layout", reuse);
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief analytic performance model of a conv -> pool -> dense chain (checks the model against the loop bounds of the layers)
+ */
+auto
+TestPerfModel() noexcept -> void {
+    using type  = hvx::util::dfixed<int16_t, 15>;
+    using conv  = hvx::conv_param<type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                  hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<3, 3>,
+                                  hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>>;
+    using pool  = hvx::pool_max_param<type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                      hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<2, 2>, hvx::util::VectorParam<2, 2>,
+                                      hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<2, 2>>;
+    using dense = hvx::dense_param<type, type, type, type, batch_v, hvx::util::VectorParam<1024, 8>, hvx::util::VectorParam<10, 1>>;
+    using chain = hvx::perf_chain<conv, pool, dense>;
+
+    // the pipelined top loops run "lat" iterations with an initiation interval of 1
+    static_assert(hvx::perf_model<conv>::interval == conv::lat, "conv interval");
+    static_assert(hvx::perf_model<pool>::interval == pool::lat, "pool interval");
+    static_assert(hvx::perf_model<dense>::interval == dense::conv_param::lat, "dense interval");
+    static_assert(hvx::perf_model<conv>::delay == conv::lat_cols * conv::lat_chnls * conv::lat_wait_fms, "conv buffers one row");
+    static_assert(hvx::perf_model<pool>::delay == pool::lat_cols * pool::lat_chnls, "pool buffers one row");
+    static_assert(chain::bottleneck == 0, "conv layer is the bottleneck");
+    static_assert(chain::interval == conv::lat, "chain interval");
+    static_assert(chain::latency < chain::latency_seq, "dataflow overlaps the layers");
+
+    // a partially vectorized kernel (3 parts) needs a third of the multipliers, but iterates 3 times over every dst pixel
+    using conv_part = hvx::conv_param<type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                      hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<3, 1>,
+                                      hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>>;
+    static_assert(hvx::perf_model<conv_part>::mults * 3 == hvx::perf_model<conv>::mults, "conv part multipliers");
+    static_assert(hvx::perf_model<conv_part>::interval - hvx::perf_model<conv>::interval ==
+                      2 * conv::lat_dst_pix * conv::lat_fms * conv::lat_chnls,
+                  "conv part interval");
+
+    // the fused depthwise-separable layer only iterates over the src chnls at src positions without a dst (instead of a second layer)
+    using sep = hvx::separable_param<type, type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                     hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<3, 3>,
+                                     hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>, hvx::util::Array2dParam<0, 0>,
+                                     hvx::util::Array2dParam<2, 2>>;
+    static_assert(hvx::perf_model<sep>::interval == sep::lat, "separable interval");
+    static_assert(hvx::perf_model<sep>::interval <
+                      hvx::perf_model<typename sep::dw_param>::interval + hvx::perf_model<typename sep::pw_param>::interval,
+                  "separable interval");
+
+    // the transposed conv only multiplies the kernel taps of a phase ("str^2" less than a conv on the zero-inserted src)
+    using tconv = hvx::transposed_conv_param<type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                             hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<4, 4>,
+                                             hvx::util::VectorParam<4, 4>, hvx::util::Array2dParam<1, 1>, hvx::util::Array2dParam<2, 2>>;
+    static_assert(hvx::perf_model<tconv>::interval == tconv::lat, "transposed conv interval");
+    static_assert(tconv::sum_elms * tconv::str_rows * tconv::str_cols == tconv::knl_elms * tconv::chnl_vec_size, "transposed conv taps");
+    static_assert(tconv::lat_dst_pix * tconv::str_rows * tconv::str_cols == batch_v::elms * tconv::dst_rows * tconv::dst_cols,
+                  "transposed conv dst vectors");
+
+    // the global pool reads every src vector once and only emits after the last row of a sample
+    using gpool = hvx::global_pool_avg_param<type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                             hvx::util::VectorParam<16, 4>>;
+    static_assert(hvx::perf_model<gpool>::interval == gpool::src_dim::vec_elms, "global pool interval");
+    static_assert(hvx::perf_model<gpool>::delay == 15 * gpool::lat_cols * gpool::lat_chnls, "global pool buffers the whole sample");
+
+    // the matmul buffers src2 of a head before it streams src1 against it (one src1/src2 tile per iteration)
+    using matmul = hvx::matmul_param<type, type, type, batch_v, hvx::util::VectorParam<4, 1>, hvx::util::VectorParam<16, 2>,
+                                     hvx::util::VectorParam<64, 4>, hvx::util::VectorParam<16, 2>, true>;
+    static_assert(hvx::perf_model<matmul>::interval == batch_v::elms * 4 * (16 * 8 + 8 * 8 * 16), "matmul interval");
+    static_assert(hvx::perf_model<matmul>::delay == matmul::lat_src2 + matmul::lat_inner - 1, "matmul buffers src2 first");
+    static_assert(hvx::perf_model<matmul>::mults == 4 * 2 * 2, "matmul multipliers");
+    static_assert(hvx::perf_model<matmul>::src_elms == matmul::src1_dim::elms, "matmul src elements");
+
+    // the attention latency grows with the filled part of the KV-cache and saturates once the cache is full (worst case is modeled)
+    using attention = hvx::attention_param<type, type, hvx::util::VectorParam<4, 1>, hvx::util::VectorParam<64, 4>,
+                                           hvx::util::VectorParam<1, 1>, 16>;
+    static_assert(hvx::perf_model<attention>::interval == attention::lat, "attention interval");
+    static_assert(attention::Lat(9) - attention::Lat(8) == 2 * 4 * 16, "attention decode step adds one key per head");
+    static_assert(attention::Lat(100) == attention::lat, "attention latency saturates at the cache length");
+
+    // the recurrent layers iterate over the concatenated input [src, hidden state] for every hidden vector (all gates are fused)
+    using lstm = hvx::lstm_param<type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<32, 4>,
+                                 hvx::util::VectorParam<32, 4>>;
+    using gru  = hvx::gru_param<type, type, type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<32, 4>,
+                                hvx::util::VectorParam<32, 4>>;
+    static_assert(hvx::perf_model<lstm>::interval == 16 * batch_v::elms * 8 * (32 + 32), "lstm interval");
+    static_assert(hvx::perf_model<lstm>::mults == 4 * 4, "lstm multipliers (fused gates)");
+    static_assert(hvx::perf_model<gru>::mults == 3 * 4, "gru multipliers (fused gates)");
+    static_assert(hvx::perf_model<gru>::delay == 32 + 32 - 1, "gru writes a hidden vector after the concatenated input");
+
+    std::cout << "\nPerformance model (conv -> pool -> dense)\n" << chain::Report(300.0, {"conv", "pool", "dense"});
+}
+
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -437,9 +1816,16 @@ auto
 TestLayers(const char* name) noexcept -> void {
     std::string results;
     results.append(TestConvMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
+    results.append(TestConvBatchNormMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
     results.append(TestDepthMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
+    results.append(TestSeparableMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
+    results.append(TestTransposedConvMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
     results.append(TestPoolMultiple<src_type_, dst_type_>());
+    results.append(TestGlobalPoolMultiple<src_type_, dst_type_>());
     results.append(TestDenseMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
+    results.append(TestMatMulMultiple<src_type_, wgts_type_, dst_type_>());
+    results.append(TestAttentionMultiple<src_type_, dst_type_>());
+    results.append(TestRnnMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
     results.append(TestSoftMultiple<src_type_, dst_type_>());
     //  results.append(TestActMultiple<src_type_, param_type_, dst_type_>());
     results.append(TestLayernormMultiple<src_type_, wgts_type_, bias_type_, dst_type_>());
@@ -447,6 +1833,14 @@ TestLayers(const char* name) noexcept -> void {
     std::cout << name << results;
 }
 
+/*!
+ * @brief
+ */
+auto
+TestLayersQuantized(const char* name) noexcept -> void {
+    std::cout << name + TestRequantMultiple();
+}
+
 /******************************************************************************************************************************************/
 
 /*!
@@ -461,14 +1855,31 @@ main() -> int {
     using type4 = hvx::util::dfixed<int16_t, 14>;
 
     //
-    std::array<const char*, 5> names{"\nFixed-Point [signed 16-bit, 15-bit fraction]\n",
+    std::array<const char*, 6> names{"\nFixed-Point [signed 16-bit, 15-bit fraction]\n",
                                      "\nFixed-Point [unsigned 16-bit, 16-bit fraction]\n", "\nFloating-Point\n",
                                      "\nFixed-Point [signed 16-bit, 15-bit fraction (inputs), 14-bit fraction (outputs)]\n",
-                                     "\nFixed-Point [signed 16-bit, 14-bit fraction (inputs), 15-bit fraction (outputs)]\n"};
+                                     "\nFixed-Point [signed 16-bit, 14-bit fraction (inputs), 15-bit fraction (outputs)]\n",
+                                     "\nQuantized [8-bit codes, per-channel requantization]\n"};
 
     //
     std::vector<std::thread> threads;
-    threads.reserve(5);
+    threads.reserve(6);
+
+    // storage of the layer states
+    TestAllocator();
+
+    // depthwise and pooling windows
+    TestWindowLayers();
+
+    // analytic performance model
+    TestPerfModel();
+
+    // parallel super layer
+    TestSuperLayers();
+
+    // online softmax and attention with a saturating dst
+    TestSoftmaxSaturate();
+    TestAttentionSaturate();
 
     // test neural network functions (one configuration per thread)
     threads.emplace_back(&TestLayers<type1, type1, type1, type1, type1>, names[0]);
@@ -476,8 +1887,10 @@ main() -> int {
     threads.emplace_back(&TestLayers<type3, type3, type3, type3, type3>, names[2]);
     threads.emplace_back(&TestLayers<type1, type1, type1, type1, type4>, names[3]);
     threads.emplace_back(&TestLayers<type4, type4, type4, type4, type1>, names[4]);
+    threads.emplace_back(&TestLayersQuantized, names[5]);
 
     // wait until all threads have finished
     for (auto& thread: threads)
         thread.join();
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
\ No newline at end of file
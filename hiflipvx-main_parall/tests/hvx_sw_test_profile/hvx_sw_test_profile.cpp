@@ -0,0 +1,153 @@
+﻿/**
+ * Licence: GNU GPLv3 \n
+ * You may copy, distribute and modify the software as long as you track
+ * changes/dates in source files. Any modifications to or software
+ * including (via compiler) GPL-licensed code must also be made available
+ * under the GPL along with build & install instructions.
+ *
+ * @file    hvx_sw_test_profile.cpp
+ * @author  Lester Kalms <lester.kalms@tu-dresden.de>
+ * @version 4.0
+ * @brief Description:\n
+ *  Tests the stream instrumentation of the C-simulation (stream profile and FIFO depths). The target is built with HVX_SIM_PROFILE, so
+ *  the profilers are checked by every default build.
+ */
+
+#include "../../include/sw_test/hvx_sw_test_core.h"
+
+#if !defined(HVX_SIM_PROFILE)
+#error "The profile test needs to be compiled with HVX_SIM_PROFILE!"
+#endif
+
+using batch_v = hvx::util::VectorParam<2, 1>;
+
+// number of failed checks
+int64_t failures = 0;
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief prints the result of a runtime check and counts it if it failed (the test returns a failure if any check failed)
+ */
+auto
+Check(const char* name, const bool passed) noexcept -> void {
+    if (!passed)
+        ++failures;
+    std::cout << "\t" << name << ": " << (passed ? "passed" : "FAILED") << "\n";
+}
+
+/******************************************************************************************************************************************/
+
+/*!
+ * @brief quotes, backslashes and all control characters are escaped in the JSON export
+ */
+auto
+TestJsonEscape() noexcept -> void {
+    std::cout << "\nJSON export\n";
+    std::string ctrl;
+    for (char c = 0; c < 0x20; ++c)
+        ctrl.push_back(c);
+    const auto escaped = hvx::sim::ProfileJsonEscape(ctrl);
+    bool       raw     = false;
+    for (const auto c : escaped)
+        raw |= (static_cast<unsigned char>(c) < 0x20);
+    Check("quotes and backslashes", hvx::sim::ProfileJsonEscape("f<\"a\\b\">()") == "f<\\\"a\\\\b\\\">()");
+    Check("control characters", !raw && (escaped.substr(0, 6) == "\\u0000") && (escaped.find("\\n") != std::string::npos) &&
+                                    (escaped.find("\\u001f") != std::string::npos));
+}
+
+/*!
+ * @brief stream profile of a strided max pooling layer (writes hvx_sw_test_profile.json)
+ */
+auto
+TestStreamProfile() noexcept -> void {
+    using type = hvx::util::dfixed<int16_t, 15>;
+    using pool = hvx::pool_max_param<type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<32, 1>,
+                                     hvx::util::VectorParam<8, 2>, hvx::util::VectorParam<2, 2>, hvx::util::VectorParam<2, 2>,
+                                     hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<2, 2>>;
+
+    // two calls of the same layer are accumulated into one entry
+    hvx::sim::ProfileReset();
+    hvx::sw::PoolEvaluate<pool, hvx::sw::EvaluateParam<false, 4, 4, 4, typename pool::dst_port, 0>, hvx::util::pooling_e::kMax> eval;
+    hvx::HwPoolMax<pool>(eval.GetSrcHw(), eval.GetDstHw());
+    hvx::HwPoolMax<pool>(eval.GetSrcHw(), eval.GetDstHw());
+
+    // every iteration visits both ports, the stride leaves the dst port idle in 3 of 4 src pixels
+    std::cout << "\nStream profile (max pooling, stride 2)\n";
+    const auto layers = hvx::sim::ProfileLayers();
+    const bool layer  = (layers.size() == 1) && (layers.at(0).name == "HwPoolMax") && (layers.at(0).calls == 2);
+    Check("layer", layer && (layers.at(0).ports.size() == 2));
+    if (layer && (layers.at(0).ports.size() == 2)) {
+        const auto& src = layers.at(0).ports.at(0);
+        const auto& dst = layers.at(0).ports.at(1);
+        Check("src port", src.is_read && (src.calls == 2 * pool::lat) && (src.beats == 2 * pool::src_dim::vec_elms) && (src.first == 0));
+        Check("dst port", !dst.is_read && (dst.calls == 2 * pool::lat) && (dst.beats == 2 * pool::dst_dim::vec_elms) && (dst.first > 0));
+    }
+    hvx::sim::ProfileReport();
+    Check("json", hvx::sim::ProfileWriteJson("hvx_sw_test_profile.json"));
+}
+
+/*!
+ * @brief FIFO depth of a max pooling -> conv chain (the pooling layer only writes in every second row, the conv reads continuously)
+ */
+auto
+TestFifoProfile() noexcept -> void {
+    using type = hvx::util::dfixed<int16_t, 15>;
+    using pool = hvx::pool_max_param<type, type, batch_v, hvx::util::VectorParam<16, 1>, hvx::util::VectorParam<16, 1>,
+                                     hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<2, 2>, hvx::util::VectorParam<2, 2>,
+                                     hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<0, 0>, hvx::util::Array2dParam<2, 2>>;
+    using conv = hvx::conv_param<type, type, type, type, batch_v, hvx::util::VectorParam<8, 1>, hvx::util::VectorParam<8, 1>,
+                                 hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<16, 4>, hvx::util::VectorParam<3, 3>,
+                                 hvx::util::VectorParam<3, 3>, hvx::util::Array2dParam<1, 1>>;
+
+    // capture the schedules layer by layer (the data is irrelevant)
+    std::vector<typename pool::src_port> src(pool::src_dim::vec_elms);
+    std::vector<typename pool::dst_port> tmp(pool::dst_dim::vec_elms);
+    std::vector<typename conv::wgts_vec> wgts(conv::wgts_vec_elms);
+    std::vector<typename conv::dst_port> dst(conv::dst_dim::vec_elms);
+    hvx::sim::FifoProfiler profiler;
+    profiler.Run([&]() {
+        hvx::HwPoolMax<pool>(src.data(), tmp.data());
+        hvx::HwConv<conv>(tmp.data(), wgts.data(), dst.data());
+    });
+    const auto fifos = profiler.Analyze();
+
+    // the minimal depth is stall-free, every smaller depth costs cycles
+    std::cout << "\nFIFO depths (max pooling -> conv)\n";
+    const bool fifo = (fifos.size() == 1) && (fifos.at(0).beats == pool::dst_dim::vec_elms) && fifos.at(0).error.empty();
+    Check("fifo", fifo);
+    if (fifo) {
+        bool less = true;
+        for (const auto& point : fifos.at(0).less)
+            less &= (point.cycles < 0) || (point.cycles > profiler.IdealCycles());
+        Check("depth", (profiler.IdealCycles() >= conv::lat) && (fifos.at(0).depth <= fifos.at(0).max_occupancy));
+        Check("stall-free", profiler.Cycles({fifos.at(0).depth}) == profiler.IdealCycles());
+        Check("smaller depths stall", less);
+    }
+    profiler.Report();
+
+    // a consumer that reads more vectors than its producer writes is reported (the pooling layer reads 4 times its dst), the layers are
+    // named by a user scope with characters that need to be escaped in the JSON export
+    hvx::sim::FifoProfiler mismatch;
+    mismatch.Run([&]() {
+        const hvx::sim::ProfileScope scope("pool \"a\"\\b");
+        hvx::HwPoolMax<pool>(src.data(), tmp.data());
+        hvx::HwPoolMax<pool>(src.data(), tmp.data());
+    });
+    const auto wrong = mismatch.Analyze();
+    Check("mismatch reported", (wrong.size() == 1) && !wrong.at(0).error.empty() && (wrong.at(0).consumed == pool::src_dim::vec_elms));
+    std::stringstream json;
+    if (mismatch.WriteJson("hvx_sw_test_profile_fifo.json"))
+        json << std::ifstream("hvx_sw_test_profile_fifo.json").rdbuf();
+    Check("json names escaped", json.str().find("\"producer\": \"pool \\\"a\\\"\\\\b/HwPoolMax\"") != std::string::npos);
+}
+
+/******************************************************************************************************************************************/
+
+auto
+main() -> int {
+    TestJsonEscape();
+    TestStreamProfile();
+    TestFifoProfile();
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}